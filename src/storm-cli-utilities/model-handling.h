@@ -30,6 +30,7 @@
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/hints/ExplicitModelCheckerResultCache.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -578,8 +579,13 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> preprocessSparseModelBi
         bisimType = storm::storage::BisimulationType::Weak;
     }
 
+    boost::optional<uint64_t> signatureRefinementThreads;
+    if (bisimulationSettings.isSparseSignatureRefinementSet()) {
+        signatureRefinementThreads = bisimulationSettings.getNumberOfSparseSignatureRefinementThreads();
+    }
+
     STORM_LOG_INFO("Performing bisimulation minimization...");
-    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType);
+    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, signatureRefinementThreads);
 }
 
 template<typename ValueType>
@@ -1200,17 +1206,100 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+/*!
+ * Evaluates each property of the form P=? [phi U<=T psi] for the time bounds 0, step, 2*step, ..., T at once and prints (and possibly exports) the
+ * resulting curve for the initial states.
+ */
+template<typename ValueType>
+void sweepTimeBoundsWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input,
+                                     ModelProcessingInformation const& mpi) {
+    auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    double const step = ioSettings.getTimeBoundSweepStep();
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    for (uint64_t propertyIndex = 0; propertyIndex < properties.size(); ++propertyIndex) {
+        auto const& property = properties[propertyIndex];
+        printModelCheckingProperty(property);
+        storm::logic::Formula const& formula = *property.getRawFormula();
+        if (!formula.isProbabilityOperatorFormula() || !formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+            STORM_LOG_ERROR("Time bound sweeps are only supported for time-bounded reachability properties.");
+            continue;
+        }
+        storm::logic::BoundedUntilFormula const& untilFormula = formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+        if (untilFormula.isMultiDimensional() || untilFormula.hasLowerBound() || !untilFormula.hasUpperBound()) {
+            STORM_LOG_ERROR("Time bound sweeps are only supported for time bounds of the form [0, T].");
+            continue;
+        }
+
+        // Collect the time bounds 0, step, 2*step, ..., T.
+        double const maxTimeBound = untilFormula.getNonStrictUpperBound<double>();
+        std::vector<double> timeBounds;
+        uint64_t const numberOfSteps = static_cast<uint64_t>(std::floor(maxTimeBound / step + 1e-9));
+        for (uint64_t index = 0; index <= numberOfSteps; ++index) {
+            timeBounds.push_back(std::min(index * step, maxTimeBound));
+        }
+        if (timeBounds.back() < maxTimeBound) {
+            timeBounds.push_back(maxTimeBound);
+        }
+
+        storm::utility::Stopwatch watch(true);
+        std::vector<std::vector<ValueType>> curve;
+        try {
+            curve = storm::api::computeBoundedUntilProbabilitiesForTimeBoundsWithSparseEngine<ValueType>(
+                mpi.env, sparseModel, storm::api::createTask<ValueType>(property.getRawFormula(), true), timeBounds);
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_ERROR("Cannot perform time bound sweep: " << ex.what());
+            continue;
+        }
+        watch.stop();
+
+        std::stringstream stream;
+        stream << "time";
+        for (auto state : sparseModel->getInitialStates()) {
+            stream << ",state" << state;
+        }
+        stream << '\n';
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            stream << timeBounds[boundIndex];
+            for (auto state : sparseModel->getInitialStates()) {
+                stream << "," << curve[boundIndex][state];
+            }
+            stream << '\n';
+        }
+        STORM_PRINT("Result (for initial states and " << timeBounds.size() << " time bounds):\n" << stream.str());
+        STORM_PRINT("Time for model checking: " << watch << ".\n");
+
+        if (ioSettings.isExportTimeBoundSweepSet()) {
+            std::string filename = (propertyIndex == 0 ? std::string("") : std::to_string(propertyIndex)) + ioSettings.getExportTimeBoundSweepFilename();
+            STORM_LOG_WARN_COND(propertyIndex == 0,
+                                "Prepending " << propertyIndex << " to file name for this property because there are multiple properties.");
+            std::ofstream filestream;
+            storm::utility::openFile(filename, filestream);
+            filestream << stream.str();
+            storm::utility::closeFile(filestream);
+        }
+    }
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+    // Results of the (discrete-time) sparse model checkers can be reused across properties.
+    std::shared_ptr<storm::modelchecker::ExplicitModelCheckerResultCache<ValueType>> resultCache;
+    if (storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isResultCacheSet() &&
+        (sparseModel->isOfType(storm::models::ModelType::Dtmc) || sparseModel->isOfType(storm::models::ModelType::Mdp))) {
+        resultCache = std::make_shared<storm::modelchecker::ExplicitModelCheckerResultCache<ValueType>>();
+    }
+    auto verificationCallback = [&sparseModel, &ioSettings, &mpi, &resultCache](std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                std::shared_ptr<storm::logic::Formula const> const& states) {
         bool filterForInitialStates = states->isInitialFormula();
         auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
         if (ioSettings.isExportSchedulerSet()) {
             task.setProduceSchedulers(true);
         }
+        if (resultCache) {
+            task.setHint(resultCache);
+        }
         std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
@@ -1264,7 +1353,9 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         }
         ++exportCount;
     };
-    if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
+    if (ioSettings.isTimeBoundSweepSet()) {
+        sweepTimeBoundsWithSparseEngine<ValueType>(sparseModel, input, mpi);
+    } else if (!(ioSettings.isComputeSteadyStateDistributionSet() || ioSettings.isComputeExpectedVisitingTimesSet())) {
         verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
     }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
@@ -1279,6 +1370,9 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
             [&mpi, &sparseModel]() { return storm::api::computeExpectedVisitingTimesWithSparseEngine<ValueType>(mpi.env, sparseModel); }, input,
             verificationCallback, postprocessingCallback);
     }
+    if (resultCache) {
+        STORM_LOG_INFO("Answered " << resultCache->getNumberOfCacheHits() << " model checking queries from the result cache.");
+    }
 }
 
 template<storm::dd::DdType DdType, typename ValueType>
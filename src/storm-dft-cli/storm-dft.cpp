@@ -3,6 +3,7 @@
 #include "storm-dft/settings/DftSettings.h"
 #include "storm-dft/settings/modules/DftGspnSettings.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
+#include "storm-dft/settings/modules/DftSimulationSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/exceptions/UnmetRequirementException.h"
@@ -21,6 +22,7 @@ void processOptions() {
     auto const& faultTreeSettings = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     auto const& dftGspnSettings = storm::settings::getModule<storm::dft::settings::modules::DftGspnSettings>();
+    auto const& dftSimulationSettings = storm::settings::getModule<storm::dft::settings::modules::DftSimulationSettings>();
     auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
 
     // Build DFT from given file
@@ -151,6 +153,25 @@ void processOptions() {
         }
     }
 
+    // Monte Carlo simulation
+    if (dftSimulationSettings.isSimulate()) {
+        STORM_LOG_THROW(dftIOSettings.usePropTimebound() || dftIOSettings.usePropTimepoints(), storm::exceptions::InvalidSettingsException,
+                        "Simulation requires a timebound or timepoints.");
+        std::vector<double> timepoints;
+        if (dftIOSettings.usePropTimepoints()) {
+            timepoints = dftIOSettings.getPropTimepoints();
+        }
+        if (dftIOSettings.usePropTimebound()) {
+            timepoints.push_back(dftIOSettings.getPropTimebound());
+        }
+
+        std::shared_ptr<storm::dft::storage::DFT<ValueType>> simulationDft = storm::dft::api::prepareForMarkovAnalysis<ValueType>(*dft);
+        // Only the failure of the top level event is of interest
+        simulationDft->setRelevantEvents(storm::dft::api::computeRelevantEvents({}, {}), false);
+        storm::dft::api::simulateDFT<ValueType>(*simulationDft, timepoints, dftSimulationSettings.getMonteCarloOptions(), true);
+        return;
+    }
+
     // From now on we analyse the DFT via model checking
 
     // Set min or max
@@ -12,6 +12,7 @@
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/storage/DFT.h"
 #include "storm-dft/storage/DftJsonExporter.h"
+#include "storm-dft/storage/DftSymmetries.h"
 #include "storm-dft/storage/SylvanBddManager.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm-dft/utility/MTTFHelper.h"
@@ -194,6 +195,33 @@ void exportDFTToSMT(storm::dft::storage::DFT<storm::RationalFunction> const& dft
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Export to SMT does not support this data type.");
 }
 
+template<>
+std::vector<storm::dft::simulator::MonteCarloResult> simulateDFT(storm::dft::storage::DFT<double> const& dft, std::vector<double> const& timebounds,
+                                                                 storm::dft::simulator::MonteCarloOptions const& options, bool printOutput) {
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft.buildStateGenerationInfo(storm::dft::storage::DftSymmetries()));
+    std::shared_ptr<storm::dft::simulator::ImportanceFunction<double> const> importanceFunction;
+    if (options.splittingFactor > 1) {
+        importanceFunction = std::make_shared<storm::dft::simulator::BECountImportanceFunction<double>>(dft);
+    }
+    storm::dft::simulator::DFTMonteCarloEstimator<double> estimator(dft, stateGenerationInfo, options, importanceFunction);
+    std::vector<storm::dft::simulator::MonteCarloResult> results = estimator.estimateUnreliability(timebounds);
+    if (printOutput) {
+        for (auto const& result : results) {
+            std::cout << "Estimated unreliability at timebound " << result.timebound << " is " << result.estimate << " with " << options.confidenceLevel * 100
+                      << "% confidence interval [" << result.lowerBound << ", " << result.upperBound << "]\n";
+        }
+        std::cout << "Number of simulated traces: " << estimator.getNumberOfTraces() << '\n';
+    }
+    return results;
+}
+
+template<>
+std::vector<storm::dft::simulator::MonteCarloResult> simulateDFT(storm::dft::storage::DFT<storm::RationalFunction> const& dft,
+                                                                 std::vector<double> const& timebounds,
+                                                                 storm::dft::simulator::MonteCarloOptions const& options, bool printOutput) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation is not supported for this data type.");
+}
+
 template<>
 void analyzeDFTSMT(storm::dft::storage::DFT<double> const& dft, bool printOutput) {
     uint64_t solverTimeout = 10;
@@ -8,6 +8,7 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/parser/DFTGalileoParser.h"
 #include "storm-dft/parser/DFTJsonParser.h"
+#include "storm-dft/simulator/DFTMonteCarloEstimator.h"
 #include "storm-dft/transformations/DftToGspnTransformator.h"
 #include "storm-dft/transformations/DftTransformer.h"
 #include "storm-dft/utility/DftValidator.h"
@@ -239,6 +240,21 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& d
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
                    std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
 
+/*!
+ * Estimate the probability of a system failure within the given time bounds by Monte Carlo simulation.
+ * If splitting is enabled in the options, the number of failed BEs is used as importance function.
+ *
+ * @param dft DFT. It must be prepared for Markovian analysis and its relevant events must be set.
+ * @param timebounds Time bounds.
+ * @param options Options for the Monte Carlo estimation.
+ * @param printOutput If true, the estimates are printed.
+ *
+ * @return Estimate and confidence interval for each time bound.
+ */
+template<typename ValueType>
+std::vector<storm::dft::simulator::MonteCarloResult> simulateDFT(storm::dft::storage::DFT<ValueType> const& dft, std::vector<double> const& timebounds,
+                                                                 storm::dft::simulator::MonteCarloOptions const& options, bool printOutput);
+
 /*!
  * Analyze the DFT using the SMT encoding
  *
@@ -4,6 +4,7 @@
 
 #include <storm/exceptions/IllegalArgumentException.h>
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -13,6 +14,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/bitoperations.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
@@ -38,6 +40,7 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
                                                                        storm::dft::storage::DftSymmetries const& symmetries)
     : dft(dft),
       stateGenerationInfo(std::make_shared<storm::dft::storage::DFTStateGenerationInfo>(dft.buildStateGenerationInfo(symmetries))),
+      numberOfThreads(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getNumberOfExplorationThreads()),
       generator(dft, *stateGenerationInfo),
       matrixBuilder(!generator.isDeterministicModel()),
       stateStorage(dft.stateBitVectorSize()),
@@ -363,8 +366,24 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     skippedStates.clear();
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+    this->numberOfThreads = numberOfThreads;
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double approximationThreshold) {
+    if (numberOfThreads > 1) {
+        if constexpr (std::is_same_v<ValueType, double>) {
+            exploreStateSpaceParallel(approximationThreshold);
+            return;
+        } else {
+            // Computing with parametric rates modifies shared (reference counted) values, thus the states are expanded sequentially.
+            STORM_LOG_WARN("Concurrent state space exploration is only supported for DFTs with numeric rates. Exploring sequentially.");
+        }
+    }
+
     size_t nrExpandedStates = 0;
     size_t nrSkippedStates = 0;
     storm::utility::ProgressMeasurement progress("explored states");
@@ -403,124 +422,243 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
         if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
             // Skip the current state
             ++nrSkippedStates;
-            STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
-            setMarkovian(true);
-            // Add transition to target state with temporary value 0
-            // TODO: what to do when there is no unique target state?
-            // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
-            matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-            // Remember skipped state
-            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
-            matrixBuilder.finishRow();
+            skipState(currentState, currentExplorationHeuristic);
         } else {
             // Explore the current state
             ++nrExpandedStates;
             storm::generator::StateBehavior<ValueType, StateType> behavior =
                 generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-            STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-            setMarkovian(behavior.begin()->isMarkovian());
+            addBehavior(behavior, currentExplorationHeuristic);
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+        // Output number of currently explored states
+        if (nrExpandedStates % 100 == 0) {
+            progress.updateProgress(nrExpandedStates);
+        }
+    }  // end exploration
+
+    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
+    STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
+    STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpaceParallel(double approximationThreshold) {
+    STORM_LOG_THROW((std::is_same_v<ValueType, double>), storm::exceptions::NotSupportedException,
+                    "Concurrent state space exploration is only supported for DFTs with numeric rates.");
+    // A state of the current batch together with its expansion.
+    struct BatchEntry {
+        DFTStatePointer state;
+        ExplorationHeuristicPointer heuristic;
+        bool skip;
+        // The reached states. The transitions to the i-th reached state use the temporary id OFFSET_UNREGISTERED_STATE + i.
+        std::vector<DFTStatePointer> successors;
+        storm::generator::StateBehavior<ValueType, StateType> behavior;
+    };
+
+    size_t nrExpandedStates = 0;
+    size_t nrSkippedStates = 0;
+    storm::utility::ProgressMeasurement progress("explored states");
+    progress.startNewMeasurement(0);
+
+    storm::utility::ThreadPool threadPool(numberOfThreads);
+    // Each thread uses its own generator. Copying the generator retains whether the unique failed state is used.
+    std::vector<storm::dft::generator::DftNextStateGenerator<ValueType, StateType>> workerGenerators(threadPool.getNumberOfThreads(), generator);
+    std::vector<BatchEntry> batch;
+    while (!explorationQueue.empty()) {
+        // Take the first states from the queue
+        batch.clear();
+        while (!explorationQueue.empty() && batch.size() < numberOfThreads * BATCH_SIZE_PER_THREAD) {
+            ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
+            StateType currentId = currentExplorationHeuristic->getId();
+            auto itFind = statesNotExplored.find(currentId);
+            STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
+            DFTStatePointer currentState = itFind->second.first;
+            STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
+            STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+            // Remove it from the list of not explored states
+            statesNotExplored.erase(itFind);
+
+            // Get concrete state if necessary
+            if (currentState->isPseudoState()) {
+                // Create concrete state from pseudo state
+                currentState->construct();
+            }
+            STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+            // The skipping decision only depends on the heuristic values when the state is taken from the queue, as in the sequential exploration.
+            bool skip = approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold);
+            batch.push_back(BatchEntry{currentState, currentExplorationHeuristic, skip, {}, {}});
+        }
+
+        // Expand the states concurrently. The reached states are only collected here as registering them modifies the state storage.
+        threadPool.processInParallel(0, batch.size(), [this, &batch, &workerGenerators](uint64_t begin, uint64_t end, uint64_t chunkIndex) {
+            auto& workerGenerator = workerGenerators[chunkIndex];
+            for (uint64_t i = begin; i < end; ++i) {
+                BatchEntry& entry = batch[i];
+                if (entry.skip) {
+                    continue;
+                }
+                workerGenerator.load(entry.state);
+                entry.behavior = workerGenerator.expand([this, &entry](DFTStatePointer const& state) {
+                    entry.successors.push_back(state);
+                    return static_cast<StateType>(OFFSET_UNREGISTERED_STATE + entry.successors.size() - 1);
+                });
+            }
+        });
 
-            // Now add all choices.
-            for (auto const& choice : behavior) {
-                // Add the probabilistic behavior to the matrix.
+        // Register the reached states and fill the matrix in the order in which the states were taken from the queue
+        for (BatchEntry& entry : batch) {
+            matrixBuilder.setRemapping(entry.state->getId());
+            matrixBuilder.newRowGroup();
+            if (entry.skip) {
+                ++nrSkippedStates;
+                skipState(entry.state, entry.heuristic);
+                continue;
+            }
+            ++nrExpandedStates;
+            std::vector<StateType> successorIds;
+            successorIds.reserve(entry.successors.size());
+            for (DFTStatePointer const& successor : entry.successors) {
+                successorIds.push_back(getOrAddStateIndex(successor));
+            }
+            // Replace the temporary ids. The temporary ids reflect the order in which the states were reached,
+            // so transitions to the same state are summed up in the same order as in the sequential exploration.
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            for (auto const& choice : entry.behavior) {
+                storm::generator::Choice<ValueType, StateType> registeredChoice(choice.getActionIndex(), choice.isMarkovian());
                 for (auto const& stateProbabilityPair : choice) {
-                    STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
-                    // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                    matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
-                    // Set heuristic values for reached states
-                    auto iter = statesNotExplored.find(stateProbabilityPair.first);
-                    if (iter != statesNotExplored.end()) {
-                        // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
-                            // Initialize heuristic values
-                            ExplorationHeuristicPointer heuristic;
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    heuristic =
-                                        std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
-                                        stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
-                            }
-                            if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
-                                // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                                // Initialize bounds
-                                // TODO: avoid hack
-                                ValueType lowerBound = getLowerBound(state);
-                                ValueType upperBound = getUpperBound(state);
-                                heuristic->setBounds(lowerBound, upperBound);
-                            }
-
-                            explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
-                            bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
-                            switch (usedHeuristic) {
-                                case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
-                                                                                                 /* next values are irrelevant */ stateProbabilityPair.second,
-                                                                                                 stateProbabilityPair.second);
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
-                                                                                                 choice.getTotalMass());
-                                    break;
-                                default:
-                                    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
-                            }
-                            if (changedPriority) {
-                                // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
-                            }
-                        }
+                    StateType id = stateProbabilityPair.first;
+                    if (id >= OFFSET_UNREGISTERED_STATE) {
+                        id = successorIds[id - OFFSET_UNREGISTERED_STATE];
                     }
+                    registeredChoice.addProbability(id, stateProbabilityPair.second);
                 }
-                matrixBuilder.finishRow();
+                behavior.addChoice(std::move(registeredChoice));
             }
+            behavior.setExpanded();
+            addBehavior(behavior, entry.heuristic);
         }
+
         if (storm::utility::resources::isTerminate()) {
             break;
         }
         // Output number of currently explored states
-        if (nrExpandedStates % 100 == 0) {
-            progress.updateProgress(nrExpandedStates);
-        }
+        progress.updateProgress(nrExpandedStates);
     }  // end exploration
 
-    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
+    STORM_LOG_INFO("Expanded " << nrExpandedStates << " states using " << numberOfThreads << " threads");
     STORM_LOG_INFO("Skipped " << nrSkippedStates << " states");
     STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
 }
 
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::skipState(DFTStatePointer const& state, ExplorationHeuristicPointer const& heuristic) {
+    STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(state));
+    setMarkovian(true);
+    // Add transition to target state with temporary value 0
+    // TODO: what to do when there is no unique target state?
+    // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
+    matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
+    // Remember skipped state
+    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(state, heuristic);
+    matrixBuilder.finishRow();
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitDFTModelBuilder<ValueType, StateType>::addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                                                                ExplorationHeuristicPointer const& currentExplorationHeuristic) {
+    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
+    setMarkovian(behavior.begin()->isMarkovian());
+
+    // Now add all choices.
+    for (auto const& choice : behavior) {
+        // Add the probabilistic behavior to the matrix.
+        for (auto const& stateProbabilityPair : choice) {
+            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+            // Set transition to state id + offset. This helps in only remapping all previously skipped states.
+            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+            // Set heuristic values for reached states
+            auto iter = statesNotExplored.find(stateProbabilityPair.first);
+            if (iter != statesNotExplored.end()) {
+                // Update heuristic values
+                DFTStatePointer state = iter->second.first;
+                if (!iter->second.second) {
+                    // Initialize heuristic values
+                    ExplorationHeuristicPointer heuristic;
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(
+                                stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+
+                    iter->second.second = heuristic;
+                    // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
+                    // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
+                    // !state->getFailableElements().hasBEs())) {
+                    if (state->getFailableElements().hasDependencies() ||
+                        (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                        // Do not skip absorbing state or if reached by dependencies
+                        iter->second.second->markExpand();
+                    }
+                    if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
+                        // Compute bounds for heuristic now
+                        if (state->isPseudoState()) {
+                            // Create concrete state from pseudo state
+                            state->construct();
+                        }
+                        STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
+
+                        // Initialize bounds
+                        // TODO: avoid hack
+                        ValueType lowerBound = getLowerBound(state);
+                        ValueType upperBound = getUpperBound(state);
+                        heuristic->setBounds(lowerBound, upperBound);
+                    }
+
+                    explorationQueue.push(heuristic);
+                } else if (!iter->second.second->isExpand()) {
+                    bool changedPriority = false;
+                    double oldPriority = iter->second.second->getPriority();
+                    switch (usedHeuristic) {
+                        case storm::dft::builder::ApproximationHeuristic::DEPTH:
+                            changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
+                                                                                         /* next values are irrelevant */ stateProbabilityPair.second,
+                                                                                         stateProbabilityPair.second);
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
+                            changedPriority =
+                                iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
+                            changedPriority =
+                                iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                            break;
+                        default:
+                            STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
+                    }
+                    if (changedPriority) {
+                        // Update priority queue
+                        explorationQueue.update(iter->second.second, oldPriority);
+                    }
+                }
+            }
+        }
+        matrixBuilder.finishRow();
+    }
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
     bool isAddLabelsClaiming = storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
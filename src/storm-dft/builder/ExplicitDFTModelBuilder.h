@@ -165,6 +165,15 @@ class ExplicitDFTModelBuilder {
     void buildModel(size_t iteration, double approximationThreshold = 0.0,
                     storm::dft::builder::ApproximationHeuristic approximationHeuristic = storm::dft::builder::ApproximationHeuristic::DEPTH);
 
+    /*!
+     * Set the number of threads used to expand states concurrently.
+     * By default, the number given by the fault tree settings is used.
+     * Concurrent expansion is only supported for numeric rates (double). For other value types, states are always expanded sequentially.
+     *
+     * @param numberOfThreads Number of threads. With a single thread, states are expanded sequentially.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
     /*!
      * Get the built model.
      *
@@ -190,6 +199,34 @@ class ExplicitDFTModelBuilder {
      */
     void exploreStateSpace(double approximationThreshold);
 
+    /*!
+     * Explore state space of DFT with multiple threads.
+     * States are taken from the exploration queue in batches. The states of a batch are expanded concurrently. Afterwards, the reached states are
+     * registered in the order in which the states were taken from the queue. Thus, the state ids do not depend on the scheduling of the threads.
+     * As the heuristic values of the states in a batch are fixed when the batch is taken, the exploration order is a relaxation of the
+     * sequential exploration order.
+     * Only supported for numeric rates (double), as the generators otherwise share parametric values.
+     *
+     * @param approximationThreshold Threshold to determine when to skip states.
+     */
+    void exploreStateSpaceParallel(double approximationThreshold);
+
+    /*!
+     * Skip the expansion of the current state by adding a transition with temporary value 0 to the failed state.
+     *
+     * @param state Current state.
+     * @param heuristic Heuristic values of the current state.
+     */
+    void skipState(DFTStatePointer const& state, ExplorationHeuristicPointer const& heuristic);
+
+    /*!
+     * Add the behavior of the current state to the matrix and update the heuristic values of the reached states.
+     *
+     * @param behavior Behavior of the current state.
+     * @param heuristic Heuristic values of the current state.
+     */
+    void addBehavior(storm::generator::StateBehavior<ValueType, StateType> const& behavior, ExplorationHeuristicPointer const& heuristic);
+
     /*!
      * Initialize the matrix for a refinement iteration.
      */
@@ -278,6 +315,10 @@ class ExplicitDFTModelBuilder {
     const size_t INITIAL_BITVECTOR_SIZE = 20000;
     // Offset used for pseudo states.
     const StateType OFFSET_PSEUDO_STATE = std::numeric_limits<StateType>::max() / 2;
+    // Offset used for the temporary ids of states reached during a concurrent expansion.
+    const StateType OFFSET_UNREGISTERED_STATE = std::numeric_limits<StateType>::max() / 2;
+    // Number of states per thread which are expanded together in the parallel exploration.
+    const size_t BATCH_SIZE_PER_THREAD = 16;
 
     // Dft
     storm::dft::storage::DFT<ValueType> const& dft;
@@ -299,6 +340,9 @@ class ExplicitDFTModelBuilder {
     // Id of initial state
     size_t initialStateIndex = 0;
 
+    // Number of threads used to expand states
+    uint64_t numberOfThreads;
+
     // Next state generator for exploring the state space
     storm::dft::generator::DftNextStateGenerator<ValueType, StateType> generator;
 
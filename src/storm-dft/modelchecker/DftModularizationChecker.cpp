@@ -1,5 +1,11 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <limits>
+#include <new>
+#include <numeric>
 #include <sstream>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
@@ -7,18 +13,107 @@
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/threads.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
+namespace {
+
+/*!
+ * Compute a key describing the structure of the given DFT independently of the element names.
+ * DFTs with the same key are equal up to renaming and thus have the same failure probabilities.
+ * @param dft DFT.
+ * @return Structural key.
+ */
+template<typename ValueType>
+std::string getStructuralKey(storm::dft::storage::DFT<ValueType> const& dft) {
+    using storm::dft::storage::elements::BEType;
+
+    std::stringstream stream;
+    // Parameters must be exact to avoid confusing different modules
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    stream << "top " << dft.getTopLevelIndex() << ";";
+    for (size_t id = 0; id < dft.nrElements(); ++id) {
+        auto const element = dft.getElement(id);
+        stream << element->typestring();
+        if (element->isBasicElement()) {
+            auto const be = dft.getBasicElement(id);
+            stream << " " << storm::dft::storage::elements::toString(be->beType());
+            switch (be->beType()) {
+                case BEType::CONSTANT:
+                    stream << " " << std::static_pointer_cast<storm::dft::storage::elements::BEConst<ValueType> const>(be)->failed();
+                    break;
+                case BEType::PROBABILITY: {
+                    auto const probBE = std::static_pointer_cast<storm::dft::storage::elements::BEProbability<ValueType> const>(be);
+                    stream << " " << probBE->activeFailureProbability() << " " << probBE->passiveFailureProbability();
+                    break;
+                }
+                case BEType::EXPONENTIAL: {
+                    auto const expBE = std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be);
+                    stream << " " << expBE->activeFailureRate() << " " << expBE->passiveFailureRate() << " " << expBE->isTransient();
+                    break;
+                }
+                case BEType::ERLANG: {
+                    auto const erlangBE = std::static_pointer_cast<storm::dft::storage::elements::BEErlang<ValueType> const>(be);
+                    stream << " " << erlangBE->phases() << " " << erlangBE->activeFailureRate() << " " << erlangBE->passiveFailureRate();
+                    break;
+                }
+                case BEType::WEIBULL: {
+                    auto const weibullBE = std::static_pointer_cast<storm::dft::storage::elements::BEWeibull<ValueType> const>(be);
+                    stream << " " << weibullBE->shape() << " " << weibullBE->rate();
+                    break;
+                }
+                case BEType::LOGNORMAL: {
+                    auto const logNormalBE = std::static_pointer_cast<storm::dft::storage::elements::BELogNormal<ValueType> const>(be);
+                    stream << " " << logNormalBE->mean() << " " << logNormalBE->standardDeviation();
+                    break;
+                }
+                case BEType::SAMPLES:
+                    for (auto const& [time, probability] :
+                         std::static_pointer_cast<storm::dft::storage::elements::BESamples<ValueType> const>(be)->activeSamples()) {
+                        stream << " " << time << ":" << probability;
+                    }
+                    break;
+                default:
+                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                                    "BE type '" << storm::dft::storage::elements::toString(be->beType()) << "' is not known.");
+            }
+        } else if (element->isGate() || element->isRestriction()) {
+            auto const& children = element->isGate() ? dft.getGate(id)->children() : dft.getRestriction(id)->children();
+            for (auto const& child : children) {
+                stream << " " << child->id();
+            }
+        } else if (element->isDependency()) {
+            auto const dependency = dft.getDependency(id);
+            stream << " " << dependency->probability() << " " << dependency->triggerEvent()->id();
+            for (auto const& dependent : dependency->dependentEvents()) {
+                stream << " " << dependent->id();
+            }
+            stream << (dft.isDependencyInConflict(id) ? " conflict" : "");
+        }
+        stream << ";";
+    }
+    return stream.str();
+}
+
+}  // namespace
+
 template<typename ValueType>
 DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+    : dft{dft},
+      numberOfThreads(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getNumberOfModuleThreads()),
+      maxSimultaneousBuilds(storm::settings::getModule<storm::dft::settings::modules::FaultTreeSettings>().getMaxSimultaneousModuleBuilds()),
+      sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -41,6 +136,17 @@ void DftModularizationChecker<ValueType>::populateDynamicModules(storm::dft::sto
     }
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+    this->numberOfThreads = numberOfThreads;
+}
+
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::setMaxSimultaneousBuilds(uint64_t maxSimultaneousBuilds) {
+    this->maxSimultaneousBuilds = maxSimultaneousBuilds;
+}
+
 template<typename ValueType>
 std::vector<ValueType> DftModularizationChecker<ValueType>::check(FormulaVector const& formulas, size_t chunksize) {
     // Gather time points
@@ -66,21 +172,45 @@ std::vector<ValueType> DftModularizationChecker<ValueType>::getProbabilitiesAtTi
 
 template<typename ValueType>
 std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<ValueType>::replaceDynamicModules(std::vector<ValueType> const& timepoints) {
+    // Identical modules have the same structural key and are only analysed once
+    std::vector<std::string> keys;
+    keys.reserve(dynamicModules.size());
+    for (auto const& mod : dynamicModules) {
+        keys.push_back(getStructuralKey(mod.getSubtree(*dft)));
+    }
+
+    // Gather the modules which need to be analysed together with the time points that are not cached yet
+    std::set<ValueType> timepointSet(timepoints.begin(), timepoints.end());
+    std::vector<std::pair<size_t, std::vector<ValueType>>> modulesToAnalyse;
+    std::set<std::string> handledKeys;
+    for (size_t i{0}; i < dynamicModules.size(); ++i) {
+        if (!handledKeys.insert(keys[i]).second) {
+            STORM_LOG_DEBUG("Reuse results for dynamic module " << dynamicModules[i].toString(*dft));
+            continue;
+        }
+        auto const& cachedResults{moduleResults[keys[i]]};
+        std::vector<ValueType> missingTimepoints;
+        for (auto const timebound : timepointSet) {
+            if (cachedResults.find(timebound) == cachedResults.end()) {
+                missingTimepoints.push_back(timebound);
+            }
+        }
+        if (!missingTimepoints.empty()) {
+            modulesToAnalyse.emplace_back(i, std::move(missingTimepoints));
+        }
+    }
+    STORM_LOG_INFO("Analyse " << modulesToAnalyse.size() << " of " << dynamicModules.size() << " dynamic modules.");
+    analyseDynamicModules(modulesToAnalyse, keys);
+
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
-
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
-        // Remember probabilities for module
+    for (size_t i{0}; i < dynamicModules.size(); ++i) {
+        auto const& cachedResults{moduleResults.at(keys[i])};
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
-            activeSamples[timebound] = probability;
+        for (auto const timebound : timepointSet) {
+            activeSamples[timebound] = cachedResults.at(timebound);
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[i].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -121,22 +251,78 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     return newDft;
 }
 
+template<typename ValueType>
+void DftModularizationChecker<ValueType>::analyseDynamicModules(std::vector<std::pair<size_t, std::vector<ValueType>>> const& modules,
+                                                                std::vector<std::string> const& keys) {
+    if (modules.empty()) {
+        return;
+    }
+    // Each analysis holds the state space of its module, so the number of simultaneous analyses is bounded by the number of builds
+    uint64_t const numberOfWorkers{std::min<uint64_t>(maxSimultaneousBuilds == 0 ? numberOfThreads : std::min(numberOfThreads, maxSimultaneousBuilds),
+                                                      modules.size())};
+    // Start with the largest modules to balance the load
+    std::vector<size_t> order(modules.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this, &modules](size_t a, size_t b) {
+        return dynamicModules[modules[a].first].getAllElements().size() > dynamicModules[modules[b].first].getAllElements().size();
+    });
+
+    // Properties are created beforehand as parsing is not meant to happen concurrently
+    std::vector<FormulaVector> properties;
+    properties.reserve(modules.size());
+    for (auto const& [moduleIndex, moduleTimepoints] : modules) {
+        std::stringstream propertyStream{};
+        for (auto const timebound : moduleTimepoints) {
+            propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+        }
+        properties.push_back(storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str())));
+    }
+
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(modules.size());
+    std::vector<char> outOfMemory(modules.size(), false);
+    std::atomic<size_t> nextModule{0};
+    // Every worker fetches the next module as soon as it is done with the previous one
+    storm::utility::processInParallel(0, numberOfWorkers, numberOfWorkers, [&](uint64_t, uint64_t, uint64_t) {
+        for (size_t next = nextModule++; next < order.size(); next = nextModule++) {
+            auto const index{order[next]};
+            auto const& mod{dynamicModules[modules[index].first]};
+            STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
+            try {
+                results[index] = analyseDynamicModule(mod, properties[index], numberOfWorkers == 1);
+            } catch (std::bad_alloc const&) {
+                // Retry once the memory of the other analyses is freed
+                outOfMemory[index] = true;
+            }
+        }
+    });
+    for (size_t index{0}; index < modules.size(); ++index) {
+        if (outOfMemory[index]) {
+            STORM_LOG_WARN("Ran out of memory while analysing dynamic modules concurrently. Analyse module again on its own.");
+            results[index] = analyseDynamicModule(dynamicModules[modules[index].first], properties[index], true);
+        }
+    }
+
+    // Remember probabilities for module
+    for (size_t index{0}; index < modules.size(); ++index) {
+        auto& cachedResults{moduleResults[keys[modules[index].first]]};
+        auto const& moduleTimepoints{modules[index].second};
+        for (size_t i{0}; i < moduleTimepoints.size(); ++i) {
+            cachedResults[moduleTimepoints[i]] = boost::get<ValueType>(results[index][i]);
+        }
+    }
+}
+
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties, bool printInfo) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
 
     auto subDft = module.getSubtree(*dft);
 
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+    // Use a separate model checker as modules may be analysed concurrently
+    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker(printInfo);
+    return modelchecker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
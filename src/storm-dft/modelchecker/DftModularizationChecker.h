@@ -1,6 +1,9 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "storm-dft/modelchecker/DFTModelChecker.h"
@@ -17,6 +20,9 @@ namespace modelchecker {
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
  *
+ * Dynamic modules are independent of each other and are thus analyzed concurrently.
+ * Results of dynamic modules are cached by their structure (ignoring element names), such that repeated identical modules are only analyzed once.
+ *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
 template<typename ValueType>
@@ -58,6 +64,19 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Set the number of threads used to analyse dynamic modules concurrently.
+     * @param numberOfThreads Number of threads. Must be positive.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    /*!
+     * Set the maximal number of dynamic modules whose state spaces are built simultaneously.
+     * As each analysis holds the state space of its module, this bounds the memory consumption.
+     * @param maxSimultaneousBuilds Maximal number of simultaneous builds. A value of 0 only bounds them by the number of threads.
+     */
+    void setMaxSimultaneousBuilds(uint64_t maxSimultaneousBuilds);
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -75,20 +94,32 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probability at each time point.
+     * @param printInfo Whether the model checker prints information about the analysis.
      */
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+                                                                                                    FormulaVector const &properties, bool printInfo) const;
+
+    /*!
+     * Analyse the given dynamic modules concurrently and store their results in moduleResults.
+     * @param modules Indices of the dynamic modules together with the time points which are still missing for them.
+     * @param keys Structural keys of all dynamic modules.
+     */
+    void analyseDynamicModules(std::vector<std::pair<size_t, std::vector<ValueType>>> const &modules, std::vector<std::string> const &keys);
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
-    // DFT modelchecker
-    storm::dft::modelchecker::DFTModelChecker<ValueType> modelchecker;
+    // Number of threads for the analysis of dynamic modules
+    uint64_t numberOfThreads;
+    // Maximal number of simultaneous state space builds (0: only bounded by the number of threads)
+    uint64_t maxSimultaneousBuilds;
     // don't reinitialize Sylvan BDD
     // temporary
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Failure probabilities at the already analysed time points for each module structure
+    std::unordered_map<std::string, std::map<ValueType, ValueType>> moduleResults;
 };
 
 }  // namespace modelchecker
@@ -1,11 +1,16 @@
 #include <gmm/gmm_std.h>
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm/adapters/eigen.h"
+#include "storm/adapters/sylvan.h"
+#include "storm/utility/macros.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -15,6 +20,63 @@ using Bdd = SFTBDDChecker::Bdd;
 
 namespace {
 
+// Caches from (possibly complemented) Bdd nodes to their values
+using ProbabilityCache = std::unordered_map<uint64_t, ValueType>;
+using ProbabilitiesCache = std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>>;
+
+// Function called with an index and the id of the Lace worker executing it
+using ParallelFunction = std::function<void(uint64_t, uint64_t)>;
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wzero-length-array"
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+
+VOID_TASK_4(sft_parallel_for, uint64_t, begin, uint64_t, end, ParallelFunction const *, f, std::vector<std::exception_ptr> *, exceptions) {
+    if (end - begin == 1) {
+        // Exceptions must not pass through the Lace frames
+        try {
+            (*f)(begin, LACE_WORKER_ID);
+        } catch (...) {
+            (*exceptions)[begin] = std::current_exception();
+        }
+        return;
+    }
+    // Split the range, so that idle workers can steal one half
+    uint64_t const middle{begin + (end - begin) / 2};
+    SPAWN(sft_parallel_for, begin, middle, f, exceptions);
+    CALL(sft_parallel_for, middle, end, f, exceptions);
+    SYNC(sft_parallel_for);
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+/**
+ * Calls f(index, workerId) for every index in [0, size)
+ * on the Lace workers of the given manager.
+ *
+ * \note
+ * f must not spawn Lace tasks itself, i.e. it must not manipulate Bdds
+ * and must not call parallelFor (calls must not be nested).
+ * Then, each worker executes at most one call of f at a time
+ * and the worker id can be used to select data owned by the worker.
+ */
+void parallelFor(storm::dft::storage::SylvanBddManager const &manager, uint64_t const size, ParallelFunction const &f) {
+    if (size == 0) {
+        return;
+    }
+    std::vector<std::exception_ptr> exceptions(size);
+    manager.execute([&]() { RUN(sft_parallel_for, 0, size, &f, &exceptions); });
+    for (auto const &exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 /**
  * \returns
  * The probability that the bdd is true
@@ -32,7 +94,7 @@ namespace {
  * Must be empty or from an earlier call with a bdd that is an
  * ancestor of the current one.
  */
-ValueType recursiveProbability(Bdd const bdd, std::map<uint32_t, ValueType> const &indexToProbability, std::map<uint64_t, ValueType> &bddToProbability) {
+ValueType recursiveProbability(Bdd const bdd, std::vector<ValueType> const &indexToProbability, ProbabilityCache &bddToProbability) {
     if (bdd.isOne()) {
         return 1;
     } else if (bdd.isZero()) {
@@ -45,7 +107,7 @@ ValueType recursiveProbability(Bdd const bdd, std::map<uint32_t, ValueType> cons
     }
 
     auto const currentVar{bdd.TopVar()};
-    auto const currentProbability{indexToProbability.at(currentVar)};
+    auto const currentProbability{indexToProbability[currentVar]};
 
     auto const thenProbability{recursiveProbability(bdd.Then(), indexToProbability, bddToProbability)};
     auto const elseProbability{recursiveProbability(bdd.Else(), indexToProbability, bddToProbability)};
@@ -56,6 +118,22 @@ ValueType recursiveProbability(Bdd const bdd, std::map<uint32_t, ValueType> cons
     return probability;
 }
 
+/**
+ * \returns
+ * The cached probability of the given bdd.
+ *
+ * \param bddToProbability
+ * The cache filled by recursiveProbability with an ancestor of bdd.
+ */
+ValueType cachedProbability(Bdd const bdd, ProbabilityCache const &bddToProbability) {
+    if (bdd.isOne()) {
+        return 1;
+    } else if (bdd.isZero()) {
+        return 0;
+    }
+    return bddToProbability.at(bdd.GetBDD());
+}
+
 /**
  * \returns
  * The birnbaum importance factor of the given variable
@@ -71,17 +149,16 @@ ValueType recursiveProbability(Bdd const bdd, std::map<uint32_t, ValueType> cons
  * that must map every variable in the bdd to a probability
  *
  * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * The cache filled by recursiveProbability with bdd or an ancestor of it.
+ * It is only read, so it can be shared between threads.
  *
  * \param bddToBirnbaumFactor
  * A cache for common sub Bdds.
  * Must be empty or from an earlier call with a bdd that is an
  * ancestor of the current one.
  */
-ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, std::map<uint32_t, ValueType> const &indexToProbability,
-                                  std::map<uint64_t, ValueType> &bddToProbability, std::map<uint64_t, ValueType> &bddToBirnbaumFactor) {
+ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, std::vector<ValueType> const &indexToProbability,
+                                  ProbabilityCache const &bddToProbability, ProbabilityCache &bddToBirnbaumFactor) {
     if (bdd.isTerminal()) {
         return 0;
     }
@@ -92,15 +169,15 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
     }
 
     auto const currentVar{bdd.TopVar()};
-    auto const currentProbability{indexToProbability.at(currentVar)};
+    auto const currentProbability{indexToProbability[currentVar]};
 
     ValueType birnbaumFactor{0};
 
     if (currentVar > variableIndex) {
         return 0;
     } else if (currentVar == variableIndex) {
-        auto const thenProbability{recursiveProbability(bdd.Then(), indexToProbability, bddToProbability)};
-        auto const elseProbability{recursiveProbability(bdd.Else(), indexToProbability, bddToProbability)};
+        auto const thenProbability{cachedProbability(bdd.Then(), bddToProbability)};
+        auto const elseProbability{cachedProbability(bdd.Else(), bddToProbability)};
         birnbaumFactor = thenProbability - elseProbability;
     } else if (currentVar < variableIndex) {
         auto const thenBirnbaumFactor{recursiveBirnbaumFactor(variableIndex, bdd.Then(), indexToProbability, bddToProbability, bddToBirnbaumFactor)};
@@ -138,8 +215,8 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
  * are valid elements in bddToProbabilities.
  *
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
+Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::vector<Eigen::ArrayXd> const &indexToProbabilities,
+                                             ProbabilitiesCache &bddToProbabilities) {
     auto const bddId{bdd.GetBDD()};
     auto const it{bddToProbabilities.find(bddId)};
     if (it != bddToProbabilities.end() && it->second.first) {
@@ -161,7 +238,7 @@ Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const b
     auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
 
     auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+    auto const &currentProbabilities{indexToProbabilities[currentVar]};
 
     // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
     bddToProbabilitiesElement.first = true;
@@ -169,6 +246,19 @@ Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const b
     return &bddToProbabilitiesElement.second;
 }
 
+/**
+ * \returns
+ * The cached probabilities of the given bdd.
+ *
+ * \param bddToProbabilities
+ * The cache filled by recursiveProbabilities with an ancestor of bdd.
+ */
+Eigen::ArrayXd const &cachedProbabilities(Bdd const bdd, ProbabilitiesCache const &bddToProbabilities) {
+    auto const &element{bddToProbabilities.at(bdd.GetBDD())};
+    STORM_LOG_ASSERT(element.first, "Probabilities of the sub Bdd are outdated.");
+    return element.second;
+}
+
 /**
  * \returns
  * The birnbaum importance factors of the given variable
@@ -187,9 +277,8 @@ Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const b
  * that must map every variable in the bdd to a probabilities
  *
  * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * The cache filled by recursiveProbabilities with bdd or an ancestor of it.
+ * It is only read, so it can be shared between threads.
  *
  * \param bddToBirnbaumFactor
  * A cache for common sub Bdds.
@@ -197,9 +286,8 @@ Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const b
  * ancestor of the current one.
  */
 Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
+                                               std::vector<Eigen::ArrayXd> const &indexToProbabilities, ProbabilitiesCache const &bddToProbabilities,
+                                               ProbabilitiesCache &bddToBirnbaumFactors) {
     auto const bddId{bdd.GetBDD()};
     auto const it{bddToBirnbaumFactors.find(bddId)};
     if (it != bddToBirnbaumFactors.end() && it->second.first) {
@@ -214,11 +302,11 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     }
 
     auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+    auto const &currentProbabilities{indexToProbabilities[currentVar]};
 
     if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
+        auto const &thenProbabilities{cachedProbabilities(bdd.Then(), bddToProbabilities)};
+        auto const &elseProbabilities{cachedProbabilities(bdd.Else(), bddToProbabilities)};
 
         bddToBirnbaumFactorsElement.first = true;
         bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
@@ -235,6 +323,16 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * Marks all entries of the cache as outdated
+ * while keeping the allocated arrays.
+ */
+void invalidate(ProbabilitiesCache &cache) {
+    for (auto &i : cache) {
+        i.second.first = false;
+    }
+}
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -285,34 +383,54 @@ std::vector<std::vector<uint32_t>> SFTBDDChecker::getMinimalCutSetsAsIndices() {
     return mcs;
 }
 
+std::vector<uint32_t> SFTBDDChecker::getBasicElementIndices() const {
+    auto const basicElements{getDFT()->getBasicElements()};
+    std::vector<uint32_t> indices{};
+    indices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        indices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
+    return indices;
+}
+
+std::vector<ValueType> SFTBDDChecker::getIndexToProbability(ValueType timebound) const {
+    auto const basicElements{getDFT()->getBasicElements()};
+    auto const indices{getBasicElementIndices()};
+    std::vector<ValueType> indexToProbability(indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end()) + 1, 0);
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        indexToProbability[indices[i]] = basicElements[i]->getUnreliability(timebound);
+    }
+    return indexToProbability;
+}
+
 template<typename FuncType>
-void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const {
+void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func, bool parallelChunks) const {
+    if (timepoints.empty()) {
+        return;
+    }
     if (chunksize == 0) {
         chunksize = timepoints.size();
     }
 
-    // caches
     auto const basicElements{getDFT()->getBasicElements()};
-    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+    auto const indices{getBasicElementIndices()};
+    auto const numberOfVariables{indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end()) + 1};
+    auto const numberOfChunks{(timepoints.size() + chunksize - 1) / chunksize};
 
-    // The current timepoints we calculate with
-    Eigen::ArrayXd timepointsArray{chunksize};
-
-    for (size_t currentIndex{0}; currentIndex < timepoints.size(); currentIndex += chunksize) {
-        auto const sizeLeft{timepoints.size() - currentIndex};
-        if (sizeLeft < chunksize) {
-            chunksize = sizeLeft;
-            timepointsArray = Eigen::ArrayXd{chunksize};
-        }
+    auto const processChunk = [&](uint64_t const chunk) {
+        auto const offset{chunk * chunksize};
+        auto const currentChunksize{std::min(chunksize, timepoints.size() - offset)};
 
-        // Update current timepoints
-        for (size_t i{currentIndex}; i < currentIndex + chunksize; ++i) {
-            timepointsArray(i - currentIndex) = timepoints[i];
+        // The current timepoints we calculate with
+        Eigen::ArrayXd timepointsArray{currentChunksize};
+        for (size_t i{0}; i < currentChunksize; ++i) {
+            timepointsArray(i) = timepoints[offset + i];
         }
 
-        // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
+        // The probabilities of the basic elements
+        std::vector<Eigen::ArrayXd> indexToProbabilities(numberOfVariables);
+        for (size_t beIndex{0}; beIndex < basicElements.size(); ++beIndex) {
+            auto const &be{basicElements[beIndex]};
             // Vectorize known BETypes
             // fallback to getUnreliability() otherwise
             if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
@@ -320,42 +438,46 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
 
                 // exponential distribution
                 // p(T <= t) = 1 - exp(-lambda*t)
-                indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
+                indexToProbabilities[indices[beIndex]] = 1 - (-failureRate * timepointsArray).exp();
             } else {
                 auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
+                for (size_t i{0}; i < currentChunksize; ++i) {
                     probabilities(i) = be->getUnreliability(timepointsArray(i));
                 }
-                indexToProbabilities[beIndex] = probabilities;
+                indexToProbabilities[indices[beIndex]] = probabilities;
             }
         }
 
-        func(chunksize, timepointsArray, indexToProbabilities);
+        func(offset, currentChunksize, timepointsArray, indexToProbabilities);
+    };
+
+    if (parallelChunks) {
+        // The chunks are independent of each other,
+        // so they are distributed among the Lace workers
+        parallelFor(*getSylvanBddManager(), numberOfChunks, [&](uint64_t const chunk, uint64_t) { processChunk(chunk); });
+    } else {
+        for (uint64_t chunk{0}; chunk < numberOfChunks; ++chunk) {
+            processChunk(chunk);
+        }
     }
 }
 
 ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound) const {
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto const indexToProbability{getIndexToProbability(timebound)};
 
-    std::map<uint64_t, ValueType> bddToProbability{};
+    ProbabilityCache bddToProbability{};
+    bddToProbability.reserve(bdd.NodeCount());
     auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
     return probability;
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::vector<ValueType> resultProbabilities{};
-    resultProbabilities.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    auto const nodeCount{bdd.NodeCount()};
+    std::vector<ValueType> resultProbabilities(timepoints.size());
+
+    auto const calculateChunk = [&](auto const offset, auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
+        ProbabilitiesCache bddToProbabilities{};
+        bddToProbabilities.reserve(nodeCount);
 
         // Great care was made so that the pointer returned is always valid
         // and points to an element in bddToProbabilities
@@ -363,25 +485,23 @@ std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std:
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultProbabilities.push_back(probabilitiesArray(i));
+            resultProbabilities[offset + i] = probabilitiesArray(i);
         }
-    });
+    };
+    chunkCalculationTemplate(timepoints, chunksize, calculateChunk);
 
     return resultProbabilities;
 }
 
 template<typename FuncType>
 ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beName, ValueType timebound, FuncType func) {
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
+    auto const indexToProbability{getIndexToProbability(timebound)};
 
     auto const bdd{getTopLevelElementBdd()};
     auto const index{getSylvanBddManager()->getIndex(beName)};
-    std::map<uint64_t, ValueType> bddToProbability{};
-    std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
+    ProbabilityCache bddToProbability{};
+    ProbabilityCache bddToBirnbaumFactor{};
+    bddToProbability.reserve(bdd.NodeCount());
     auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
     auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
     auto const &beProbability{indexToProbability[index]};
@@ -392,26 +512,23 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
     auto const bdd{getTopLevelElementBdd()};
+    auto const indices{getBasicElementIndices()};
+    auto const indexToProbability{getIndexToProbability(timebound)};
 
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
+    ProbabilityCache bddToProbability{};
+    bddToProbability.reserve(bdd.NodeCount());
     auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
 
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
+    // The probability cache is complete and only read from now on,
+    // so the basic elements can be handled by different Lace workers
+    std::vector<ValueType> resultVector(indices.size());
+    parallelFor(*getSylvanBddManager(), indices.size(), [&](uint64_t const beIndex, uint64_t) {
+        auto const index{indices[beIndex]};
+        ProbabilityCache bddToBirnbaumFactor{};
         auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
         auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
-    }
+        resultVector[beIndex] = func(beProbability, probability, birnbaumFactor);
+    });
     return resultVector;
 }
 
@@ -419,34 +536,29 @@ template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
     auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
+    auto const nodeCount{bdd.NodeCount()};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
+    std::vector<ValueType> resultVector(timepoints.size());
+
+    auto const calculateChunk = [&](auto const offset, auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
+        ProbabilitiesCache bddToProbabilities{};
+        ProbabilitiesCache bddToBirnbaumFactors{};
+        bddToProbabilities.reserve(nodeCount);
 
         // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
         auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
         auto const &birnbaumFactorsArray{
             *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
 
-        auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
+        auto const &beProbabilitiesArray{indexToProbabilities[index]};
         auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultVector.push_back(ImportanceMeasureArray(i));
+            resultVector[offset + i] = ImportanceMeasureArray(i);
         }
-    });
+    };
+    chunkCalculationTemplate(timepoints, chunksize, calculateChunk);
 
     return resultVector;
 }
@@ -455,47 +567,42 @@ template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
     auto const bdd{getTopLevelElementBdd()};
-    auto const basicElements{getDFT()->getBasicElements()};
-
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
-    }
+    auto const nodeCount{bdd.NodeCount()};
+    auto const indices{getBasicElementIndices()};
 
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    // Each Lace worker reuses its own birnbaum cache for all basic elements it handles
+    std::vector<ProbabilitiesCache> workerToBirnbaumFactors(lace_workers());
+    std::vector<std::vector<ValueType>> resultVector(indices.size(), std::vector<ValueType>(timepoints.size()));
 
+    auto const calculateChunk = [&](auto const offset, auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
+        ProbabilitiesCache bddToProbabilities{};
+        bddToProbabilities.reserve(nodeCount);
         auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
 
-        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
+        // The probability cache is complete and only read from now on,
+        // so the basic elements can be handled by different Lace workers.
+        // As parallelFor must not be nested, the chunks themselves are processed sequentially.
+        parallelFor(*getSylvanBddManager(), indices.size(), [&](uint64_t const beIndex, uint64_t const worker) {
+            auto &bddToBirnbaumFactors{workerToBirnbaumFactors[worker]};
+            invalidate(bddToBirnbaumFactors);
 
             // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
+            // valid and points to an element in bddToBirnbaumFactors
+            auto const index{indices[beIndex]};
             auto const &birnbaumFactorsArray{
                 *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
 
-            auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
+            auto const &beProbabilitiesArray{indexToProbabilities[index]};
 
             auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
             // Update result Probabilities
             for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                resultVector[beIndex][offset + i] = ImportanceMeasureArray(i);
             }
-        }
-    });
+        });
+    };
+    chunkCalculationTemplate(timepoints, chunksize, calculateChunk, false);
 
     return resultVector;
 }
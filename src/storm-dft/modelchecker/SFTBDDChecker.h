@@ -18,6 +18,9 @@ namespace modelchecker {
 /**
  * Main class for the SFTBDDChecker
  *
+ * Chunks of timepoints and, for the importance measures,
+ * the basic elements are evaluated in parallel by the Lace workers of Sylvan.
+ * Their number is set by the Sylvan settings.
  */
 class SFTBDDChecker {
    public:
@@ -357,8 +360,33 @@ class SFTBDDChecker {
      */
     void recursiveMCS(Bdd const bdd, std::vector<uint32_t> &buffer, std::vector<std::vector<uint32_t>> &minimalCutSets) const;
 
+    /**
+     * \return
+     * The bdd variable index of every basic element
+     * in the order of dft->getBasicElements.
+     */
+    std::vector<uint32_t> getBasicElementIndices() const;
+
+    /**
+     * \return
+     * The failure probabilities of the basic elements at the given timebound
+     * indexed by their bdd variable index.
+     */
+    std::vector<ValueType> getIndexToProbability(ValueType timebound) const;
+
+    /**
+     * Splits the timepoints into chunks and calls
+     * func(offset, chunksize, timepointsArray, indexToProbabilities) for each chunk,
+     * where offset is the position of the chunk in the timepoints.
+     *
+     * \note
+     * If parallelChunks is set, the chunks are processed concurrently by the Lace workers,
+     * so func must only write to data that belongs to its chunk.
+     * Otherwise, the chunks are processed one after another
+     * and func may distribute its own work among the Lace workers.
+     */
     template<typename FuncType>
-    void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func) const;
+    void chunkCalculationTemplate(std::vector<ValueType> const &timepoints, size_t chunksize, FuncType func, bool parallelChunks = true) const;
 
     template<typename FuncType>
     ValueType getImportanceMeasureAtTimebound(std::string const &beName, ValueType timebound, FuncType func);
@@ -2,6 +2,7 @@
 
 #include "storm-dft/settings/modules/DftGspnSettings.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
+#include "storm-dft/settings/modules/DftSimulationSettings.h"
 #include "storm-dft/settings/modules/FaultTreeSettings.h"
 
 #include "storm-conv/settings/modules/JaniExportSettings.h"
@@ -41,6 +42,7 @@ void initializeDftSettings(std::string const& name, std::string const& executabl
     storm::settings::addModule<storm::dft::settings::modules::DftIOSettings>();
     storm::settings::addModule<storm::dft::settings::modules::FaultTreeSettings>();
     storm::settings::addModule<storm::dft::settings::modules::DftGspnSettings>();
+    storm::settings::addModule<storm::dft::settings::modules::DftSimulationSettings>();
     storm::settings::addModule<storm::settings::modules::IOSettings>();
     storm::settings::addModule<storm::settings::modules::CoreSettings>();
     storm::settings::addModule<storm::settings::modules::TransformationSettings>();
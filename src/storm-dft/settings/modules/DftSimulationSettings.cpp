@@ -0,0 +1,133 @@
+#include "DftSimulationSettings.h"
+
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/threads.h"
+
+namespace storm::dft {
+namespace settings {
+namespace modules {
+
+const std::string DftSimulationSettings::moduleName = "dftSimulation";
+const std::string DftSimulationSettings::simulateOptionName = "simulate";
+const std::string DftSimulationSettings::confidenceOptionName = "confidence";
+const std::string DftSimulationSettings::relativeErrorOptionName = "relative-error";
+const std::string DftSimulationSettings::minTracesOptionName = "min-traces";
+const std::string DftSimulationSettings::maxTracesOptionName = "max-traces";
+const std::string DftSimulationSettings::batchSizeOptionName = "batch-size";
+const std::string DftSimulationSettings::seedOptionName = "seed";
+const std::string DftSimulationSettings::threadsOptionName = "threads";
+const std::string DftSimulationSettings::splittingOptionName = "splitting";
+const std::string DftSimulationSettings::splittingLevelsOptionName = "splitting-levels";
+const std::string DftSimulationSettings::splittingMaxTracesOptionName = "splitting-max-traces";
+
+DftSimulationSettings::DftSimulationSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulateOptionName, false,
+                                                   "Estimate the probability of a system failure within the given time bounds by Monte Carlo simulation.")
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, confidenceOptionName, false, "The confidence level of the computed confidence intervals.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("level", "The confidence level.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, relativeErrorOptionName, false,
+                                                   "Stop the simulation as soon as all confidence intervals are within the given relative error.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("error", "The relative error. Zero disables early stopping.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, minTracesOptionName, false, "The minimal number of traces before the simulation may stop.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, maxTracesOptionName, false, "The maximal number of simulated traces.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .setDefaultValueUnsignedInteger(1000000)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, false, "The number of traces simulated with the same random number stream.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of traces.")
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, false, "The seed from which all random number streams are derived.")
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed.").setDefaultValueUnsignedInteger(0).build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "Sets the number of threads used to simulate traces concurrently. Does not affect the results.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splittingOptionName, false,
+                                                   "Use importance splitting based on the number of failed BEs to estimate rare failures.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "factor", "The number of traces into which a trace is split when it reaches a higher importance level.")
+                                         .setDefaultValueUnsignedInteger(2)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(1))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splittingLevelsOptionName, false, "The number of importance levels used for splitting.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of levels. If zero, each failed BE corresponds to a new level.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, splittingMaxTracesOptionName, false,
+                                                   "The maximal number of partial traces into which a single trace is split over all levels.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of partial traces.")
+                                         .setDefaultValueUnsignedInteger(10000)
+                                         .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+}
+
+bool DftSimulationSettings::isSimulate() const {
+    return this->getOption(simulateOptionName).getHasOptionBeenSet();
+}
+
+storm::dft::simulator::MonteCarloOptions DftSimulationSettings::getMonteCarloOptions() const {
+    storm::dft::simulator::MonteCarloOptions options;
+    options.confidenceLevel = this->getOption(confidenceOptionName).getArgumentByName("level").getValueAsDouble();
+    options.relativeError = this->getOption(relativeErrorOptionName).getArgumentByName("error").getValueAsDouble();
+    options.minTraces = this->getOption(minTracesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    options.maxTraces = this->getOption(maxTracesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    options.batchSize = this->getOption(batchSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    options.seed = this->getOption(seedOptionName).getArgumentByName("seed").getValueAsUnsignedInteger();
+    options.numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    if (options.numberOfThreads == 0) {
+        options.numberOfThreads = storm::utility::getNumberOfThreads();
+    }
+    if (this->getOption(splittingOptionName).getHasOptionBeenSet()) {
+        options.splittingFactor = this->getOption(splittingOptionName).getArgumentByName("factor").getValueAsUnsignedInteger();
+    }
+    options.numberOfLevels = this->getOption(splittingLevelsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    options.maxSplitTraces = this->getOption(splittingMaxTracesOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return options;
+}
+
+void DftSimulationSettings::finalize() {}
+
+bool DftSimulationSettings::check() const {
+    return true;
+}
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm::dft
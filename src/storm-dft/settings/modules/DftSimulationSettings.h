@@ -0,0 +1,58 @@
+#pragma once
+
+#include "storm-dft/simulator/DFTMonteCarloEstimator.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm::dft {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings for the analysis of DFTs by Monte Carlo simulation.
+ */
+class DftSimulationSettings : public storm::settings::modules::ModuleSettings {
+   public:
+    /*!
+     * Creates a new set of DFT simulation settings.
+     */
+    DftSimulationSettings();
+
+    /*!
+     * Retrieves whether the DFT should be analyzed by Monte Carlo simulation.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulate() const;
+
+    /*!
+     * Retrieves the options for the Monte Carlo estimation.
+     *
+     * @return Options.
+     */
+    storm::dft::simulator::MonteCarloOptions getMonteCarloOptions() const;
+
+    bool check() const override;
+
+    void finalize() override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string simulateOptionName;
+    static const std::string confidenceOptionName;
+    static const std::string relativeErrorOptionName;
+    static const std::string minTracesOptionName;
+    static const std::string maxTracesOptionName;
+    static const std::string batchSizeOptionName;
+    static const std::string seedOptionName;
+    static const std::string threadsOptionName;
+    static const std::string splittingOptionName;
+    static const std::string splittingLevelsOptionName;
+    static const std::string splittingMaxTracesOptionName;
+};
+
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm::dft
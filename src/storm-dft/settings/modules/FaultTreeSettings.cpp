@@ -9,6 +9,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/utility/threads.h"
 
 namespace storm::dft {
 namespace settings {
@@ -28,6 +29,9 @@ const std::string FaultTreeSettings::approximationHeuristicOptionName = "approxi
 const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
 const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
 const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
+const std::string FaultTreeSettings::explorationThreadsOptionName = "exploration-threads";
+const std::string FaultTreeSettings::moduleThreadsOptionName = "module-threads";
+const std::string FaultTreeSettings::moduleBuildsOptionName = "module-builds";
 #ifdef STORM_HAVE_Z3
 const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -73,6 +77,31 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build())
                         .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false, "Use a unique constantly failed BE.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used to expand states concurrently (non-parametric DFTs only).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, moduleThreadsOptionName, false,
+                                                   "Sets the number of threads used to analyse independent dynamic modules concurrently (BDD modularisation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, moduleBuildsOptionName, false,
+                                                   "Sets the maximal number of dynamic modules whose state spaces are built simultaneously. Bounds the memory "
+                                                   "consumption of the concurrent module analysis.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of simultaneous state space builds. If zero, it is only bounded by the number of threads.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 #ifdef STORM_HAVE_Z3
     this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -173,6 +202,20 @@ bool FaultTreeSettings::isUniqueFailedBE() const {
     return this->getOption(uniqueFailedBEOptionName).getHasOptionBeenSet();
 }
 
+uint64_t FaultTreeSettings::getNumberOfExplorationThreads() const {
+    uint64_t numberOfThreads = this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
+uint64_t FaultTreeSettings::getNumberOfModuleThreads() const {
+    uint64_t numberOfThreads = this->getOption(moduleThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
+uint64_t FaultTreeSettings::getMaxSimultaneousModuleBuilds() const {
+    return this->getOption(moduleBuildsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 #ifdef STORM_HAVE_Z3
 
 bool FaultTreeSettings::solveWithSMT() const {
@@ -116,6 +116,27 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool isUniqueFailedBE() const;
 
+    /*!
+     * Retrieves the number of threads used to expand states concurrently during state space exploration.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
+    /*!
+     * Retrieves the number of threads used to analyse independent dynamic modules concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfModuleThreads() const;
+
+    /*!
+     * Retrieves the maximal number of dynamic modules whose state spaces are built simultaneously.
+     *
+     * @return The maximal number of simultaneous builds. Zero indicates no bound besides the number of threads.
+     */
+    uint64_t getMaxSimultaneousModuleBuilds() const;
+
 #ifdef STORM_HAVE_Z3
 
     /*!
@@ -189,6 +210,9 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string maxDepthOptionName;
     static const std::string firstDependencyOptionName;
     static const std::string uniqueFailedBEOptionName;
+    static const std::string explorationThreadsOptionName;
+    static const std::string moduleThreadsOptionName;
+    static const std::string moduleBuildsOptionName;
 #ifdef STORM_HAVE_Z3
     static const std::string solveWithSmtOptionName;
 #endif
@@ -0,0 +1,250 @@
+#include "DFTMonteCarloEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm::dft {
+namespace simulator {
+
+template<typename ValueType>
+DFTMonteCarloEstimator<ValueType>::DFTMonteCarloEstimator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                          storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                                                          MonteCarloOptions const& options,
+                                                          std::shared_ptr<ImportanceFunction<ValueType> const> importanceFunction)
+    : dft(dft), stateGenerationInfo(stateGenerationInfo), options(options), importanceFunction(importanceFunction) {
+    STORM_LOG_THROW(options.confidenceLevel > 0 && options.confidenceLevel < 1, storm::exceptions::InvalidArgumentException,
+                    "The confidence level must be in (0,1).");
+    STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+    STORM_LOG_THROW(options.maxTraces > 0, storm::exceptions::InvalidArgumentException, "The maximal number of traces must be positive.");
+    STORM_LOG_THROW(options.splittingFactor > 0, storm::exceptions::InvalidArgumentException, "The splitting factor must be positive.");
+    STORM_LOG_THROW(options.splittingFactor == 1 || importanceFunction, storm::exceptions::InvalidArgumentException,
+                    "Splitting requires an importance function.");
+    STORM_LOG_THROW(options.maxSplitTraces > 0, storm::exceptions::InvalidArgumentException, "The maximal number of split traces must be positive.");
+    this->options.numberOfThreads = std::max<uint64_t>(options.numberOfThreads, 1);
+
+    if (importanceFunction) {
+        auto [lower, upper] = importanceFunction->getImportanceRange();
+        numberOfLevels = options.numberOfLevels > 0 ? options.numberOfLevels : std::max<uint64_t>(1, std::ceil(upper - lower));
+    }
+    quantile = boost::math::quantile(boost::math::normal(), 0.5 + options.confidenceLevel / 2);
+}
+
+template<typename ValueType>
+std::vector<MonteCarloResult> DFTMonteCarloEstimator<ValueType>::estimateUnreliability(std::vector<double> const& timebounds) {
+    STORM_LOG_THROW(!timebounds.empty(), storm::exceptions::InvalidArgumentException, "At least one time bound is required.");
+    uint64_t const numberOfBatches = (options.maxTraces + options.batchSize - 1) / options.batchSize;
+
+    // Each thread uses its own simulator and random number generator.
+    storm::utility::ThreadPool threadPool(options.numberOfThreads);
+    std::vector<boost::mt19937> randomGenerators(threadPool.getNumberOfThreads());
+    std::vector<std::unique_ptr<DFTTraceSimulator<ValueType>>> simulators;
+    for (auto& randomGenerator : randomGenerators) {
+        simulators.push_back(std::make_unique<DFTTraceSimulator<ValueType>>(dft, stateGenerationInfo, randomGenerator));
+    }
+
+    Statistics total;
+    total.sums.assign(timebounds.size(), 0.0);
+    total.squaredSums.assign(timebounds.size(), 0.0);
+    std::vector<Statistics> batchStatistics(threadPool.getNumberOfThreads());
+    std::vector<MonteCarloResult> results;
+    bool preciseEnough = false;
+    for (uint64_t firstBatch = 0; firstBatch < numberOfBatches && !preciseEnough; firstBatch += threadPool.getNumberOfThreads()) {
+        uint64_t const endBatch = std::min(firstBatch + threadPool.getNumberOfThreads(), numberOfBatches);
+        threadPool.processInParallel(firstBatch, endBatch, [&](uint64_t begin, uint64_t end, uint64_t chunkIndex) {
+            for (uint64_t batch = begin; batch < end; ++batch) {
+                simulateBatch(*simulators[chunkIndex], randomGenerators[chunkIndex], batch, timebounds, batchStatistics[batch - firstBatch]);
+            }
+        });
+
+        // Combine the batches in the order of their indices. As the stopping criterion is checked after each batch, the number of considered
+        // batches does not depend on the number of threads.
+        for (uint64_t batch = firstBatch; batch < endBatch; ++batch) {
+            Statistics const& statistics = batchStatistics[batch - firstBatch];
+            for (uint64_t i = 0; i < timebounds.size(); ++i) {
+                total.sums[i] += statistics.sums[i];
+                total.squaredSums[i] += statistics.squaredSums[i];
+            }
+            total.traces += statistics.traces;
+
+            results.clear();
+            for (uint64_t i = 0; i < timebounds.size(); ++i) {
+                results.push_back(computeResult(total, i, timebounds[i]));
+            }
+            if (total.traces >= options.minTraces && isPreciseEnough(results)) {
+                preciseEnough = true;
+                break;
+            }
+        }
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+    numberOfTraces = total.traces;
+    STORM_LOG_INFO("Simulated " << numberOfTraces << " traces" << (preciseEnough ? "" : " without reaching the required precision") << ".");
+    return results;
+}
+
+template<typename ValueType>
+void DFTMonteCarloEstimator<ValueType>::simulateBatch(DFTTraceSimulator<ValueType>& simulator, boost::mt19937& randomGenerator, uint64_t batchIndex,
+                                                      std::vector<double> const& timebounds, Statistics& statistics) const {
+    // Derive an independent random number stream for this batch
+    std::seed_seq seedSequence{static_cast<uint32_t>(options.seed), static_cast<uint32_t>(options.seed >> 32), static_cast<uint32_t>(batchIndex),
+                               static_cast<uint32_t>(batchIndex >> 32)};
+    randomGenerator.seed(seedSequence);
+
+    double const maxTimebound = *std::max_element(timebounds.begin(), timebounds.end());
+    statistics.sums.assign(timebounds.size(), 0.0);
+    statistics.squaredSums.assign(timebounds.size(), 0.0);
+    statistics.traces = std::min(options.batchSize, options.maxTraces - batchIndex * options.batchSize);
+
+    std::vector<std::pair<double, double>> failures;
+    std::vector<double> values(timebounds.size());
+    for (uint64_t trace = 0; trace < statistics.traces; ++trace) {
+        failures.clear();
+        simulateTrace(simulator, maxTimebound, failures);
+        if (failures.empty()) {
+            continue;
+        }
+        std::fill(values.begin(), values.end(), 0.0);
+        for (auto const& [time, weight] : failures) {
+            for (uint64_t i = 0; i < timebounds.size(); ++i) {
+                if (time <= timebounds[i]) {
+                    values[i] += weight;
+                }
+            }
+        }
+        for (uint64_t i = 0; i < timebounds.size(); ++i) {
+            statistics.sums[i] += values[i];
+            statistics.squaredSums[i] += values[i] * values[i];
+        }
+    }
+}
+
+template<typename ValueType>
+void DFTMonteCarloEstimator<ValueType>::simulateTrace(DFTTraceSimulator<ValueType>& simulator, double maxTimebound,
+                                                      std::vector<std::pair<double, double>>& failures) const {
+    if (options.splittingFactor == 1) {
+        if (simulator.simulateCompleteTrace(maxTimebound) == SimulationTraceResult::SUCCESSFUL) {
+            failures.emplace_back(simulator.getCurrentTime(), 1.0);
+        }
+        return;
+    }
+
+    // A partial trace which still needs to be simulated.
+    struct PartialTrace {
+        DFTStatePointer state;
+        double time;
+        uint64_t level;
+        double weight;
+    };
+
+    simulator.resetToInitial();
+    DFTStatePointer initialState = simulator.getCurrentState();
+    if (initialState->hasFailed(dft.getTopLevelIndex())) {
+        STORM_LOG_TRACE("DFT is initially failed");
+        failures.emplace_back(0.0, 1.0);
+        return;
+    }
+
+    std::vector<PartialTrace> partialTraces{{initialState, 0.0, getLevel(initialState), 1.0}};
+    // Number of partial traces created for this trace so far
+    uint64_t numberOfPartialTraces = 1;
+    while (!partialTraces.empty()) {
+        PartialTrace partialTrace = partialTraces.back();
+        partialTraces.pop_back();
+        simulator.resetToState(partialTrace.state);
+        simulator.setTime(partialTrace.time);
+
+        SimulationTraceResult result;
+        while ((result = simulator.simulateNextStep(maxTimebound)) == SimulationTraceResult::CONTINUE) {
+            uint64_t level = getLevel(simulator.getCurrentState());
+            if (level > partialTrace.level) {
+                // Split the trace as a higher importance level was reached
+                // States are not modified by the simulator, so all copies can continue from the same state.
+                // The copies are bounded by the remaining number of partial traces. This also prevents an overflow if many levels are crossed.
+                // The estimator stays unbiased as the weight is divided by the actual number of copies.
+                uint64_t const maxCopies = options.maxSplitTraces - numberOfPartialTraces + 1;
+                uint64_t copies = 1;
+                for (uint64_t i = partialTrace.level; i < level && copies < maxCopies; ++i) {
+                    copies = copies > maxCopies / options.splittingFactor ? maxCopies : copies * options.splittingFactor;
+                }
+                numberOfPartialTraces += copies - 1;
+                double weight = partialTrace.weight / copies;
+                for (uint64_t i = 0; i < copies; ++i) {
+                    partialTraces.push_back({simulator.getCurrentState(), simulator.getCurrentTime(), level, weight});
+                }
+                break;
+            }
+        }
+        if (result == SimulationTraceResult::SUCCESSFUL) {
+            failures.emplace_back(simulator.getCurrentTime(), partialTrace.weight);
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t DFTMonteCarloEstimator<ValueType>::getLevel(DFTStatePointer const& state) const {
+    auto [lower, upper] = importanceFunction->getImportanceRange();
+    if (upper <= lower) {
+        return 0;
+    }
+    double relativeImportance = (importanceFunction->getImportance(state) - lower) / (upper - lower);
+    return std::min<uint64_t>(numberOfLevels, std::floor(std::max(relativeImportance, 0.0) * numberOfLevels));
+}
+
+template<typename ValueType>
+MonteCarloResult DFTMonteCarloEstimator<ValueType>::computeResult(Statistics const& statistics, uint64_t index, double timebound) const {
+    double const n = statistics.traces;
+    double const mean = statistics.sums[index] / n;
+    double halfWidth;
+    double center;
+    if (options.splittingFactor == 1) {
+        // Each trace yields 0 or 1, so we use the Wilson score interval which is also meaningful if no failure was observed
+        double const z2 = quantile * quantile;
+        double const denominator = 1 + z2 / n;
+        center = (mean + z2 / (2 * n)) / denominator;
+        halfWidth = quantile * std::sqrt(mean * (1 - mean) / n + z2 / (4 * n * n)) / denominator;
+    } else {
+        // Normal approximation for the weighted outcomes
+        double const variance = n > 1 ? std::max(0.0, (statistics.squaredSums[index] - n * mean * mean) / (n - 1)) : 0.0;
+        center = mean;
+        halfWidth = quantile * std::sqrt(variance / n);
+    }
+    return MonteCarloResult{timebound, mean, std::max(0.0, center - halfWidth), std::min(1.0, center + halfWidth)};
+}
+
+template<typename ValueType>
+bool DFTMonteCarloEstimator<ValueType>::isPreciseEnough(std::vector<MonteCarloResult> const& results) const {
+    if (options.relativeError <= 0) {
+        return false;
+    }
+    for (auto const& result : results) {
+        if (result.estimate <= 0) {
+            return false;
+        }
+        double const maxDeviation = std::max(result.upperBound - result.estimate, result.estimate - result.lowerBound);
+        if (maxDeviation > options.relativeError * result.estimate) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+uint64_t DFTMonteCarloEstimator<ValueType>::getNumberOfTraces() const {
+    return numberOfTraces;
+}
+
+template class DFTMonteCarloEstimator<double>;
+template class DFTMonteCarloEstimator<storm::RationalFunction>;
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DFT.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Options for the Monte Carlo estimation.
+ */
+struct MonteCarloOptions {
+    // Confidence level of the computed confidence intervals.
+    double confidenceLevel = 0.95;
+    // The estimation stops as soon as the half width of each confidence interval is at most this fraction of the estimate.
+    // A value of 0 disables early stopping.
+    double relativeError = 0.01;
+    // Minimal number of traces before the estimation may stop early.
+    uint64_t minTraces = 1000;
+    // Maximal number of traces.
+    uint64_t maxTraces = 1000000;
+    // Number of traces which are simulated with the same random number stream.
+    uint64_t batchSize = 1000;
+    // Seed from which the random number streams are derived.
+    uint64_t seed = 0;
+    // Number of threads simulating traces concurrently.
+    uint64_t numberOfThreads = 1;
+    // Traces reaching a higher importance level are split into this number of traces. A value of 1 disables splitting.
+    uint64_t splittingFactor = 1;
+    // Number of importance levels used for splitting. If 0, each unit of importance forms one level.
+    uint64_t numberOfLevels = 0;
+    // Maximal number of partial traces into which a single trace is split (over all levels). Once reached, the trace is no longer split.
+    uint64_t maxSplitTraces = 10000;
+};
+
+/*!
+ * Estimated unreliability for one time bound.
+ */
+struct MonteCarloResult {
+    // Time bound.
+    double timebound;
+    // Estimated probability of a system failure within the time bound.
+    double estimate;
+    // Lower bound of the confidence interval.
+    double lowerBound;
+    // Upper bound of the confidence interval.
+    double upperBound;
+};
+
+/*!
+ * Estimates the unreliability of a DFT by Monte Carlo simulation.
+ * Traces are simulated in batches. Each batch uses its own random number stream which is derived from the seed and the batch index.
+ * The batches are distributed among the threads, each thread using its own DFTTraceSimulator. The batch results are combined in the order
+ * of the batch indices. Thus, the results only depend on the seed and not on the number of threads.
+ *
+ * Optionally, rare failures can be estimated with importance splitting: The range of the importance function is divided into levels.
+ * Whenever a trace reaches a higher level, it is split into several traces continuing from the current state with a correspondingly
+ * reduced weight. The number of partial traces per trace is bounded, as it otherwise grows exponentially in the number of levels.
+ */
+template<typename ValueType>
+class DFTMonteCarloEstimator {
+    using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
+
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param options Options for the estimation.
+     * @param importanceFunction Importance function used for splitting. Only required if splitting is enabled.
+     */
+    DFTMonteCarloEstimator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                           MonteCarloOptions const& options, std::shared_ptr<ImportanceFunction<ValueType> const> importanceFunction = nullptr);
+
+    /*!
+     * Estimate the probability of a system failure within each of the given time bounds.
+     * All time bounds are estimated from the same traces.
+     *
+     * @param timebounds Time bounds.
+     * @return Estimate and confidence interval for each time bound.
+     */
+    std::vector<MonteCarloResult> estimateUnreliability(std::vector<double> const& timebounds);
+
+    /*!
+     * Get the number of (unsplit) traces simulated in the last estimation.
+     *
+     * @return Number of traces.
+     */
+    uint64_t getNumberOfTraces() const;
+
+   private:
+    // Sums of the per trace outcomes for each time bound.
+    struct Statistics {
+        std::vector<double> sums;
+        std::vector<double> squaredSums;
+        uint64_t traces = 0;
+    };
+
+    /*!
+     * Simulate one batch of traces.
+     *
+     * @param simulator Simulator of the current thread.
+     * @param randomGenerator Random number generator used by the simulator.
+     * @param batchIndex Index of the batch.
+     * @param timebounds Time bounds.
+     * @param statistics Statistics for this batch.
+     */
+    void simulateBatch(DFTTraceSimulator<ValueType>& simulator, boost::mt19937& randomGenerator, uint64_t batchIndex, std::vector<double> const& timebounds,
+                       Statistics& statistics) const;
+
+    /*!
+     * Simulate a single trace (including the traces split from it).
+     *
+     * @param simulator Simulator.
+     * @param maxTimebound Maximal time bound.
+     * @param failures Is filled with the weighted failure times of the trace.
+     */
+    void simulateTrace(DFTTraceSimulator<ValueType>& simulator, double maxTimebound, std::vector<std::pair<double, double>>& failures) const;
+
+    /*!
+     * Get the importance level of the given state.
+     */
+    uint64_t getLevel(DFTStatePointer const& state) const;
+
+    /*!
+     * Compute the estimate and confidence interval from the given statistics.
+     */
+    MonteCarloResult computeResult(Statistics const& statistics, uint64_t index, double timebound) const;
+
+    /*!
+     * Check whether all confidence intervals are small enough.
+     */
+    bool isPreciseEnough(std::vector<MonteCarloResult> const& results) const;
+
+    // The DFT.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    // Options.
+    MonteCarloOptions options;
+
+    // Importance function (only used for splitting).
+    std::shared_ptr<ImportanceFunction<ValueType> const> importanceFunction;
+
+    // Number of importance levels.
+    uint64_t numberOfLevels = 0;
+
+    // Quantile of the standard normal distribution corresponding to the confidence level.
+    double quantile;
+
+    // Number of traces of the last estimation.
+    uint64_t numberOfTraces = 0;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
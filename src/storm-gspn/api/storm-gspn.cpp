@@ -3,8 +3,10 @@
 #include <boost/algorithm/string.hpp>
 #include "storm-conv/api/storm-conv.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
+#include "storm-gspn/generator/GspnNextStateGenerator.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
 #include "storm-parsers/parser/ExpressionParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/io/file.h"
 #include "storm/settings/SettingsManager.h"
@@ -17,6 +19,15 @@ storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn) {
     return builder.build();
 }
 
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::gspn::GSPN const& gspn, storm::builder::BuilderOptions const& options) {
+    auto generator = std::make_shared<storm::generator::GspnNextStateGenerator<ValueType>>(gspn, options);
+    storm::builder::ExplicitModelBuilder<ValueType> builder(generator);
+    return builder.build();
+}
+
+template std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModel(storm::gspn::GSPN const& gspn, storm::builder::BuilderOptions const& options);
+
 void handleGSPNExportSettings(storm::gspn::GSPN const& gspn,
                               std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter) {
     storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
@@ -4,6 +4,8 @@
 
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Model.h"
 #include "storm/storage/jani/Model.h"
 
 namespace storm {
@@ -14,6 +16,13 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the sparse model of a GSPN directly from its markings, i.e., without the translation to JANI.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::gspn::GSPN const& gspn,
+                                                                          storm::builder::BuilderOptions const& options = storm::builder::BuilderOptions());
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
@@ -0,0 +1,368 @@
+#include "storm-gspn/generator/GspnNextStateGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+template<typename ValueType, typename StateType>
+GspnNextStateGenerator<ValueType, StateType>::GspnNextStateGenerator(storm::gspn::GSPN const& gspn, NextStateGeneratorOptions const& options)
+    : NextStateGenerator<ValueType, StateType>(*gspn.getExpressionManager(), options), gspn(gspn) {
+    STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::NotSupportedException,
+                    "GSPN next-state generator cannot generate choice labels.");
+    STORM_LOG_THROW(!this->options.isBuildChoiceOriginsSet(), storm::exceptions::NotSupportedException,
+                    "GSPN next-state generator cannot generate choice origins.");
+    STORM_LOG_THROW(!this->options.isAddOutOfBoundsStateSet(), storm::exceptions::NotSupportedException,
+                    "GSPN next-state generator does not support out-of-bounds states.");
+    STORM_LOG_THROW(this->options.getRewardModelNames().empty(), storm::exceptions::InvalidArgumentException, "GSPNs do not contain reward models.");
+
+    modelType = ModelType::MA;
+    if (gspn.getNumberOfTimedTransitions() == 0) {
+        modelType = ModelType::MDP;
+    } else if (gspn.getNumberOfImmediateTransitions() == 0) {
+        modelType = ModelType::CTMC;
+    }
+
+    // Pack the places in the order of their ids.
+    this->variableInformation.totalBitOffset = 0;
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() == this->variableInformation.integerVariables.size(), "Places are not ordered by their id.");
+        uint64_t bitWidth;
+        int64_t upperBound;
+        if (place.hasRestrictedCapacity()) {
+            upperBound = place.getCapacity();
+            bitWidth = std::max<uint64_t>(1, std::ceil(std::log2(upperBound + 1)));
+        } else {
+            bitWidth = this->options.getReservedBitsForUnboundedVariables();
+            upperBound = (1ll << bitWidth) - 1;
+        }
+        STORM_LOG_THROW(static_cast<int64_t>(place.getNumberOfInitialTokens()) <= upperBound, storm::exceptions::WrongFormatException,
+                        "The initial number of tokens of place '" << place.getName() << "' exceeds its capacity.");
+        this->variableInformation.integerVariables.emplace_back(gspn.getExpressionManager()->getVariable(place.getName()), 0, upperBound,
+                                                                this->variableInformation.totalBitOffset, bitWidth, true, true, true);
+        bitToPlace.insert(bitToPlace.end(), bitWidth, place.getID());
+        this->variableInformation.totalBitOffset += bitWidth;
+    }
+    this->initializeSpecialStates();
+    this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(*gspn.getExpressionManager());
+
+    // Precompute the arcs of all transitions which can fire.
+    placeToTransitions.resize(gspn.getNumberOfPlaces());
+    std::vector<uint64_t> immediateTransitionIndices(gspn.getNumberOfImmediateTransitions());
+    for (uint64_t i = 0; i < gspn.getNumberOfImmediateTransitions(); ++i) {
+        auto const& transition = gspn.getImmediateTransitions()[i];
+        if (transition.noWeightAttached()) {
+            STORM_LOG_WARN("Immediate transition '" << transition.getName() << "' has no weight attached. Skipping this transition.");
+            continue;
+        }
+        immediateTransitionIndices[i] = transitions.size();
+        addTransition(transition, storm::utility::convertNumber<ValueType>(transition.getWeight()));
+    }
+    numberOfImmediateTransitions = transitions.size();
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        if (storm::utility::isZero(transition.getRate())) {
+            STORM_LOG_WARN("Timed transition '" << transition.getName() << "' has rate zero. Skipping this transition.");
+            continue;
+        }
+        addTransition(transition, storm::utility::convertNumber<ValueType>(transition.getRate()));
+        TransitionInformation& information = transitions.back();
+        if (transition.hasInfiniteServerSemantics() || (transition.hasKServerSemantics() && !transition.hasSingleServerSemantics())) {
+            STORM_LOG_THROW(transition.hasKServerSemantics() || !information.inputArcs.empty(), storm::exceptions::InvalidModelException,
+                            "Unclear semantics: Found a transition with infinite-server semantics and without input place (of positive multiplicity).");
+            information.scaleByEnablingDegree = true;
+            information.numberOfServers = transition.hasKServerSemantics() ? transition.getNumberOfServers() : 0;
+        }
+    }
+
+    for (auto const& partition : gspn.getPartitions()) {
+        STORM_LOG_ASSERT(partitions.empty() || partitions.back().priority >= partition.priority, "Partitions are not ordered by decreasing priority.");
+        Partition information{partition.priority, {}};
+        for (auto const& transitionId : partition.transitions) {
+            if (!gspn.getImmediateTransitions()[transitionId].noWeightAttached()) {
+                information.transitions.push_back(immediateTransitionIndices[transitionId]);
+            }
+        }
+        if (!information.transitions.empty()) {
+            partitions.push_back(std::move(information));
+        }
+    }
+    enabledTransitions = storm::storage::BitVector(transitions.size());
+    checkedTransitions = storm::storage::BitVector(transitions.size());
+
+    // Terminal states can only be given as expressions over the places.
+    if (this->options.hasTerminalStates()) {
+        for (auto const& expressionOrLabelAndBool : this->options.getTerminalStates()) {
+            if (expressionOrLabelAndBool.first.isExpression()) {
+                this->terminalStates.emplace_back(expressionOrLabelAndBool.first.getExpression(), expressionOrLabelAndBool.second);
+            } else {
+                STORM_LOG_THROW(this->isSpecialLabel(expressionOrLabelAndBool.first.getLabel()), storm::exceptions::InvalidArgumentException,
+                                "Terminal states refer to illegal label '" << expressionOrLabelAndBool.first.getLabel() << "'.");
+            }
+        }
+    }
+}
+
+template<typename ValueType, typename StateType>
+void GspnNextStateGenerator<ValueType, StateType>::addTransition(storm::gspn::Transition const& transition, ValueType const& weightOrRate) {
+    uint64_t const index = transitions.size();
+    TransitionInformation information;
+    information.name = transition.getName();
+    information.weightOrRate = weightOrRate;
+
+    auto createArc = [this](uint64_t place, int64_t value) {
+        auto const& variable = this->variableInformation.integerVariables[place];
+        return Arc{place, variable.bitOffset, variable.bitWidth, value};
+    };
+    for (auto const& [place, multiplicity] : transition.getInputPlaces()) {
+        // An input arc with multiplicity zero neither restricts the enabledness nor the enabling degree.
+        if (multiplicity == 0) {
+            continue;
+        }
+        information.inputArcs.push_back(createArc(place, multiplicity));
+        placeToTransitions[place].push_back(index);
+    }
+    for (auto const& [place, multiplicity] : transition.getInhibitionPlaces()) {
+        information.inhibitionArcs.push_back(createArc(place, multiplicity));
+        if (transition.getInputPlaces().count(place) == 0) {
+            placeToTransitions[place].push_back(index);
+        }
+    }
+
+    // Combine input and output arcs into the change of tokens per place.
+    std::map<uint64_t, int64_t> effect;
+    for (auto const& [place, multiplicity] : transition.getInputPlaces()) {
+        effect[place] -= static_cast<int64_t>(multiplicity);
+    }
+    for (auto const& [place, multiplicity] : transition.getOutputPlaces()) {
+        effect[place] += static_cast<int64_t>(multiplicity);
+    }
+    for (auto const& [place, change] : effect) {
+        if (change != 0) {
+            information.effect.push_back(createArc(place, change));
+        }
+    }
+
+    // Sort the arcs by place such that the marking is accessed in order.
+    auto byPlace = [](Arc const& a, Arc const& b) { return a.place < b.place; };
+    std::sort(information.inputArcs.begin(), information.inputArcs.end(), byPlace);
+    std::sort(information.inhibitionArcs.begin(), information.inhibitionArcs.end(), byPlace);
+    transitions.push_back(std::move(information));
+}
+
+template<typename ValueType, typename StateType>
+ModelType GspnNextStateGenerator<ValueType, StateType>::getModelType() const {
+    return modelType;
+}
+
+template<typename ValueType, typename StateType>
+bool GspnNextStateGenerator<ValueType, StateType>::isDeterministicModel() const {
+    return modelType == ModelType::CTMC;
+}
+
+template<typename ValueType, typename StateType>
+bool GspnNextStateGenerator<ValueType, StateType>::isDiscreteTimeModel() const {
+    return modelType == ModelType::MDP;
+}
+
+template<typename ValueType, typename StateType>
+bool GspnNextStateGenerator<ValueType, StateType>::isPartiallyObservable() const {
+    return false;
+}
+
+template<typename ValueType, typename StateType>
+std::vector<StateType> GspnNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+    CompressedState initialState(this->variableInformation.getTotalBitOffset(true));
+    for (auto const& place : gspn.getPlaces()) {
+        auto const& variable = this->variableInformation.integerVariables[place.getID()];
+        initialState.setFromInt(variable.bitOffset, variable.bitWidth, place.getNumberOfInitialTokens());
+    }
+    return {stateToIdCallback(initialState)};
+}
+
+template<typename ValueType, typename StateType>
+bool GspnNextStateGenerator<ValueType, StateType>::isEnabled(TransitionInformation const& transition, CompressedState const& marking) const {
+    for (auto const& arc : transition.inputArcs) {
+        if (static_cast<int64_t>(marking.getAsInt(arc.bitOffset, arc.bitWidth)) < arc.value) {
+            return false;
+        }
+    }
+    for (auto const& arc : transition.inhibitionArcs) {
+        if (static_cast<int64_t>(marking.getAsInt(arc.bitOffset, arc.bitWidth)) >= arc.value) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType, typename StateType>
+void GspnNextStateGenerator<ValueType, StateType>::updateEnabledTransitions(CompressedState const& marking) {
+    if (lastMarking.size() != marking.size()) {
+        // No previous marking, check all transitions.
+        for (uint64_t i = 0; i < transitions.size(); ++i) {
+            enabledTransitions.set(i, isEnabled(transitions[i], marking));
+        }
+    } else {
+        std::vector<uint64_t> checked;
+        storm::storage::BitVector changedBits = lastMarking ^ marking;
+        uint64_t lastPlace = bitToPlace.size();
+        for (auto bit : changedBits) {
+            if (bit >= bitToPlace.size() || bitToPlace[bit] == lastPlace) {
+                continue;
+            }
+            lastPlace = bitToPlace[bit];
+            for (auto const& transition : placeToTransitions[lastPlace]) {
+                if (!checkedTransitions.get(transition)) {
+                    checkedTransitions.set(transition);
+                    checked.push_back(transition);
+                    enabledTransitions.set(transition, isEnabled(transitions[transition], marking));
+                }
+            }
+        }
+        for (auto const& transition : checked) {
+            checkedTransitions.set(transition, false);
+        }
+    }
+    lastMarking = marking;
+}
+
+template<typename ValueType, typename StateType>
+CompressedState GspnNextStateGenerator<ValueType, StateType>::fire(TransitionInformation const& transition, CompressedState const& marking) const {
+    CompressedState result = marking;
+    for (auto const& arc : transition.effect) {
+        int64_t tokens = static_cast<int64_t>(marking.getAsInt(arc.bitOffset, arc.bitWidth)) + arc.value;
+        STORM_LOG_ASSERT(tokens >= 0, "Firing transition '" << transition.name << "' leads to a negative number of tokens.");
+        auto const& variable = this->variableInformation.integerVariables[arc.place];
+        STORM_LOG_THROW(tokens <= variable.upperBound, storm::exceptions::WrongFormatException,
+                        "Firing transition '" << transition.name << "' leads to an out-of-bounds value (" << tokens << ") for the place '" << variable.getName()
+                                              << "'.");
+        result.setFromInt(arc.bitOffset, arc.bitWidth, tokens);
+    }
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+ValueType GspnNextStateGenerator<ValueType, StateType>::getRate(TransitionInformation const& transition, CompressedState const& marking) const {
+    if (!transition.scaleByEnablingDegree) {
+        return transition.weightOrRate;
+    }
+    uint64_t enablingDegree = transition.numberOfServers > 0 ? transition.numberOfServers : std::numeric_limits<uint64_t>::max();
+    for (auto const& arc : transition.inputArcs) {
+        enablingDegree = std::min<uint64_t>(enablingDegree, marking.getAsInt(arc.bitOffset, arc.bitWidth) / arc.value);
+    }
+    return transition.weightOrRate * storm::utility::convertNumber<ValueType, uint64_t>(enablingDegree);
+}
+
+template<typename ValueType, typename StateType>
+StateBehavior<ValueType, StateType> GspnNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+    StateBehavior<ValueType, StateType> result;
+
+    // If a terminal expression was set and we must not expand this state, return now.
+    for (auto const& expressionBool : this->terminalStates) {
+        if (this->evaluator->asBool(expressionBool.first) == expressionBool.second) {
+            return result;
+        }
+    }
+    result.setExpanded();
+
+    CompressedState const& marking = *this->state;
+    updateEnabledTransitions(marking);
+
+    // Each partition of the highest priority with an enabled transition yields a probabilistic choice.
+    bool immediateTransitionEnabled = false;
+    uint64_t enabledPriority = 0;
+    for (auto const& partition : partitions) {
+        if (immediateTransitionEnabled && partition.priority < enabledPriority) {
+            break;
+        }
+        ValueType totalWeight = storm::utility::zero<ValueType>();
+        bool partitionEnabled = false;
+        for (auto const& transition : partition.transitions) {
+            if (enabledTransitions.get(transition)) {
+                partitionEnabled = true;
+                totalWeight += transitions[transition].weightOrRate;
+            }
+        }
+        if (!partitionEnabled) {
+            continue;
+        }
+        STORM_LOG_THROW(!storm::utility::isZero(totalWeight), storm::exceptions::InvalidModelException,
+                        "The enabled immediate transitions of priority " << partition.priority << " have total weight zero.");
+        immediateTransitionEnabled = true;
+        enabledPriority = partition.priority;
+
+        Choice<ValueType> choice;
+        for (auto const& transition : partition.transitions) {
+            if (enabledTransitions.get(transition) && !storm::utility::isZero(transitions[transition].weightOrRate)) {
+                choice.addProbability(stateToIdCallback(fire(transitions[transition], marking)), transitions[transition].weightOrRate / totalWeight);
+            }
+        }
+        result.addChoice(std::move(choice));
+    }
+
+    // All enabled timed transitions together yield one Markovian choice.
+    if (!immediateTransitionEnabled || !this->options.isApplyMaximalProgressAssumptionSet()) {
+        Choice<ValueType> choice(0, true);
+        uint64_t numberOfEnabledTimedTransitions = 0;
+        for (uint64_t transition = enabledTransitions.getNextSetIndex(numberOfImmediateTransitions); transition < transitions.size();
+             transition = enabledTransitions.getNextSetIndex(transition + 1)) {
+            ++numberOfEnabledTimedTransitions;
+            choice.addProbability(stateToIdCallback(fire(transitions[transition], marking)), getRate(transitions[transition], marking));
+        }
+        if (numberOfEnabledTimedTransitions > 0) {
+            if (numberOfEnabledTimedTransitions > 1 && this->isDeterministicModel() && this->options.isAddOverlappingGuardLabelSet()) {
+                this->overlappingGuardStates->push_back(stateToIdCallback(marking));
+            }
+            result.addChoice(std::move(choice));
+        }
+    }
+
+    this->postprocess(result);
+    return result;
+}
+
+template<typename ValueType, typename StateType>
+std::size_t GspnNextStateGenerator<ValueType, StateType>::getNumberOfRewardModels() const {
+    return 0;
+}
+
+template<typename ValueType, typename StateType>
+storm::builder::RewardModelInformation GspnNextStateGenerator<ValueType, StateType>::getRewardModelInformation(uint64_t const&) const {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "GSPNs do not contain reward models.");
+    return storm::builder::RewardModelInformation("", false, false, false);
+}
+
+template<typename ValueType, typename StateType>
+storm::models::sparse::StateLabeling GspnNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
+                                                                                         std::vector<StateType> const& initialStateIndices,
+                                                                                         std::vector<StateType> const& deadlockStateIndices,
+                                                                                         std::vector<StateType> const& unexploredStateIndices) {
+    // GSPNs have no labels, only the expression labels given in the options are used.
+    return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, unexploredStateIndices, {});
+}
+
+template<typename ValueType, typename StateType>
+storm::storage::BitVector GspnNextStateGenerator<ValueType, StateType>::evaluateObservationLabels(CompressedState const&) const {
+    return storm::storage::BitVector(0);
+}
+
+template class GspnNextStateGenerator<double>;
+
+#ifdef STORM_HAVE_CARL
+template class GspnNextStateGenerator<storm::RationalNumber>;
+#endif
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/generator/NextStateGenerator.h"
+
+namespace storm {
+namespace generator {
+
+/*!
+ * Next-state generator working directly on the markings of a GSPN.
+ * The semantics coincide with the JANI model obtained by the JaniGSPNBuilder, but no expressions are evaluated during the exploration.
+ *
+ * A state is the packed marking of the GSPN, i.e., the number of tokens of each place is stored in consecutive bits (ordered by place id).
+ * Each place is represented by an integer variable such that expressions over the places (e.g., for labels or terminal states) can be used.
+ * The arcs of each transition are precomputed as offsets into the packed marking. The set of enabled transitions is updated incrementally:
+ * Only transitions connected (by input or inhibition arcs) to places whose number of tokens differs from the previously expanded marking are checked.
+ */
+template<typename ValueType, typename StateType = uint32_t>
+class GspnNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
+   public:
+    typedef typename NextStateGenerator<ValueType, StateType>::StateToIdCallback StateToIdCallback;
+
+    /*!
+     * Constructor.
+     *
+     * @param gspn GSPN.
+     * @param options Options for the generation.
+     */
+    GspnNextStateGenerator(storm::gspn::GSPN const& gspn, NextStateGeneratorOptions const& options = NextStateGeneratorOptions());
+
+    virtual ModelType getModelType() const override;
+    virtual bool isDeterministicModel() const override;
+    virtual bool isDiscreteTimeModel() const override;
+    virtual bool isPartiallyObservable() const override;
+    virtual std::vector<StateType> getInitialStates(StateToIdCallback const& stateToIdCallback) override;
+
+    virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
+
+    virtual std::size_t getNumberOfRewardModels() const override;
+    virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
+
+    virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage,
+                                                       std::vector<StateType> const& initialStateIndices = {},
+                                                       std::vector<StateType> const& deadlockStateIndices = {},
+                                                       std::vector<StateType> const& unexploredStateIndices = {}) override;
+
+   protected:
+    virtual storm::storage::BitVector evaluateObservationLabels(CompressedState const& state) const override;
+
+   private:
+    // An arc between a transition and a place, given by the position of the place in the packed marking.
+    struct Arc {
+        uint64_t place;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        // Multiplicity for input and inhibition arcs, change of the number of tokens for the effect of a transition.
+        int64_t value;
+    };
+
+    // Precomputed information about a transition.
+    struct TransitionInformation {
+        std::string name;
+        // The transition requires at least the given (positive) number of tokens in these places.
+        std::vector<Arc> inputArcs;
+        // The transition requires less than the given number of tokens in these places.
+        std::vector<Arc> inhibitionArcs;
+        // The change of the number of tokens (output minus input multiplicity) of all places affected by firing the transition.
+        std::vector<Arc> effect;
+        // Weight (immediate transitions) or rate (timed transitions).
+        ValueType weightOrRate;
+        // Whether the rate is multiplied by the enabling degree (infinite-server or k-server semantics).
+        bool scaleByEnablingDegree = false;
+        // Number of servers for k-server semantics, zero for infinite-server semantics.
+        uint64_t numberOfServers = 0;
+    };
+
+    // Immediate transitions with the same priority between which the choice is probabilistic.
+    struct Partition {
+        uint64_t priority;
+        std::vector<uint64_t> transitions;
+    };
+
+    /*!
+     * Adds a transition to the precomputed transitions.
+     */
+    void addTransition(storm::gspn::Transition const& transition, ValueType const& weightOrRate);
+
+    /*!
+     * Check whether the given transition is enabled in the given marking.
+     */
+    bool isEnabled(TransitionInformation const& transition, CompressedState const& marking) const;
+
+    /*!
+     * Update the enabled transitions for the given marking.
+     * Only transitions depending on places whose number of tokens differs from the previous marking are checked.
+     */
+    void updateEnabledTransitions(CompressedState const& marking);
+
+    /*!
+     * Compute the marking obtained by firing the given (enabled) transition.
+     */
+    CompressedState fire(TransitionInformation const& transition, CompressedState const& marking) const;
+
+    /*!
+     * Compute the rate of the given (enabled) timed transition in the given marking.
+     */
+    ValueType getRate(TransitionInformation const& transition, CompressedState const& marking) const;
+
+    // The GSPN.
+    storm::gspn::GSPN const& gspn;
+
+    // The type of the generated model.
+    ModelType modelType;
+
+    // All transitions which can fire, immediate transitions come first.
+    std::vector<TransitionInformation> transitions;
+
+    // Number of immediate transitions in the transitions vector.
+    uint64_t numberOfImmediateTransitions = 0;
+
+    // Partitions of the immediate transitions ordered by decreasing priority.
+    std::vector<Partition> partitions;
+
+    // For each place, the transitions whose enabledness depends on the place.
+    std::vector<std::vector<uint64_t>> placeToTransitions;
+
+    // For each bit of the packed marking, the corresponding place.
+    std::vector<uint64_t> bitToPlace;
+
+    // The enabled transitions in the last expanded marking.
+    storm::storage::BitVector enabledTransitions;
+
+    // The last expanded marking.
+    CompressedState lastMarking;
+
+    // Flag for each transition whose enabledness was already checked for the current marking.
+    storm::storage::BitVector checkedTransitions;
+};
+
+}  // namespace generator
+}  // namespace storm
@@ -10,7 +10,7 @@ namespace modelchecker {
 template<typename SparseModelType, typename ConstantType>
 SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseCtmcInstantiationModelChecker(SparseModelType const& parametricModel)
     : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
-    // Intentionally left empty
+    modelInstantiator.setUseCompiledEvaluation(true);
 }
 
 template<typename SparseModelType, typename ConstantType>
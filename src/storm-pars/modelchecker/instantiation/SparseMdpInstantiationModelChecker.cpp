@@ -18,7 +18,7 @@ template<typename SparseModelType, typename ConstantType>
 SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::SparseMdpInstantiationModelChecker(SparseModelType const& parametricModel,
                                                                                                       bool produceScheduler)
     : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel), produceScheduler(produceScheduler) {
-    // Intentionally left empty
+    modelInstantiator.setUseCompiledEvaluation(true);
 }
 
 template<typename SparseModelType, typename ConstantType>
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
 #include <queue>
 #include <sstream>
 #include <vector>
@@ -13,6 +16,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/threads.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -92,32 +96,24 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
         displayedProgress = storm::utility::zero<CoefficientType>();
     }
 
-    // NORMAL WHILE LOOP
-    uint64_t currentDepth = refinementDepths.front();
-    while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
-        assert(unprocessedRegions.size() == refinementDepths.size());
-        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
-                                            << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-        auto& currentRegion = unprocessedRegions.front().first;
-        auto& res = unprocessedRegions.front().second;
-        std::shared_ptr<storm::analysis::Order> order;
-        std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult;
-        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
-
+    // Updates the coverage for an analyzed region and either adds it to the result or enqueues its subregions.
+    auto processAnalyzedRegion = [&](std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>&& analyzedRegion, uint64_t depth) {
+        auto const& currentRegion = analyzedRegion.first;
+        auto const& res = analyzedRegion.second;
         switch (res) {
             case RegionResult::AllSat:
                 fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
                 fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                result.push_back(std::move(unprocessedRegions.front()));
+                result.push_back(std::move(analyzedRegion));
                 break;
             case RegionResult::AllViolated:
                 fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
                 fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                result.push_back(std::move(unprocessedRegions.front()));
+                result.push_back(std::move(analyzedRegion));
                 break;
             default:
                 // Split the region as long as the desired refinement depth is not reached.
-                if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                if (!depthThreshold || depth < depthThreshold.get()) {
                     std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
                     RegionResult initResForNewRegions = (res == RegionResult::CenterSat)
                                                             ? RegionResult::ExistsSat
@@ -126,25 +122,97 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
                     currentRegion.split(currentRegion.getCenterPoint(), newRegions);
                     for (auto& newRegion : newRegions) {
                         unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                        refinementDepths.push(currentDepth + 1);
+                        refinementDepths.push(depth + 1);
                     }
 
                 } else {
                     // If the region is not further refined, it is still added to the result
-                    result.push_back(std::move(unprocessedRegions.front()));
+                    result.push_back(std::move(analyzedRegion));
                 }
                 break;
         }
         ++numOfAnalyzedRegions;
-        unprocessedRegions.pop();
-        refinementDepths.pop();
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
             while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                 STORM_PRINT_AND_LOG("#");
                 displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
             }
         }
-        currentDepth = refinementDepths.front();
+    };
+
+    // CONCURRENT WHILE LOOP
+    // Every thread analyzes regions with its own region model checker. Retrieving regions and processing the results is done under a common lock.
+    if (numberOfThreads > 1 && !useMonotonicity) {
+        std::vector<std::unique_ptr<RegionModelChecker<ParametricType>>> additionalCheckers;
+        while (additionalCheckers.size() + 1 < numberOfThreads) {
+            auto checker = createIndependentCopy(env);
+            if (!checker) {
+                STORM_LOG_WARN("Regions can not be analyzed concurrently with this region model checker.");
+                break;
+            }
+            additionalCheckers.push_back(std::move(checker));
+        }
+        // The lazy initializations of the checkers access the shared parametric model and are therefore done before the threads start.
+        this->prepareConcurrentAnalysis();
+        for (auto& checker : additionalCheckers) {
+            checker->prepareConcurrentAnalysis();
+        }
+
+        std::mutex mutex;
+        std::condition_variable regionsChanged;
+        uint64_t numberOfRegionsInAnalysis = 0;
+        bool abort = false;
+        auto isDone = [&]() {
+            return abort || fractionOfUndiscoveredArea <= thresholdAsCoefficient || (unprocessedRegions.empty() && numberOfRegionsInAnalysis == 0);
+        };
+        uint64_t const numberOfCheckers = additionalCheckers.size() + 1;
+        storm::utility::processInParallel(0, numberOfCheckers, numberOfCheckers, [&](uint64_t thread, uint64_t, uint64_t) {
+            RegionModelChecker<ParametricType>& checker = thread == 0 ? *this : *additionalCheckers[thread - 1];
+            std::unique_lock<std::mutex> lock(mutex);
+            try {
+                while (true) {
+                    regionsChanged.wait(lock, [&]() { return isDone() || !unprocessedRegions.empty(); });
+                    if (isDone()) {
+                        break;
+                    }
+                    auto currentRegion = std::move(unprocessedRegions.front());
+                    uint64_t depth = refinementDepths.front();
+                    unprocessedRegions.pop();
+                    refinementDepths.pop();
+                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions + numberOfRegionsInAnalysis << " (Refinement depth " << depth << "; "
+                                                        << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                    ++numberOfRegionsInAnalysis;
+                    lock.unlock();
+                    currentRegion.second = checker.analyzeRegion(env, currentRegion.first, hypothesis, currentRegion.second, false);
+                    lock.lock();
+                    --numberOfRegionsInAnalysis;
+                    processAnalyzedRegion(std::move(currentRegion), depth);
+                    regionsChanged.notify_all();
+                }
+            } catch (...) {
+                if (!lock.owns_lock()) {
+                    lock.lock();
+                }
+                abort = true;
+                regionsChanged.notify_all();
+                throw;
+            }
+        });
+    }
+
+    // NORMAL WHILE LOOP
+    uint64_t currentDepth = unprocessedRegions.empty() ? 0 : refinementDepths.front();
+    while ((!useMonotonicity || currentDepth < monThresh) && fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
+        assert(unprocessedRegions.size() == refinementDepths.size());
+        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; "
+                                            << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+        auto& currentRegion = unprocessedRegions.front().first;
+        auto& res = unprocessedRegions.front().second;
+        res = analyzeRegion(env, currentRegion, hypothesis, res, false);
+        processAnalyzedRegion(std::move(unprocessedRegions.front()), currentDepth);
+        unprocessedRegions.pop();
+        refinementDepths.pop();
+        currentDepth = unprocessedRegions.empty() ? 0 : refinementDepths.front();
     }
 
     // FIFO queues for the order and local monotonicity results
@@ -437,6 +505,55 @@ void RegionModelChecker<ParametricType>::setMonotoneParameters(std::pair<std::se
     monotoneDecrParameters = std::move(monotoneParameters.second);
 }
 
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = std::max<uint64_t>(value, 1);
+}
+
+template<typename ParametricType>
+uint64_t RegionModelChecker<ParametricType>::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::storeSpecification(std::shared_ptr<storm::models::ModelBase> parametricModel,
+                                                            CheckTask<storm::logic::Formula, ParametricType> const& checkTask,
+                                                            bool generateRegionSplitEstimates, bool allowModelSimplifications) {
+    specifiedModel = std::move(parametricModel);
+    // The check task only refers to its formula, so we keep the formula alive ourselves.
+    specifiedFormula = checkTask.getFormula().asSharedPointer();
+    specifiedCheckTask = std::make_unique<CheckTask<storm::logic::Formula, ParametricType>>(checkTask.substituteFormula(*specifiedFormula));
+    specifiedGenerateRegionSplitEstimates = generateRegionSplitEstimates;
+    specifiedAllowModelSimplifications = allowModelSimplifications;
+}
+
+template<typename ParametricType>
+std::unique_ptr<RegionModelChecker<ParametricType>> RegionModelChecker<ParametricType>::createUnspecifiedCopy() const {
+    return nullptr;
+}
+
+template<typename ParametricType>
+std::unique_ptr<RegionModelChecker<ParametricType>> RegionModelChecker<ParametricType>::createIndependentCopy(Environment const& env) const {
+    if (!specifiedCheckTask) {
+        return nullptr;
+    }
+    auto result = createUnspecifiedCopy();
+    if (result) {
+        result->setUseMonotonicity(useMonotonicity);
+        result->setUseOnlyGlobal(useOnlyGlobal);
+        result->setUseBounds(useBounds);
+        result->monotoneIncrParameters = monotoneIncrParameters;
+        result->monotoneDecrParameters = monotoneDecrParameters;
+        result->specify(env, specifiedModel, *specifiedCheckTask, specifiedGenerateRegionSplitEstimates, specifiedAllowModelSimplifications);
+    }
+    return result;
+}
+
+template<typename ParametricType>
+void RegionModelChecker<ParametricType>::prepareConcurrentAnalysis() {
+    // Intentionally left empty
+}
+
 #ifdef STORM_HAVE_CARL
 template class RegionModelChecker<storm::RationalFunction>;
 #endif
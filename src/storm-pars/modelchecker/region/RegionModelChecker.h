@@ -62,6 +62,7 @@ class RegionModelChecker {
 
     /*!
      * Iteratively refines the region until the region analysis yields a conclusive result (AllSat or AllViolated).
+     * If more than one thread is set (see setNumberOfThreads), regions are analyzed concurrently unless monotonicity is used.
      * @param region the considered region
      * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this
      * threshold
@@ -137,10 +138,39 @@ class RegionModelChecker {
                                          std::set<typename storm::storage::ParameterRegion<ParametricType>::VariableType>>
                                    monotoneParameters);
 
+    /*!
+     * Sets the number of threads that analyze regions during region refinement.
+     * Each additional thread uses its own region model checker obtained via createIndependentCopy.
+     */
+    void setNumberOfThreads(uint64_t value);
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Creates a region model checker that is specified for the same model and check task as this one but that does not share any state with this one.
+     * In particular, it uses its own parameter lifter and solvers such that both region model checkers can analyze regions concurrently.
+     * @return the copy or nullptr if this region model checker can not be copied (e.g., because it has not been specified yet).
+     */
+    std::unique_ptr<RegionModelChecker<ParametricType>> createIndependentCopy(Environment const& env) const;
+
+    /*!
+     * Performs the initializations that analyzeRegion would otherwise perform lazily on its first call.
+     * This has to be called before regions are analyzed concurrently, as these initializations access the parametric model that is shared among
+     * independent copies.
+     */
+    virtual void prepareConcurrentAnalysis();
+
    private:
     bool useMonotonicity = false;
     bool useOnlyGlobal = false;
     bool useBounds = false;
+    uint64_t numberOfThreads = 1;
+
+    // The arguments of the most recent call to specify (used to create independent copies).
+    std::shared_ptr<storm::models::ModelBase> specifiedModel;
+    std::shared_ptr<storm::logic::Formula const> specifiedFormula;
+    std::unique_ptr<CheckTask<storm::logic::Formula, ParametricType>> specifiedCheckTask;
+    bool specifiedGenerateRegionSplitEstimates = false;
+    bool specifiedAllowModelSimplifications = true;
 
    protected:
     uint_fast64_t numberOfRegionsKnownThroughMonotonicity;
@@ -152,6 +182,19 @@ class RegionModelChecker {
 
     virtual void splitSmart(storm::storage::ParameterRegion<ParametricType>& region, std::vector<storm::storage::ParameterRegion<ParametricType>>& regionVector,
                             storm::analysis::MonotonicityResult<VariableType>& monRes, bool splitForExtremum) const;
+
+    /*!
+     * Remembers the arguments of specify such that independent copies of this region model checker can be created.
+     * Implementations of specify should call this.
+     */
+    void storeSpecification(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask,
+                            bool generateRegionSplitEstimates, bool allowModelSimplifications);
+
+    /*!
+     * Creates a region model checker of the same type as this one that has not been specified yet.
+     * @return the new region model checker or nullptr if this is not supported.
+     */
+    virtual std::unique_ptr<RegionModelChecker<ParametricType>> createUnspecifiedCopy() const;
 };
 
 }  // namespace modelchecker
@@ -66,11 +66,19 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
                                                                                     std::shared_ptr<storm::models::ModelBase> parametricModel,
                                                                                     CheckTask<storm::logic::Formula, ValueType> const& checkTask,
                                                                                     bool generateRegionSplitEstimates, bool allowModelSimplification) {
+    this->storeSpecification(parametricModel, checkTask, generateRegionSplitEstimates, allowModelSimplification);
     auto dtmc = parametricModel->template as<SparseModelType>();
     monotonicityChecker = std::make_unique<storm::analysis::MonotonicityChecker<ValueType>>(dtmc->getTransitionMatrix());
     specify_internal(env, dtmc, checkTask, generateRegionSplitEstimates, !allowModelSimplification);
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>>
+SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::createUnspecifiedCopy() const {
+    // The copy uses the default solver factory.
+    return std::make_unique<SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::specify_internal(Environment const& env,
                                                                                              std::shared_ptr<SparseModelType> parametricModel,
@@ -286,6 +294,16 @@ void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::spec
     solverFactory->setRequirementsChecked(true);
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis() {
+    SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis();
+    getInstantiationCheckerSAT();
+    getInstantiationCheckerVIO();
+    if (parameterLifter) {
+        parameterLifter->setUseCompiledEvaluation(true);
+    }
+}
+
 template<typename SparseModelType, typename ConstantType>
 storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>&
 SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationCheckerSAT() {
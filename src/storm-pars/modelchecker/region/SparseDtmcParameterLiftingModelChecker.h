@@ -52,6 +52,12 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
     void setMaxSplitDimensions(uint64_t) override;
     void resetMaxSplitDimensions() override;
 
+    /*!
+     * Additionally creates the remaining instantiation checkers and lets the parameter lifter evaluate its functions without accessing the shared
+     * rational functions.
+     */
+    virtual void prepareConcurrentAnalysis() override;
+
    protected:
     virtual void specifyBoundedUntilFormula(const CheckTask<storm::logic::BoundedUntilFormula, ConstantType>& checkTask) override;
     virtual void specifyUntilFormula(Environment const& env, CheckTask<storm::logic::UntilFormula, ConstantType> const& checkTask) override;
@@ -71,6 +77,8 @@ class SparseDtmcParameterLiftingModelChecker : public SparseParameterLiftingMode
 
     virtual void reset() override;
 
+    virtual std::unique_ptr<RegionModelChecker<ValueType>> createUnspecifiedCopy() const override;
+
     virtual void splitSmart(storm::storage::ParameterRegion<ValueType>& region, std::vector<storm::storage::ParameterRegion<ValueType>>& regionVector,
                             storm::analysis::MonotonicityResult<VariableType>& monRes, bool splitForExtremum) const override;
 
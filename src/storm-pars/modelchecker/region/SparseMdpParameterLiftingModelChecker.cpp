@@ -59,10 +59,18 @@ template<typename SparseModelType, typename ConstantType>
 void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::specify(
     Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel,
     CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplifications) {
+    this->storeSpecification(parametricModel, checkTask, generateRegionSplitEstimates, allowModelSimplifications);
     auto mdp = parametricModel->template as<SparseModelType>();
     specify_internal(env, mdp, checkTask, !allowModelSimplifications);
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>>
+SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::createUnspecifiedCopy() const {
+    // The copy uses the default solver factory.
+    return std::make_unique<SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::specify_internal(
     Environment const& env, std::shared_ptr<SparseModelType> parametricModel,
@@ -289,6 +297,14 @@ void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::speci
     lowerResultBound = storm::utility::zero<ConstantType>();
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis() {
+    SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis();
+    if (parameterLifter) {
+        parameterLifter->setUseCompiledEvaluation(true);
+    }
+}
+
 template<typename SparseModelType, typename ConstantType>
 storm::modelchecker::SparseInstantiationModelChecker<SparseModelType, ConstantType>&
 SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationChecker() {
@@ -36,7 +36,14 @@ class SparseMdpParameterLiftingModelChecker : public SparseParameterLiftingModel
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentMaxScheduler();
     boost::optional<storm::storage::Scheduler<ConstantType>> getCurrentPlayer1Scheduler();
 
+    /*!
+     * Additionally lets the parameter lifter evaluate its functions without accessing the shared rational functions.
+     */
+    virtual void prepareConcurrentAnalysis() override;
+
    protected:
+    virtual std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> createUnspecifiedCopy() const override;
+
     virtual void specifyBoundedUntilFormula(const CheckTask<storm::logic::BoundedUntilFormula, ConstantType>& checkTask) override;
     virtual void specifyUntilFormula(Environment const& env, CheckTask<storm::logic::UntilFormula, ConstantType> const& checkTask) override;
     virtual void specifyReachabilityRewardFormula(Environment const& env, CheckTask<storm::logic::EventuallyFormula, ConstantType> const& checkTask) override;
@@ -172,6 +172,11 @@ RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::
     return result;
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::prepareConcurrentAnalysis() {
+    getInstantiationChecker();
+}
+
 template<typename SparseModelType, typename ConstantType>
 RegionResult SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::sampleVertices(
     Environment const& env, storm::storage::ParameterRegion<typename SparseModelType::ValueType> const& region, RegionResult const& initialResult) {
@@ -38,6 +38,11 @@ class SparseParameterLiftingModelChecker : public RegionModelChecker<typename Sp
         std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>>
             localMonotonicityResult = nullptr) override;
 
+    /*!
+     * Creates the instantiation checker (which is otherwise created when analyzing the first region).
+     */
+    virtual void prepareConcurrentAnalysis() override;
+
     /*!
      * Analyzes the 2^#parameters corner points of the given region.
      */
@@ -19,6 +19,7 @@ void ValidatingSparseDtmcParameterLiftingModelChecker<SparseModelType, Imprecise
     Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel,
     CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplifications) {
     STORM_LOG_ASSERT(this->canHandle(parametricModel, checkTask), "specified model and formula can not be handled by this.");
+    this->storeSpecification(parametricModel, checkTask, generateRegionSplitEstimates, allowModelSimplifications);
 
     auto dtmc = parametricModel->template as<SparseModelType>();
     auto simplifier = storm::transformer::SparseParametricDtmcSimplifier<SparseModelType>(*dtmc);
@@ -33,6 +34,12 @@ void ValidatingSparseDtmcParameterLiftingModelChecker<SparseModelType, Imprecise
     preciseChecker.specify(env, simplifier.getSimplifiedModel(), simplifiedTask, false, true);
 }
 
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>>
+ValidatingSparseDtmcParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::createUnspecifiedCopy() const {
+    return std::make_unique<ValidatingSparseDtmcParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>>();
+}
+
 template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
 SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>&
 ValidatingSparseDtmcParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::getImpreciseChecker() {
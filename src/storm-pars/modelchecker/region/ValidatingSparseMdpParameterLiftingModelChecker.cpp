@@ -19,6 +19,7 @@ void ValidatingSparseMdpParameterLiftingModelChecker<SparseModelType, ImpreciseT
     Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel,
     CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplifications) {
     STORM_LOG_ASSERT(this->canHandle(parametricModel, checkTask), "specified model and formula can not be handled by this.");
+    this->storeSpecification(parametricModel, checkTask, generateRegionSplitEstimates, allowModelSimplifications);
 
     auto mdp = parametricModel->template as<SparseModelType>();
     auto simplifier = storm::transformer::SparseParametricMdpSimplifier<SparseModelType>(*mdp);
@@ -33,6 +34,12 @@ void ValidatingSparseMdpParameterLiftingModelChecker<SparseModelType, ImpreciseT
     preciseChecker.specify(env, simplifier.getSimplifiedModel(), simplifiedTask, false, true);
 }
 
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>>
+ValidatingSparseMdpParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::createUnspecifiedCopy() const {
+    return std::make_unique<ValidatingSparseMdpParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>>();
+}
+
 template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
 SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>&
 ValidatingSparseMdpParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::getImpreciseChecker() {
@@ -17,6 +17,8 @@ class ValidatingSparseMdpParameterLiftingModelChecker : public ValidatingSparseP
                          bool allowModelSimplifications = true) override;
 
    protected:
+    virtual std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> createUnspecifiedCopy() const override;
+
     virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>& getImpreciseChecker() override;
     virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType> const& getImpreciseChecker() const override;
     virtual SparseParameterLiftingModelChecker<SparseModelType, PreciseType>& getPreciseChecker() override;
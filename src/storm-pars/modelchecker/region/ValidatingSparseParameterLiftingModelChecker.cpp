@@ -77,6 +77,12 @@ RegionResult ValidatingSparseParameterLiftingModelChecker<SparseModelType, Impre
     return currentResult;
 }
 
+template<typename SparseModelType, typename ImpreciseType, typename PreciseType>
+void ValidatingSparseParameterLiftingModelChecker<SparseModelType, ImpreciseType, PreciseType>::prepareConcurrentAnalysis() {
+    getImpreciseChecker().prepareConcurrentAnalysis();
+    getPreciseChecker().prepareConcurrentAnalysis();
+}
+
 template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double, storm::RationalNumber>;
 template class ValidatingSparseParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double, storm::RationalNumber>;
 
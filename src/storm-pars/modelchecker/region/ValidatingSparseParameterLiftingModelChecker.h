@@ -31,6 +31,8 @@ class ValidatingSparseParameterLiftingModelChecker : public RegionModelChecker<t
         std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<typename SparseModelType::ValueType>::VariableType>>
             localMonotonicityResult = nullptr) override;
 
+    virtual void prepareConcurrentAnalysis() override;
+
    protected:
     virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType>& getImpreciseChecker() = 0;
     virtual SparseParameterLiftingModelChecker<SparseModelType, ImpreciseType> const& getImpreciseChecker() const = 0;
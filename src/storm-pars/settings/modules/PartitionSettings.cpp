@@ -4,6 +4,7 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
+#include "storm/utility/threads.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 
@@ -13,6 +14,7 @@ const std::string PartitionSettings::moduleName = "partitioning";
 const std::string requestedCoverageOptionName = "terminationCondition";
 const std::string printNoIllustrationOptionName = "noillustration";
 const std::string printFullResultOptionName = "printfullresult";
+const std::string threadsOptionName = "threads";
 
 PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, requestedCoverageOptionName, false, "The requested coverage")
@@ -31,6 +33,13 @@ PartitionSettings::PartitionSettings() : ModuleSettings(moduleName) {
         storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "The number of threads used for analyzing regions concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 double PartitionSettings::getCoverageThreshold() const {
@@ -50,6 +59,11 @@ bool PartitionSettings::isPrintFullResultSet() const {
     return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
 }
 
+uint64_t PartitionSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
 uint64_t PartitionSettings::getDepthLimit() const {
     int64_t depth = this->getOption(requestedCoverageOptionName).getArgumentByName("depth-limit").getValueAsInteger();
     STORM_LOG_THROW(depth >= 0, storm::exceptions::InvalidOperationException, "Tried to retrieve the depth limit but it was not set.");
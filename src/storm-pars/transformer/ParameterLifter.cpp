@@ -1,5 +1,8 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -174,6 +177,11 @@ void ParameterLifter<ParametricType, ConstantType>::specifyRegion(storm::storage
     }
 }
 
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::setUseCompiledEvaluation(bool value) {
+    functionValuationCollector.setUseCompiledEvaluation(value);
+}
+
 template<typename ParametricType, typename ConstantType>
 uint_fast64_t ParameterLifter<ParametricType, ConstantType>::getRowGroupIndex(uint_fast64_t originalState) const {
     return matrix.getRowGroupIndices()[oldToNewColumnIndexMapping[originalState]];
@@ -346,9 +354,46 @@ ConstantType& ParameterLifter<ParametricType, ConstantType>::FunctionValuationCo
     return insertionRes.first->second;
 }
 
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::setUseCompiledEvaluation(bool value) {
+    if (value && valuationGroups.empty()) {
+        compileCollectedFunctions();
+    }
+    useCompiledEvaluation = value;
+}
+
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::compileCollectedFunctions() {
+    struct AbstractValuationHash {
+        std::size_t operator()(AbstractValuation const& valuation) const {
+            return valuation.getHashValue();
+        }
+    };
+    std::unordered_map<AbstractValuation, uint64_t, AbstractValuationHash> valuationToGroup;
+    std::vector<std::vector<ParametricType>> functionsOfGroups;
+    valuationGroups.clear();
+    for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
+        AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
+        auto groupIt = valuationToGroup.emplace(abstrValuation, valuationGroups.size()).first;
+        if (groupIt->second == valuationGroups.size()) {
+            valuationGroups.push_back({abstrValuation, nullptr, {}});
+            functionsOfGroups.emplace_back();
+        }
+        functionsOfGroups[groupIt->second].push_back(collectedFunctionValuationPlaceholder.first.first);
+        valuationGroups[groupIt->second].placeholders.push_back(&collectedFunctionValuationPlaceholder.second);
+    }
+    for (uint64_t group = 0; group < valuationGroups.size(); ++group) {
+        valuationGroups[group].functions = std::make_unique<storm::utility::CompiledRationalFunctions<ConstantType>>(functionsOfGroups[group]);
+    }
+}
+
 template<typename ParametricType, typename ConstantType>
 void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCollectedFunctions(
     storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+    if (useCompiledEvaluation) {
+        evaluateCompiledFunctions(region, dirForUnspecifiedParameters);
+        return;
+    }
     for (auto& collectedFunctionValuationPlaceholder : collectedFunctions) {
         ParametricType const& function = collectedFunctionValuationPlaceholder.first.first;
         AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
@@ -367,6 +412,51 @@ void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::
     }
 }
 
+template<typename ParametricType, typename ConstantType>
+void ParameterLifter<ParametricType, ConstantType>::FunctionValuationCollector::evaluateCompiledFunctions(
+    storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForUnspecifiedParameters) {
+    for (auto& group : valuationGroups) {
+        // The functions are evaluated at all vertices of the region w.r.t. the unspecified parameters, i.e., the i-th vertex sets the j-th
+        // unspecified parameter to its upper bound iff the j-th bit of i is set.
+        std::vector<VariableType> const unspecifiedPars(group.valuation.getUnspecifiedParameters().begin(),
+                                                        group.valuation.getUnspecifiedParameters().end());
+        uint64_t const numberOfVertices = 1ull << unspecifiedPars.size();
+        auto const& variables = group.functions->getVariables();
+        variableValues.resize(variables.size() * numberOfVertices);
+        for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+            auto const& variable = variables[variableIndex];
+            ConstantType const lower = storm::utility::convertNumber<ConstantType>(region.getLowerBoundary(variable));
+            ConstantType const upper = storm::utility::convertNumber<ConstantType>(region.getUpperBoundary(variable));
+            auto valueIt = variableValues.begin() + variableIndex * numberOfVertices;
+            if (group.valuation.getLowerParameters().count(variable) > 0) {
+                std::fill(valueIt, valueIt + numberOfVertices, lower);
+            } else if (group.valuation.getUpperParameters().count(variable) > 0) {
+                std::fill(valueIt, valueIt + numberOfVertices, upper);
+            } else {
+                uint64_t const bit = std::distance(unspecifiedPars.begin(), std::find(unspecifiedPars.begin(), unspecifiedPars.end(), variable));
+                STORM_LOG_ASSERT(bit < unspecifiedPars.size(), "The valuation does not consider the variable " << variable << ".");
+                for (uint64_t vertex = 0; vertex < numberOfVertices; ++vertex, ++valueIt) {
+                    *valueIt = ((vertex >> bit) & 1) ? upper : lower;
+                }
+            }
+        }
+
+        group.functions->evaluate(variableValues, numberOfVertices, functionValues);
+        for (uint64_t function = 0; function < group.placeholders.size(); ++function) {
+            auto resultIt = functionValues.begin() + function * numberOfVertices;
+            ConstantType& placeholder = *group.placeholders[function];
+            placeholder = *resultIt;
+            for (++resultIt; resultIt != functionValues.begin() + (function + 1) * numberOfVertices; ++resultIt) {
+                if (storm::solver::minimize(dirForUnspecifiedParameters)) {
+                    placeholder = std::min(placeholder, *resultIt);
+                } else {
+                    placeholder = std::max(placeholder, *resultIt);
+                }
+            }
+        }
+    }
+}
+
 template class ParameterLifter<storm::RationalFunction, double>;
 template class ParameterLifter<storm::RationalFunction, storm::RationalNumber>;
 }  // namespace transformer
@@ -7,6 +7,7 @@
 
 #include "storm-pars/analysis/Order.h"
 #include "storm-pars/storage/ParameterRegion.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/storage/BitVector.h"
@@ -67,6 +68,14 @@ class ParameterLifter {
                        std::shared_ptr<storm::analysis::Order> reachabilityOrder,
                        std::shared_ptr<storm::analysis::LocalMonotonicityResult<VariableType>> localMonotonicityResult);
 
+    /*!
+     * Sets whether the occurring functions are compiled into a numeric evaluation program instead of evaluating them with carl when a region is
+     * specified. The compiled evaluation does not access the rational functions, which are shared among all lifters created from the same model.
+     * It is therefore required if such lifters specify regions concurrently. For floating point numbers, the results might differ due to rounding
+     * errors, as the evaluation is then performed in floating point arithmetic.
+     */
+    void setUseCompiledEvaluation(bool value);
+
     // Returns the resulting matrix. Should only be called AFTER specifying a region
     storm::storage::SparseMatrix<ConstantType> const& getMatrix() const;
 
@@ -127,6 +136,8 @@ class ParameterLifter {
      * Collects all occurring pairs of functions and (abstract) valuations.
      * We also store a placeholder for the result of each pair. The result is computed and written into the placeholder whenever a region and optimization
      * direction is specified.
+     * If compiled evaluation is enabled, the functions are compiled (grouped by their valuation) such that no rational functions need to be
+     * evaluated when specifying a region.
      */
     class FunctionValuationCollector {
        public:
@@ -138,10 +149,20 @@ class ParameterLifter {
          */
         ConstantType& add(ParametricType const& function, AbstractValuation const& valuation);
 
+        /*!
+         * Sets whether the collected functions are evaluated with their compiled version. Compiles the collected functions if necessary, i.e.,
+         * no more functions may be added afterwards.
+         */
+        void setUseCompiledEvaluation(bool value);
+
         void evaluateCollectedFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
                                         storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
 
        private:
+        void compileCollectedFunctions();
+        void evaluateCompiledFunctions(storm::storage::ParameterRegion<ParametricType> const& region,
+                                       storm::solver::OptimizationDirection const& dirForUnspecifiedParameters);
+
         // Stores a function and a valuation. The valuation is stored as an index of the collectedValuations-vector.
         typedef std::pair<ParametricType, AbstractValuation> FunctionValuation;
 
@@ -157,6 +178,19 @@ class ParameterLifter {
 
         // Stores the collected functions with the valuations together with a placeholder for the result.
         std::unordered_map<FunctionValuation, ConstantType, FuncValHash> collectedFunctions;
+
+        // The collected functions that share the same abstract valuation, compiled for evaluation.
+        struct ValuationGroup {
+            AbstractValuation valuation;
+            std::unique_ptr<storm::utility::CompiledRationalFunctions<ConstantType>> functions;
+            std::vector<ConstantType*> placeholders;
+        };
+        std::vector<ValuationGroup> valuationGroups;
+        bool useCompiledEvaluation = false;
+
+        // Storage for intermediate results that is reused among evaluations.
+        std::vector<ConstantType> variableValues;
+        std::vector<ConstantType> functionValues;
     };
 
     FunctionValuationCollector functionValuationCollector;
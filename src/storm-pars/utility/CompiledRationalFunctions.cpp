@@ -0,0 +1,179 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+template<typename ValueType>
+CompiledRationalFunctions<ValueType>::CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions) {
+    std::set<storm::RationalFunctionVariable> variableSet;
+    for (auto const& function : functions) {
+        function.gatherVariables(variableSet);
+    }
+    variables.assign(variableSet.begin(), variableSet.end());
+    for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+        variableToIndex.emplace(variables[variableIndex], variableIndex);
+    }
+    monomialToIndex.emplace(MonomialKey(), 0);
+
+    functionTermIndices.reserve(2 * functions.size() + 1);
+    functionTermIndices.push_back(0);
+    for (auto const& function : functions) {
+        if (function.isConstant()) {
+            termCoefficients.push_back(storm::utility::convertNumber<ValueType>(function.constantPart()));
+            termMonomials.push_back(0);
+            functionTermIndices.push_back(termCoefficients.size());
+        } else {
+            auto denominator = function.denominatorAsPolynomial().polynomialWithCoefficient();
+            if (denominator.isConstant()) {
+                // Fold the denominator into the coefficients of the numerator. This is done exactly.
+                addTerms(function.nominatorAsPolynomial().polynomialWithCoefficient(),
+                         storm::utility::one<storm::RationalFunctionCoefficient>() / denominator.constantPart());
+                functionTermIndices.push_back(termCoefficients.size());
+            } else {
+                addTerms(function.nominatorAsPolynomial().polynomialWithCoefficient(), storm::utility::one<storm::RationalFunctionCoefficient>());
+                functionTermIndices.push_back(termCoefficients.size());
+                addTerms(denominator, storm::utility::one<storm::RationalFunctionCoefficient>());
+            }
+        }
+        functionTermIndices.push_back(termCoefficients.size());
+    }
+    STORM_LOG_DEBUG("Compiled " << functions.size() << " rational functions over " << variables.size() << " variables into " << getNumberOfMonomials()
+                                << " monomials and " << termCoefficients.size() << " terms.");
+}
+
+template<typename ValueType>
+uint64_t CompiledRationalFunctions<ValueType>::getNumberOfFunctions() const {
+    return (functionTermIndices.size() - 1) / 2;
+}
+
+template<typename ValueType>
+uint64_t CompiledRationalFunctions<ValueType>::getNumberOfMonomials() const {
+    return monomialInstructions.size() + 1;
+}
+
+template<typename ValueType>
+std::vector<storm::RationalFunctionVariable> const& CompiledRationalFunctions<ValueType>::getVariables() const {
+    return variables;
+}
+
+template<typename ValueType>
+void CompiledRationalFunctions<ValueType>::getVariableValues(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation,
+                                                             std::vector<ValueType>& variableValues) const {
+    variableValues.resize(variables.size());
+    for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+        auto assignmentIt = valuation.find(variables[variableIndex]);
+        STORM_LOG_THROW(assignmentIt != valuation.end(), storm::exceptions::InvalidArgumentException,
+                        "The valuation does not assign a value to the variable " << variables[variableIndex] << ".");
+        variableValues[variableIndex] = storm::utility::convertNumber<ValueType>(assignmentIt->second);
+    }
+}
+
+template<typename ValueType>
+void CompiledRationalFunctions<ValueType>::getVariableValues(
+    typename std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>>::const_iterator begin,
+    typename std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>>::const_iterator end, std::vector<ValueType>& variableValues) const {
+    uint64_t numberOfValuations = std::distance(begin, end);
+    variableValues.resize(variables.size() * numberOfValuations);
+    auto valueIt = variableValues.begin();
+    for (auto const& variable : variables) {
+        for (auto valuationIt = begin; valuationIt != end; ++valuationIt, ++valueIt) {
+            auto assignmentIt = valuationIt->find(variable);
+            STORM_LOG_THROW(assignmentIt != valuationIt->end(), storm::exceptions::InvalidArgumentException,
+                            "The valuation does not assign a value to the variable " << variable << ".");
+            *valueIt = storm::utility::convertNumber<ValueType>(assignmentIt->second);
+        }
+    }
+}
+
+template<typename ValueType>
+void CompiledRationalFunctions<ValueType>::evaluate(std::vector<ValueType> const& variableValues, uint64_t numberOfValuations, std::vector<ValueType>& result) {
+    STORM_LOG_ASSERT(variableValues.size() == variables.size() * numberOfValuations, "Unexpected number of variable values.");
+    uint64_t const n = numberOfValuations;
+
+    monomialValues.resize(getNumberOfMonomials() * n);
+    std::fill(monomialValues.begin(), monomialValues.begin() + n, storm::utility::one<ValueType>());
+    for (uint64_t monomial = 1; monomial < getNumberOfMonomials(); ++monomial) {
+        auto const& instruction = monomialInstructions[monomial - 1];
+        ValueType* target = monomialValues.data() + monomial * n;
+        ValueType const* factor = monomialValues.data() + instruction.first * n;
+        ValueType const* variableValue = variableValues.data() + instruction.second * n;
+        for (uint64_t i = 0; i < n; ++i) {
+            target[i] = factor[i] * variableValue[i];
+        }
+    }
+
+    // Sums up the given terms for all valuations.
+    auto evaluateTerms = [this, n](uint64_t termBegin, uint64_t termEnd, ValueType* target) {
+        std::fill(target, target + n, storm::utility::zero<ValueType>());
+        for (uint64_t term = termBegin; term < termEnd; ++term) {
+            ValueType const& coefficient = termCoefficients[term];
+            ValueType const* monomialValue = monomialValues.data() + termMonomials[term] * n;
+            for (uint64_t i = 0; i < n; ++i) {
+                target[i] += coefficient * monomialValue[i];
+            }
+        }
+    };
+
+    result.resize(getNumberOfFunctions() * n);
+    denominatorValues.resize(n);
+    for (uint64_t function = 0; function < getNumberOfFunctions(); ++function) {
+        ValueType* target = result.data() + function * n;
+        evaluateTerms(functionTermIndices[2 * function], functionTermIndices[2 * function + 1], target);
+        if (functionTermIndices[2 * function + 1] != functionTermIndices[2 * function + 2]) {
+            evaluateTerms(functionTermIndices[2 * function + 1], functionTermIndices[2 * function + 2], denominatorValues.data());
+            for (uint64_t i = 0; i < n; ++i) {
+                target[i] /= denominatorValues[i];
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t CompiledRationalFunctions<ValueType>::getMonomialIndex(MonomialKey const& key) {
+    auto findRes = monomialToIndex.find(key);
+    if (findRes != monomialToIndex.end()) {
+        return findRes->second;
+    }
+    // Compute the monomial by multiplying its last variable to the monomial with the exponent of that variable decreased by one.
+    MonomialKey factorKey = key;
+    if (--factorKey.back().second == 0) {
+        factorKey.pop_back();
+    }
+    uint64_t factorIndex = getMonomialIndex(factorKey);
+    monomialInstructions.emplace_back(factorIndex, key.back().first);
+    uint64_t index = monomialInstructions.size();
+    monomialToIndex.emplace(key, index);
+    return index;
+}
+
+template<typename ValueType>
+void CompiledRationalFunctions<ValueType>::addTerms(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& factor) {
+    MonomialKey key;
+    for (auto const& term : polynomial) {
+        key.clear();
+        if (!term.isConstant()) {
+            for (auto const& variableExponentPair : term.monomial()->exponents()) {
+                key.emplace_back(variableToIndex.at(variableExponentPair.first), variableExponentPair.second);
+            }
+            std::sort(key.begin(), key.end());
+        }
+        termCoefficients.push_back(storm::utility::convertNumber<ValueType>(storm::RationalFunctionCoefficient(term.coeff() * factor)));
+        termMonomials.push_back(getMonomialIndex(key));
+    }
+}
+
+#ifdef STORM_HAVE_CARL
+template class CompiledRationalFunctions<double>;
+template class CompiledRationalFunctions<storm::RationalNumber>;
+#endif
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionForward.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Compiles a collection of rational functions into a flat numeric program that evaluates all functions without calling carl.
+ *
+ * The distinct monomials of all functions are shared: Each monomial is computed only once per valuation by multiplying a previously computed
+ * monomial with a single variable. The numerator and denominator of each function are then evaluated as sums of coefficient/monomial products.
+ * Constant denominators are folded into the (exact) coefficients of the numerator.
+ *
+ * Evaluation is performed for a batch of valuations at once. All values are stored in a structure-of-arrays layout, i.e., the values of
+ * one variable (or monomial or function) for all valuations of the batch are stored consecutively. The innermost loops thus run over the
+ * valuations of the batch and can be vectorized by the compiler.
+ */
+template<typename ValueType>
+class CompiledRationalFunctions {
+   public:
+    /*!
+     * Compiles the given functions.
+     */
+    CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions);
+
+    uint64_t getNumberOfFunctions() const;
+    uint64_t getNumberOfMonomials() const;
+
+    /*!
+     * Retrieves the variables occurring in the functions. The values of the variables are expected in this order.
+     */
+    std::vector<storm::RationalFunctionVariable> const& getVariables() const;
+
+    /*!
+     * Converts the given valuation to the layout that is expected by evaluate, i.e., variableValues[v] is the value of the v-th variable.
+     */
+    void getVariableValues(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation, std::vector<ValueType>& variableValues) const;
+
+    /*!
+     * Converts the given valuations to the layout that is expected by evaluate.
+     *
+     * @param begin The first valuation of the batch.
+     * @param end The end of the batch.
+     * @param variableValues Is filled such that variableValues[v * n + i] is the value of the v-th variable in the i-th valuation, where n is the
+     * number of valuations in the batch.
+     */
+    void getVariableValues(typename std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>>::const_iterator begin,
+                           typename std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>>::const_iterator end,
+                           std::vector<ValueType>& variableValues) const;
+
+    /*!
+     * Evaluates all functions for a batch of valuations.
+     *
+     * @param variableValues The values of the variables, as obtained from getVariableValues.
+     * @param numberOfValuations The number n of valuations in the batch.
+     * @param result Is filled such that result[f * n + i] is the value of the f-th function under the i-th valuation.
+     */
+    void evaluate(std::vector<ValueType> const& variableValues, uint64_t numberOfValuations, std::vector<ValueType>& result);
+
+   private:
+    typedef std::vector<std::pair<uint64_t, uint64_t>> MonomialKey;
+
+    /*!
+     * Retrieves the index of the monomial with the given (variable index, exponent) pairs and creates the instructions to compute it, if necessary.
+     */
+    uint64_t getMonomialIndex(MonomialKey const& key);
+
+    /*!
+     * Adds the terms of the given polynomial, multiplied with the given factor.
+     */
+    void addTerms(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& factor);
+
+    std::vector<storm::RationalFunctionVariable> variables;
+    std::map<storm::RationalFunctionVariable, uint64_t> variableToIndex;
+
+    // Monomial 0 is the constant one. Monomial i > 0 is the product of the monomial monomialInstructions[i - 1].first and the variable
+    // monomialInstructions[i - 1].second. A monomial is always computed after its factor.
+    std::vector<std::pair<uint64_t, uint64_t>> monomialInstructions;
+    std::map<MonomialKey, uint64_t> monomialToIndex;
+
+    // The terms (coefficient and monomial) of all numerators and denominators.
+    std::vector<ValueType> termCoefficients;
+    std::vector<uint64_t> termMonomials;
+    // The numerator of the f-th function consists of the terms with indices in [functionTermIndices[2f], functionTermIndices[2f+1]), the denominator
+    // of the terms in [functionTermIndices[2f+1], functionTermIndices[2f+2]). An empty denominator represents the constant one.
+    std::vector<uint64_t> functionTermIndices;
+
+    // Storage for intermediate results that is reused among evaluations.
+    std::vector<ValueType> monomialValues;
+    std::vector<ValueType> denominatorValues;
+};
+
+}  // namespace utility
+}  // namespace storm
@@ -1,13 +1,18 @@
 #include "storm-pars/utility/ModelInstantiator.h"
+
+#include <algorithm>
+
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
 namespace utility {
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel) {
+ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ModelInstantiator(ParametricSparseModelType const& parametricModel)
+    : useCompiledEvaluation(false) {
     // Now pre-compute the information for the equation system.
     initializeModelSpecificData(parametricModel);
     initializeMatrixMapping(this->instantiatedModel->getTransitionMatrix(), this->functions, this->matrixMapping, parametricModel.getTransitionMatrix());
@@ -143,8 +148,73 @@ template<typename ParametricSparseModelType, typename ConstantSparseModelType>
 ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(
     storm::utility::parametric::Valuation<ParametricType> const& valuation) {
     // Write results into the placeholders
-    instantiate_helper(valuation);
+    if (useCompiledEvaluation) {
+        if constexpr (!std::is_same<ParametricType, ConstantType>::value) {
+            initializeCompiledFunctions();
+            std::vector<ConstantType> variableValues, functionValues;
+            compiledFunctions->getVariableValues(valuation, variableValues);
+            compiledFunctions->evaluate(variableValues, 1, functionValues);
+            for (uint64_t function = 0; function < functionValues.size(); ++function) {
+                *compiledFunctionPlaceholders[function] = functionValues[function];
+            }
+        }
+    } else {
+        instantiate_helper(valuation);
+    }
+
+    writeFunctionValuesToModel();
+    return *this->instantiatedModel;
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(
+    std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations,
+    std::function<void(uint64_t, ConstantSparseModelType const&)> const& callback) {
+    if (!useCompiledEvaluation) {
+        for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+            callback(valuationIndex, instantiate(valuations[valuationIndex]));
+        }
+        return;
+    }
+    if constexpr (!std::is_same<ParametricType, ConstantType>::value) {
+        initializeCompiledFunctions();
+        // The functions are evaluated for batches of valuations such that the intermediate results remain reasonably small.
+        uint64_t const batchSize = 64;
+        std::vector<ConstantType> variableValues, functionValues;
+        for (uint64_t batchBegin = 0; batchBegin < valuations.size(); batchBegin += batchSize) {
+            uint64_t batchEnd = std::min<uint64_t>(batchBegin + batchSize, valuations.size());
+            uint64_t numberOfValuations = batchEnd - batchBegin;
+            compiledFunctions->getVariableValues(valuations.cbegin() + batchBegin, valuations.cbegin() + batchEnd, variableValues);
+            compiledFunctions->evaluate(variableValues, numberOfValuations, functionValues);
+            for (uint64_t i = 0; i < numberOfValuations; ++i) {
+                for (uint64_t function = 0; function < compiledFunctionPlaceholders.size(); ++function) {
+                    *compiledFunctionPlaceholders[function] = functionValues[function * numberOfValuations + i];
+                }
+                writeFunctionValuesToModel();
+                callback(batchBegin + i, *this->instantiatedModel);
+            }
+        }
+    }
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::setUseCompiledEvaluation(bool value) {
+    STORM_LOG_THROW(!value || !std::is_same<ParametricType, ConstantType>::value, storm::exceptions::NotSupportedException,
+                    "Compiled evaluation is not supported if the instantiated model is parametric.");
+    useCompiledEvaluation = value;
+    if (useCompiledEvaluation) {
+        // Compile the functions right away such that instantiating does not access the parametric functions.
+        initializeCompiledFunctions();
+    }
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+bool ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::isUseCompiledEvaluationSet() const {
+    return useCompiledEvaluation;
+}
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::writeFunctionValuesToModel() {
     // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMapping) {
         entryValuePair.first->setValue(*(entryValuePair.second));
@@ -152,8 +222,22 @@ ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, Cons
     for (auto& entryValuePair : this->vectorMapping) {
         *(entryValuePair.first) = *(entryValuePair.second);
     }
+}
 
-    return *this->instantiatedModel;
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeCompiledFunctions() {
+    if constexpr (!std::is_same<ParametricType, ConstantType>::value) {
+        if (!compiledFunctions) {
+            std::vector<ParametricType> functionVector;
+            functionVector.reserve(this->functions.size());
+            compiledFunctionPlaceholders.reserve(this->functions.size());
+            for (auto& functionResult : this->functions) {
+                functionVector.push_back(functionResult.first);
+                compiledFunctionPlaceholders.push_back(&functionResult.second);
+            }
+            compiledFunctions = std::make_unique<CompiledRationalFunctions<ConstantType>>(functionVector);
+        }
+    }
 }
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
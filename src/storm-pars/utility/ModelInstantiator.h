@@ -1,10 +1,12 @@
 #ifndef STORM_UTILITY_MODELINSTANTIATOR_H
 #define STORM_UTILITY_MODELINSTANTIATOR_H
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
 
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -47,6 +49,26 @@ class ModelInstantiator {
      */
     ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
 
+    /*!
+     * Instantiates the model for each of the given valuations.
+     * If compiled evaluation is enabled, the occurring functions are evaluated for many valuations at once.
+     *
+     * @param valuations The valuations, each mapping the occurring variables to the value with which they should be substituted
+     * @param callback Invoked for each valuation with the index of the valuation and the instantiated model. The reference to the model is only
+     * valid during the invocation.
+     */
+    void instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations,
+                     std::function<void(uint64_t, ConstantSparseModelType const&)> const& callback);
+
+    /*!
+     * Sets whether the occurring functions are compiled into a numeric evaluation program instead of evaluating them with carl. This is
+     * considerably faster if many valuations are considered. For exact constant types, the results coincide. For floating point numbers, the
+     * results might differ due to rounding errors, as the evaluation is performed in floating point arithmetic.
+     * Enabling compiled evaluation compiles the functions immediately, such that subsequent instantiations do not access the parametric model.
+     */
+    void setUseCompiledEvaluation(bool value);
+    bool isUseCompiledEvaluationSet() const;
+
     /*!
      *  Check validity
      */
@@ -170,6 +192,16 @@ class ModelInstantiator {
                                  std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
                                  std::vector<ParametricType> const& parametricVector) const;
 
+    /*!
+     * Writes the values in the placeholders of the functions to the matrices and vectors of the instantiated model
+     */
+    void writeFunctionValuesToModel();
+
+    /*!
+     * Compiles the occurring functions, if this has not been done before
+     */
+    void initializeCompiledFunctions();
+
     /// The resulting model
     std::shared_ptr<ConstantSparseModelType> instantiatedModel;
     /// the occurring functions together with the corresponding placeholders for their evaluated result
@@ -178,6 +210,12 @@ class ModelInstantiator {
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
     /// Connection of Vector entries with placeholders
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
+
+    /// Whether the functions are evaluated using the compiled functions
+    bool useCompiledEvaluation;
+    /// The compiled functions together with the corresponding placeholders for their evaluated result
+    std::unique_ptr<CompiledRationalFunctions<ConstantType>> compiledFunctions;
+    std::vector<ConstantType*> compiledFunctionPlaceholders;
 };
 }  // Namespace utility
 }  // namespace storm
@@ -7,6 +7,7 @@
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelCheckerOptions.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -16,6 +17,7 @@ const std::string BeliefExplorationSettings::moduleName = "beliefExploration";
 
 const std::string refineOption = "refine";
 const std::string explorationTimeLimitOption = "exploration-time";
+const std::string explorationThreadsOption = "exploration-threads";
 const std::string resolutionOption = "resolution";
 const std::string clipGridResolutionOption = "clip-resolution";
 const std::string sizeThresholdOption = "size-threshold";
@@ -48,6 +50,15 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
             .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "In seconds.").setDefaultValueUnsignedInteger(0).build())
             .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                                   "Sets the number of threads used to expand beliefs concurrently. Does not affect the explored belief MDPs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, resolutionOption, false,
                                        "Sets the resolution of the discretization and how it is increased in case of refinement")
@@ -181,6 +192,11 @@ uint64_t BeliefExplorationSettings::getExplorationTimeLimit() const {
     return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+uint64_t BeliefExplorationSettings::getNumberOfExplorationThreads() const {
+    uint64_t numberOfThreads = this->getOption(explorationThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
 uint64_t BeliefExplorationSettings::getResolutionInit() const {
     return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
 }
@@ -255,6 +271,7 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     options.refinePrecision = storm::utility::convertNumber<ValueType>(getRefinePrecision());
     options.refineStepLimit = getRefineStepLimit();
     options.explorationTimeLimit = getExplorationTimeLimit();
+    options.explorationThreads = getNumberOfExplorationThreads();
 
     options.clippingGridRes = getClippingGridResolution();
     options.resolutionInit = getResolutionInit();
@@ -39,6 +39,9 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     uint64_t getExplorationTimeLimit() const;
 
+    /// The number of threads used to expand beliefs concurrently
+    uint64_t getNumberOfExplorationThreads() const;
+
     /// Discretization Resolution
     uint64_t getResolutionInit() const;
     double getResolutionFactor() const;
@@ -7,6 +7,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -25,7 +26,9 @@ const std::string exportWinningRegionOption = "exportwinningregion";
 const std::string preventGraphPreprocessing = "nographprocessing";
 const std::string beliefSupportMCOption = "belsupmc";
 const std::string memlessSearchOption = "memlesssearch";
-std::vector<std::string> memlessSearchMethods = {"one-shot", "iterative"};
+const std::string portfolioSizeOption = "portfoliosize";
+const std::string portfolioThreadsOption = "portfoliothreads";
+std::vector<std::string> memlessSearchMethods = {"one-shot", "iterative", "portfolio"};
 
 QualitativePOMDPAnalysisSettings::QualitativePOMDPAnalysisSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, memlessSearchOption, false, "Search for a qualitative memoryless scheduler")
@@ -75,6 +78,21 @@ QualitativePOMDPAnalysisSettings::QualitativePOMDPAnalysisSettings() : ModuleSet
             .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, preventGraphPreprocessing, true, "Prevent graph preprocessing (for debugging)").setIsAdvanced().build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, portfolioSizeOption, false, "Sets the number of iterative searches run by the portfolio method.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of searches.")
+                                         .setDefaultValueUnsignedInteger(4)
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, portfolioThreadsOption, false,
+                                                   "Sets the number of threads that run the searches of the portfolio method.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
 }
 
 uint64_t QualitativePOMDPAnalysisSettings::getLookahead() const {
@@ -136,6 +154,15 @@ std::string QualitativePOMDPAnalysisSettings::getMemlessSearchMethod() const {
     return this->getOption(memlessSearchOption).getArgumentByName("method").getValueAsString();
 }
 
+uint64_t QualitativePOMDPAnalysisSettings::getPortfolioSize() const {
+    return this->getOption(portfolioSizeOption).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t QualitativePOMDPAnalysisSettings::getNumberOfPortfolioThreads() const {
+    uint64_t numberOfThreads = this->getOption(portfolioThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
 void QualitativePOMDPAnalysisSettings::finalize() {}
 
 bool QualitativePOMDPAnalysisSettings::check() const {
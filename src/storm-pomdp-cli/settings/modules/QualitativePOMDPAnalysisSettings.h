@@ -34,6 +34,8 @@ class QualitativePOMDPAnalysisSettings : public ModuleSettings {
     bool isGraphPreprocessingAllowed() const;
     bool isMemlessSearchSet() const;
     std::string getMemlessSearchMethod() const;
+    uint64_t getPortfolioSize() const;
+    uint64_t getNumberOfPortfolioThreads() const;
 
     virtual ~QualitativePOMDPAnalysisSettings() = default;
 
@@ -17,6 +17,7 @@
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/analysis/UniqueObservationStates.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
@@ -231,6 +232,34 @@ void performQualitativeAnalysis(std::shared_ptr<storm::models::sparse::Pomdp<Val
                 search.getStatistics().print();
             }
 
+        } else if (qualSettings.getMemlessSearchMethod() == "portfolio") {
+            auto configurations = storm::pomdp::PolicySearchPortfolio<ValueType>::createConfigurations(fillMemlessSearchOptionsFromSettings(), lookahead,
+                                                                                                       qualSettings.getPortfolioSize());
+            storm::pomdp::PolicySearchPortfolio<ValueType> portfolio(pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, configurations,
+                                                                     qualSettings.getNumberOfPortfolioThreads());
+            if (qualSettings.isWinningRegionSet()) {
+                portfolio.computeWinningRegion();
+            } else {
+                bool result = portfolio.analyzeForInitialStates();
+                if (result) {
+                    STORM_PRINT_AND_LOG("From initial state, one can almost-surely reach the target.\n");
+                } else {
+                    STORM_PRINT_AND_LOG("From initial state, one may not almost-surely reach the target.\n");
+                }
+            }
+
+            if (qualSettings.isPrintWinningRegionSet()) {
+                portfolio.getLastWinningRegion().print();
+                std::cout << '\n';
+            }
+            if (qualSettings.isExportWinningRegionSet()) {
+                std::size_t hash = pomdp.hash();
+                portfolio.getLastWinningRegion().storeToFile(qualSettings.exportWinningRegionPath(), "model hash: " + std::to_string(hash));
+            }
+            if (coreSettings.isShowStatisticsSet()) {
+                STORM_PRINT_AND_LOG("#STATS Number of belief support states: " << portfolio.getLastWinningRegion().beliefSupportStates() << '\n');
+                portfolio.printStatistics();
+            }
         } else {
             STORM_LOG_ERROR("This method is not implemented.");
         }
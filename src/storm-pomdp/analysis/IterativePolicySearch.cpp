@@ -80,7 +80,6 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
     STORM_LOG_INFO("Start intializing solver...");
     bool delayedSwitching = false;  // Notice that delayed switching is currently not compatible with some of the other optimizations and it is unclear which of
                                     // these optimizations causes the problem.
-    bool lookaheadConstraintsRequired;
     if (options.forceLookahead) {
         lookaheadConstraintsRequired = true;
     } else {
@@ -101,6 +100,8 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
             reachVarExpressionsPerObservation[pomdp.getObservation(stateId)].push_back(reachVarExpressions.back());
             continuationVars.push_back(expressionManager->declareBooleanVariable("D-" + std::to_string(stateId)));
             continuationVarExpressions.push_back(continuationVars.back().getExpression());
+            targetVars.push_back(expressionManager->declareBooleanVariable("T-" + std::to_string(stateId)));
+            targetVarExpressions.push_back(targetVars.back().getExpression());
         }
         // Create the action selection variables.
         uint64_t obs = 0;
@@ -189,14 +190,16 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
     smtSolver->add(storm::expressions::disjunction(observationUpdatedExpressions));
 
     // PAPER COMMENT: 3
+    // Constraints that depend on whether a state is a target state are guarded by the corresponding target variable.
+    // Surely-reach-sink states never become target states.
+    for (auto state : surelyReachSinkStates) {
+        smtSolver->add(!targetVarExpressions[state]);
+    }
     if (lookaheadConstraintsRequired) {
         if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-                if (targetStates.get(state)) {
-                    smtSolver->add(pathVarExpressions[state][0]);
-                } else {
-                    smtSolver->add(!pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
-                }
+                smtSolver->add(!targetVarExpressions[state] || pathVarExpressions[state][0]);
+                smtSolver->add(targetVarExpressions[state] || !pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
             }
         } else {
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
@@ -208,7 +211,7 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
 
     uint64_t rowindex = 0;
     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-        if (targetStates.get(state) || surelyReachSinkStates.get(state)) {
+        if (surelyReachSinkStates.get(state)) {
             rowindex += pomdp.getNumberOfChoices(state);
             continue;
         }
@@ -216,11 +219,13 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
             std::vector<storm::expressions::Expression> subexprreachSwitch;
             std::vector<storm::expressions::Expression> subexprreachNoSwitch;
 
+            subexprreachSwitch.push_back(targetVarExpressions[state]);
             subexprreachSwitch.push_back(!reachVarExpressions[state]);
             subexprreachSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
             subexprreachSwitch.push_back(!switchVarExpressions[pomdp.getObservation(state)]);
             subexprreachSwitch.push_back(followVarExpressions[pomdp.getObservation(state)]);
 
+            subexprreachNoSwitch.push_back(targetVarExpressions[state]);
             subexprreachNoSwitch.push_back(!reachVarExpressions[state]);
             subexprreachNoSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
             subexprreachNoSwitch.push_back(switchVarExpressions[pomdp.getObservation(state)]);
@@ -244,8 +249,8 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
         }
     }
 
-    rowindex = 0;
     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        rowindex = pomdp.getTransitionMatrix().getRowGroupIndices()[state];
         if (surelyReachSinkStates.get(state)) {
             smtSolver->add(!reachVarExpressions[state]);
             smtSolver->add(!continuationVarExpressions[state]);
@@ -258,82 +263,79 @@ bool IterativePolicySearch<ValueType>::initialize(uint64_t k) {
                     smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(k));
                 }
             }
-            rowindex += pomdp.getNumberOfChoices(state);
-        } else if (!targetStates.get(state)) {
-            if (lookaheadConstraintsRequired) {
-                if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                    smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state), pathVarExpressions.at(state).back()));
-                    std::vector<std::vector<std::vector<storm::expressions::Expression>>> pathsubsubexprs;
-                    for (uint64_t j = 1; j < k; ++j) {
-                        pathsubsubexprs.push_back(std::vector<std::vector<storm::expressions::Expression>>());
-                        for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                            pathsubsubexprs.back().push_back(std::vector<storm::expressions::Expression>());
-                        }
-                    }
-
+            continue;
+        }
+        auto const& isTarget = targetVarExpressions[state];
+        if (lookaheadConstraintsRequired) {
+            // Ranking constraints for states that are not (yet) target states.
+            if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                smtSolver->add(isTarget || storm::expressions::implies(reachVarExpressions.at(state), pathVarExpressions.at(state).at(k - 1)));
+                std::vector<std::vector<std::vector<storm::expressions::Expression>>> pathsubsubexprs;
+                for (uint64_t j = 1; j < k; ++j) {
+                    pathsubsubexprs.push_back(std::vector<std::vector<storm::expressions::Expression>>());
                     for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                        std::vector<storm::expressions::Expression> subexprreach;
-                        for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
-                            for (uint64_t j = 1; j < k; ++j) {
-                                pathsubsubexprs[j - 1][action].push_back(pathVarExpressions[entries.getColumn()][j - 1]);
-                            }
-                        }
-                        rowindex++;
+                        pathsubsubexprs.back().push_back(std::vector<storm::expressions::Expression>());
                     }
+                }
 
-                    for (uint64_t j = 1; j < k; ++j) {
-                        std::vector<storm::expressions::Expression> pathsubexprs;
-                        for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                            pathsubexprs.push_back(actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action) &&
-                                                   storm::expressions::disjunction(pathsubsubexprs[j - 1][action]));
-                        }
-                        if (!delayedSwitching) {
-                            pathsubexprs.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
-                            pathsubexprs.push_back(followVarExpressions[pomdp.getObservation(state)]);
+                for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                    for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
+                        for (uint64_t j = 1; j < k; ++j) {
+                            pathsubsubexprs[j - 1][action].push_back(pathVarExpressions[entries.getColumn()][j - 1]);
                         }
-                        smtSolver->add(storm::expressions::iff(pathVarExpressions[state][j], storm::expressions::disjunction(pathsubexprs)));
                     }
-                } else {
-                    std::vector<storm::expressions::Expression> actPathDisjunction;
+                    rowindex++;
+                }
+
+                for (uint64_t j = 1; j < k; ++j) {
+                    std::vector<storm::expressions::Expression> pathsubexprs;
                     for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                        std::vector<storm::expressions::Expression> pathDisjunction;
-                        for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
-                            pathDisjunction.push_back(pathVarExpressions[entries.getColumn()][0] < pathVarExpressions[state][0]);
-                        }
-                        actPathDisjunction.push_back(storm::expressions::disjunction(pathDisjunction) &&
-                                                     actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action));
-                        rowindex++;
+                        pathsubexprs.push_back(actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action) &&
+                                               storm::expressions::disjunction(pathsubsubexprs[j - 1][action]));
                     }
                     if (!delayedSwitching) {
-                        actPathDisjunction.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
-                        actPathDisjunction.push_back(followVarExpressions[pomdp.getObservation(state)]);
+                        pathsubexprs.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
+                        pathsubexprs.push_back(followVarExpressions[pomdp.getObservation(state)]);
                     }
-                    actPathDisjunction.push_back(!reachVarExpressions[state]);
-                    smtSolver->add(storm::expressions::disjunction(actPathDisjunction));
+                    smtSolver->add(isTarget || storm::expressions::iff(pathVarExpressions[state][j], storm::expressions::disjunction(pathsubexprs)));
                 }
-            }
-        } else {
-            if (lookaheadConstraintsRequired) {
-                if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                    for (uint64_t j = 1; j < k; ++j) {
-                        smtSolver->add(pathVarExpressions[state][j]);
+            } else {
+                std::vector<storm::expressions::Expression> actPathDisjunction;
+                for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                    std::vector<storm::expressions::Expression> pathDisjunction;
+                    for (auto const& entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
+                        pathDisjunction.push_back(pathVarExpressions[entries.getColumn()][0] < pathVarExpressions[state][0]);
                     }
-                } else {
-                    smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(0));
+                    actPathDisjunction.push_back(storm::expressions::disjunction(pathDisjunction) &&
+                                                 actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action));
+                    rowindex++;
+                }
+                if (!delayedSwitching) {
+                    actPathDisjunction.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
+                    actPathDisjunction.push_back(followVarExpressions[pomdp.getObservation(state)]);
                 }
+                actPathDisjunction.push_back(!reachVarExpressions[state]);
+                actPathDisjunction.push_back(isTarget);
+                smtSolver->add(storm::expressions::disjunction(actPathDisjunction));
+            }
+
+            // Ranking constraints for target states.
+            if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                for (uint64_t j = 1; j < k; ++j) {
+                    smtSolver->add(!isTarget || pathVarExpressions[state][j]);
+                }
+            } else {
+                smtSolver->add(!isTarget || pathVarExpressions[state][0] == expressionManager->integer(0));
             }
-            smtSolver->add(reachVars[state]);
-            rowindex += pomdp.getNumberOfChoices(state);
         }
+        smtSolver->add(!isTarget || reachVarExpressions[state]);
     }
 
     obs = 0;
     for (auto const& statesForObservation : statesPerObservation) {
         for (auto const& state : statesForObservation) {
-            if (!targetStates.get(state)) {
-                smtSolver->add(!continuationVars[state] || schedulerVariableExpressions[obs] > 0);
-                smtSolver->add(!reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
-            }
+            smtSolver->add(targetVarExpressions[state] || !continuationVars[state] || schedulerVariableExpressions[obs] > 0);
+            smtSolver->add(targetVarExpressions[state] || !reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
         }
         ++obs;
     }
@@ -369,11 +371,31 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     STORM_LOG_DEBUG("Target states " << targetStates);
     STORM_LOG_DEBUG("Questionmark states " << (~surelyReachSinkStates & ~targetStates));
     stats.initializeSolverTimer.start();
-    // TODO: When do we need to reinitialize? When the solver has been reset.
-    bool lookaheadConstraintsRequired = initialize(k);
+    if (openSolverScopes > 0) {
+        // Clean up after a previous analysis.
+        reset();
+    }
+    if (!encodedLookahead || encodedLookahead.value() != k) {
+        // The encoding only has to be rebuilt if the lookahead changes.
+        smtSolver->reset();
+        initialize(k);
+        encodedLookahead = k;
+    }
     if (lookaheadConstraintsRequired) {
         maxK = k;
     }
+    // Fix the current target states. Since these assumptions are passed to every check, the encoding remains valid if the target states change.
+    targetAssumptions.clear();
+    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+        if (targetStates.get(state)) {
+            targetAssumptions.insert(targetVarExpressions[state]);
+        } else if (!surelyReachSinkStates.get(state)) {
+            targetAssumptions.insert(!targetVarExpressions[state]);
+        }
+    }
+    // All remaining constraints depend on the winning region and are dropped upon a restart.
+    smtSolver->push();
+    ++openSolverScopes;
 
     stats.winningRegionUpdatesTimer.start();
     storm::storage::BitVector updated(pomdp.getNrObservations());
@@ -483,6 +505,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     }
 
     smtSolver->push();
+    ++openSolverScopes;
     for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
         auto constant = expressionManager->integer(schedulerForObs[obs]);
         smtSolver->add(schedulerVariableExpressions[obs] <= constant);
@@ -659,6 +682,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
         }
         // smtSolver->unsetTimeout();
         smtSolver->pop();
+        --openSolverScopes;
 
         if (options.computeDebugOutput()) {
             std::stringstream strstr;
@@ -809,6 +833,7 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
         finalSchedulers.push_back(scheduler);
 
         smtSolver->push();
+        ++openSolverScopes;
 
         for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
             if (winningRegion.observationIsWinning(obs)) {
@@ -851,6 +876,29 @@ bool IterativePolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVe
     return true;
 }
 
+template<typename ValueType>
+bool IterativePolicySearch<ValueType>::extendWinningRegion(WinningRegion const& otherWinningRegion) {
+    STORM_LOG_ASSERT(otherWinningRegion.getNumberOfObservations() == pomdp.getNrObservations(), "Winning region does not match the POMDP.");
+    stats.winningRegionUpdatesTimer.start();
+    bool changed = false;
+    for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+        if (winningRegion.observationIsWinning(observation)) {
+            continue;
+        }
+        for (auto const& winningSet : otherWinningRegion.getWinningSetsPerObservation(observation)) {
+            changed |= winningRegion.update(observation, winningSet);
+        }
+        if (winningRegion.observationIsWinning(observation)) {
+            for (uint64_t state : statesPerObservation[observation]) {
+                assert(!surelyReachSinkStates.get(state));
+                targetStates.set(state);
+            }
+        }
+    }
+    stats.winningRegionUpdatesTimer.stop();
+    return changed;
+}
+
 template<typename ValueType>
 void IterativePolicySearch<ValueType>::coveredStatesToStream(std::ostream& os, storm::storage::BitVector const& remaining) const {
     bool first = true;
@@ -896,9 +944,11 @@ bool IterativePolicySearch<ValueType>::smtCheck(uint64_t iteration, std::set<sto
     storm::solver::SmtSolver::CheckResult result;
     stats.smtCheckTimer.start();
     if (assumptions.empty()) {
-        result = smtSolver->check();
+        result = smtSolver->checkWithAssumptions(targetAssumptions);
     } else {
-        result = smtSolver->checkWithAssumptions(assumptions);
+        std::set<storm::expressions::Expression> allAssumptions(targetAssumptions);
+        allAssumptions.insert(assumptions.begin(), assumptions.end());
+        result = smtSolver->checkWithAssumptions(allAssumptions);
     }
     stats.smtCheckTimer.stop();
     stats.incrementSmtChecks();
@@ -1,3 +1,7 @@
+#pragma once
+
+#include <optional>
+#include <set>
 #include <sstream>
 #include <vector>
 #include "storm/exceptions/UnexpectedException.h"
@@ -14,7 +18,7 @@ namespace storm {
 namespace pomdp {
 
 enum class MemlessSearchPathVariables { BooleanRanking, IntegerRanking, RealRanking };
-MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
     if (in == "int") {
         return MemlessSearchPathVariables::IntegerRanking;
     } else if (in == "real") {
@@ -187,6 +191,14 @@ class IterativePolicySearch {
     bool analyze(uint64_t k, storm::storage::BitVector const& oneOfTheseStates,
                  storm::storage::BitVector const& allOfTheseStates = storm::storage::BitVector());
 
+    /*!
+     * Extends the winning region by the given winning region, e.g., a winning region that has been computed by another search on the same POMDP.
+     * The extension is taken into account by the next call to analyze.
+     *
+     * @return true iff the winning region changed.
+     */
+    bool extendWinningRegion(WinningRegion const& otherWinningRegion);
+
     Statistics const& getStatistics() const;
     void finalizeStatistics();
 
@@ -197,7 +209,11 @@ class IterativePolicySearch {
         STORM_LOG_INFO("Reset solver to restart with current winning region");
         schedulerForObs.clear();
         finalSchedulers.clear();
-        smtSolver->reset();
+        // Only drop the constraints that depend on the winning region. The encoding from initialize is kept.
+        if (openSolverScopes > 0) {
+            smtSolver->pop(openSolverScopes);
+            openSolverScopes = 0;
+        }
     }
     void printScheduler(std::vector<InternalObservationScheduler> const&);
     void coveredStatesToStream(std::ostream& os, storm::storage::BitVector const& remaining) const;
@@ -235,6 +251,17 @@ class IterativePolicySearch {
     std::vector<storm::expressions::Expression> continuationVarExpressions;
     std::vector<std::vector<storm::expressions::Variable>> pathVars;
     std::vector<std::vector<storm::expressions::Expression>> pathVarExpressions;
+    // T_s holds iff state s is considered a target state. The values are fixed via assumptions, such that the encoding can be reused once the
+    // set of target states grows.
+    std::vector<storm::expressions::Variable> targetVars;
+    std::vector<storm::expressions::Expression> targetVarExpressions;
+    std::set<storm::expressions::Expression> targetAssumptions;
+
+    // The lookahead for which the solver currently holds the encoding (if any).
+    std::optional<uint64_t> encodedLookahead;
+    bool lookaheadConstraintsRequired = false;
+    // The number of scopes that have been pushed on top of the encoding.
+    uint64_t openSolverScopes = 0;
 
     std::vector<InternalObservationScheduler> finalSchedulers;
     std::vector<uint64_t> schedulerForObs;
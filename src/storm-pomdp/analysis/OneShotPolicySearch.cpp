@@ -7,7 +7,7 @@ namespace pomdp {
 
 template<typename ValueType>
 void OneShotPolicySearch<ValueType>::initialize(uint64_t k) {
-    if (maxK == std::numeric_limits<uint64_t>::max()) {
+    if (statesPerObservation.empty()) {
         // not initialized at all.
         // Create some data structures.
         for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
@@ -17,14 +17,10 @@ void OneShotPolicySearch<ValueType>::initialize(uint64_t k) {
         }
 
         // Fill the states-per-observation mapping,
-        // declare the reachability variables,
-        // declare the path variables.
+        // declare the reachability variables.
         uint64_t stateId = 0;
         for (auto obs : pomdp.getObservations()) {
             pathVars.push_back(std::vector<storm::expressions::Expression>());
-            for (uint64_t i = 0; i < k; ++i) {
-                pathVars.back().push_back(expressionManager->declareBooleanVariable("P-" + std::to_string(stateId) + "-" + std::to_string(i)).getExpression());
-            }
             reachVars.push_back(expressionManager->declareBooleanVariable("C-" + std::to_string(stateId)));
             reachVarExpressions.push_back(reachVars.back().getExpression());
             statesPerObservation.at(obs).push_back(stateId++);
@@ -41,8 +37,13 @@ void OneShotPolicySearch<ValueType>::initialize(uint64_t k) {
             }
             ++obs;
         }
-    } else {
-        assert(false);
+    }
+
+    // Declare the path variables. Variables from a previous encoding with a smaller lookahead are reused.
+    for (uint64_t stateId = 0; stateId < pomdp.getNumberOfStates(); ++stateId) {
+        for (uint64_t i = pathVars[stateId].size(); i < k; ++i) {
+            pathVars[stateId].push_back(expressionManager->declareBooleanVariable("P-" + std::to_string(stateId) + "-" + std::to_string(i)).getExpression());
+        }
     }
 
     for (auto const& actionVars : actionSelectionVarExpressions) {
@@ -104,7 +105,7 @@ void OneShotPolicySearch<ValueType>::initialize(uint64_t k) {
                 smtSolver->add(storm::expressions::iff(pathVars[state][j], storm::expressions::disjunction(pathsubexprs)));
             }
 
-            smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state), pathVars.at(state).back()));
+            smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state), pathVars.at(state).at(k - 1)));
 
         } else {
             rowindex += pomdp.getNumberOfChoices(state);
@@ -115,8 +116,13 @@ void OneShotPolicySearch<ValueType>::initialize(uint64_t k) {
 template<typename ValueType>
 bool OneShotPolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVector const& oneOfTheseStates, storm::storage::BitVector const& allOfTheseStates) {
     STORM_LOG_TRACE("Use lookahead of " << k);
-    if (k < maxK) {
+    if (k != maxK) {
+        // The encoding only depends on the lookahead and is kept for subsequent queries with the same lookahead.
+        stats.initializeSolverTimer.start();
+        smtSolver->reset();
         initialize(k);
+        maxK = k;
+        stats.initializeSolverTimer.stop();
     }
 
     std::vector<storm::expressions::Expression> atLeastOneOfStates;
@@ -125,23 +131,28 @@ bool OneShotPolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVect
         atLeastOneOfStates.push_back(reachVarExpressions[state]);
     }
     assert(atLeastOneOfStates.size() > 0);
+    // The query-specific constraint is removed after the check.
+    smtSolver->push();
     smtSolver->add(storm::expressions::disjunction(atLeastOneOfStates));
 
+    std::set<storm::expressions::Expression> allOfTheseAssumption;
     for (uint64_t state : allOfTheseStates) {
-        smtSolver->add(reachVarExpressions[state]);
+        allOfTheseAssumption.insert(reachVarExpressions[state]);
     }
 
     STORM_LOG_TRACE(smtSolver->getSmtLibString());
 
     STORM_LOG_DEBUG("Call to SMT Solver");
     stats.smtCheckTimer.start();
-    auto result = smtSolver->check();
+    auto result = smtSolver->checkWithAssumptions(allOfTheseAssumption);
     stats.smtCheckTimer.stop();
 
     if (result == storm::solver::SmtSolver::CheckResult::Unknown) {
+        smtSolver->pop();
         STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "SMT solver yielded an unexpected result");
     } else if (result == storm::solver::SmtSolver::CheckResult::Unsat) {
         STORM_LOG_DEBUG("Unsatisfiable!");
+        smtSolver->pop();
         return false;
     }
 
@@ -169,6 +180,7 @@ bool OneShotPolicySearch<ValueType>::analyze(uint64_t k, storm::storage::BitVect
             act++;
         }
     }
+    smtSolver->pop();
 
     return true;
 }
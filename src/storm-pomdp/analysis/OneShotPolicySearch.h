@@ -44,10 +44,13 @@ class OneShotPolicySearch {
 
     void setSurelyReachSinkStates(storm::storage::BitVector const& surelyReachSink) {
         surelyReachSinkStates = surelyReachSink;
+        // The encoding depends on these states.
+        maxK = std::numeric_limits<uint64_t>::max();
     }
 
     /*!
      * Check if you can find a memoryless policy from the initial states
+     * The encoding is kept between calls with the same lookahead, such that only the query itself is passed to the solver.
      * @param k The used lookahed
      * @return Replies true, if a memoryless policy is found. Notice that the algorithm is not complete.
      */
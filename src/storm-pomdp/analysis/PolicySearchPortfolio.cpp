@@ -0,0 +1,171 @@
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
+
+#include <algorithm>
+#include <map>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace pomdp {
+
+template<typename ValueType>
+PolicySearchPortfolio<ValueType>::PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::BitVector const& targetStates,
+                                                        storm::storage::BitVector const& surelyReachSinkStates,
+                                                        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory,
+                                                        std::vector<Configuration> const& configurations, uint64_t numberOfThreads)
+    : pomdp(pomdp), smtSolverFactory(smtSolverFactory), configurations(configurations), numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)) {
+    STORM_LOG_THROW(!configurations.empty(), storm::exceptions::InvalidArgumentException, "The portfolio needs at least one configuration.");
+    for (auto const& configuration : configurations) {
+        searches.push_back(std::make_unique<IterativePolicySearch<ValueType>>(pomdp, targetStates, surelyReachSinkStates, this->smtSolverFactory,
+                                                                               configuration.options));
+    }
+    std::vector<uint64_t> nrStatesPerObservation(pomdp.getNrObservations(), 0);
+    for (auto obs : pomdp.getObservations()) {
+        ++nrStatesPerObservation[obs];
+    }
+    winningRegion = WinningRegion(nrStatesPerObservation);
+    winningRegionQuery = std::make_unique<WinningRegionQueryInterface<ValueType>>(pomdp, winningRegion);
+}
+
+template<typename ValueType>
+std::vector<typename PolicySearchPortfolio<ValueType>::Configuration> PolicySearchPortfolio<ValueType>::createConfigurations(
+    MemlessSearchOptions const& options, uint64_t lookahead, uint64_t numberOfConfigurations) {
+    std::vector<Configuration> result;
+    for (uint64_t i = 0; i < numberOfConfigurations; ++i) {
+        Configuration configuration{options, lookahead};
+        switch (i % 4) {
+            case 1:
+                configuration.options.pathVariableType = MemlessSearchPathVariables::IntegerRanking;
+                break;
+            case 2:
+                configuration.options.pathVariableType = MemlessSearchPathVariables::BooleanRanking;
+                break;
+            case 3:
+                configuration.options.onlyDeterministicStrategies = !options.onlyDeterministicStrategies;
+                break;
+            default:
+                break;
+        }
+        // Further configurations repeat the above variations, but restart less often.
+        configuration.options.restartAfterNIterations = options.restartAfterNIterations * (i / 4 + 1);
+        result.push_back(std::move(configuration));
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool PolicySearchPortfolio<ValueType>::analyzeForInitialStates() {
+    while (true) {
+        if (performRound(true)) {
+            mergeWinningRegions();
+            return true;
+        }
+        bool changed = mergeWinningRegions();
+        if (initialStatesAreWinning()) {
+            return true;
+        }
+        if (!changed) {
+            return false;
+        }
+    }
+}
+
+template<typename ValueType>
+void PolicySearchPortfolio<ValueType>::computeWinningRegion() {
+    do {
+        performRound(false);
+    } while (mergeWinningRegions());
+}
+
+template<typename ValueType>
+bool PolicySearchPortfolio<ValueType>::performRound(bool onlyInitialStates) {
+    ++rounds;
+    STORM_LOG_INFO("Start round " << rounds << " of the policy search portfolio with " << searches.size() << " searches.");
+    if (rounds > 1) {
+        for (auto& search : searches) {
+            search->extendWinningRegion(winningRegion);
+        }
+    }
+    std::vector<char> foundWinningPolicy(searches.size(), false);
+    // Every search has its own solver and winning region, so the searches can run independently.
+    auto runSearches = [this, onlyInitialStates, &foundWinningPolicy](uint64_t begin, uint64_t end, uint64_t) {
+        for (uint64_t i = begin; i < end; ++i) {
+            if (onlyInitialStates) {
+                foundWinningPolicy[i] = searches[i]->analyzeForInitialStates(configurations[i].lookahead);
+            } else {
+                searches[i]->computeWinningRegion(configurations[i].lookahead);
+            }
+        }
+    };
+    storm::utility::processInParallel(0, searches.size(), numberOfThreads, runSearches);
+    return std::find(foundWinningPolicy.begin(), foundWinningPolicy.end(), true) != foundWinningPolicy.end();
+}
+
+template<typename ValueType>
+bool PolicySearchPortfolio<ValueType>::mergeWinningRegions() {
+    bool changed = false;
+    for (auto const& search : searches) {
+        WinningRegion const& other = search->getLastWinningRegion();
+        for (uint64_t observation = 0; observation < pomdp.getNrObservations(); ++observation) {
+            if (winningRegion.observationIsWinning(observation)) {
+                continue;
+            }
+            for (auto const& winningSet : other.getWinningSetsPerObservation(observation)) {
+                changed |= winningRegion.update(observation, winningSet);
+            }
+        }
+    }
+    bool validate = false;
+    for (auto const& configuration : configurations) {
+        validate |= configuration.options.validateResult || configuration.options.validateEveryStep;
+    }
+    if (validate) {
+        STORM_LOG_WARN("Validating the merged winning region, only for debugging purposes.");
+        winningRegionQuery->validate();
+    }
+    STORM_LOG_INFO("Merged winning region " << (changed ? "changed" : "did not change") << " in round " << rounds << ".");
+    return changed;
+}
+
+template<typename ValueType>
+bool PolicySearchPortfolio<ValueType>::initialStatesAreWinning() const {
+    // The initial belief support for every observation of an initial state.
+    std::map<uint32_t, storm::storage::BitVector> initialSupports;
+    for (auto state : pomdp.getInitialStates()) {
+        auto insertRes = initialSupports.emplace(pomdp.getObservation(state), storm::storage::BitVector(pomdp.getNumberOfStates()));
+        insertRes.first->second.set(state);
+    }
+    for (auto const& support : initialSupports) {
+        if (!winningRegionQuery->isInWinningRegion(support.second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+WinningRegion const& PolicySearchPortfolio<ValueType>::getLastWinningRegion() const {
+    return winningRegion;
+}
+
+template<typename ValueType>
+uint64_t PolicySearchPortfolio<ValueType>::getNumberOfRounds() const {
+    return rounds;
+}
+
+template<typename ValueType>
+void PolicySearchPortfolio<ValueType>::printStatistics() const {
+    STORM_PRINT_AND_LOG("#STATS Portfolio rounds: " << rounds << '\n');
+    for (uint64_t i = 0; i < searches.size(); ++i) {
+        STORM_PRINT_AND_LOG("#STATS Search " << i << ":\n");
+        searches[i]->getStatistics().print();
+    }
+}
+
+template class PolicySearchPortfolio<double>;
+template class PolicySearchPortfolio<storm::RationalNumber>;
+}  // namespace pomdp
+}  // namespace storm
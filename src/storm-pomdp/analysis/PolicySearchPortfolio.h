@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/WinningRegion.h"
+#include "storm-pomdp/analysis/WinningRegionQueryInterface.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/solver.h"
+
+namespace storm {
+namespace pomdp {
+
+/*!
+ * Runs several iterative policy searches with different configurations in parallel and shares the winning regions they find.
+ *
+ * Every search uses its own SMT solver. The searches proceed in rounds: In each round, all searches run concurrently, starting from the winning
+ * region that all searches together have found so far. Afterwards, the winning regions of the searches are merged, which again yields a
+ * winning region. The rounds end as soon as the merged winning region no longer changes.
+ */
+template<typename ValueType>
+class PolicySearchPortfolio {
+   public:
+    struct Configuration {
+        MemlessSearchOptions options;
+        uint64_t lookahead;
+    };
+
+    PolicySearchPortfolio(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::storage::BitVector const& targetStates,
+                          storm::storage::BitVector const& surelyReachSinkStates, std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory,
+                          std::vector<Configuration> const& configurations, uint64_t numberOfThreads);
+
+    /*!
+     * Creates the given number of configurations which vary the given options, such as the encoding of the ranking function,
+     * whether only deterministic schedulers are considered, and how often the searches restart.
+     */
+    static std::vector<Configuration> createConfigurations(MemlessSearchOptions const& options, uint64_t lookahead, uint64_t numberOfConfigurations);
+
+    /*!
+     * Checks whether the target can be reached almost-surely from the initial states.
+     * @return true, if a winning policy for the initial states is found. Notice that the algorithm is not complete.
+     */
+    bool analyzeForInitialStates();
+
+    void computeWinningRegion();
+
+    WinningRegion const& getLastWinningRegion() const;
+
+    uint64_t getNumberOfRounds() const;
+
+    void printStatistics() const;
+
+   private:
+    /*!
+     * Runs all searches concurrently.
+     * @return true, if one of the searches found that the initial states are winning (only if onlyInitialStates is set).
+     */
+    bool performRound(bool onlyInitialStates);
+
+    /*!
+     * Merges the winning regions of all searches into the shared winning region.
+     * @return true, if the shared winning region changed.
+     */
+    bool mergeWinningRegions();
+
+    bool initialStatesAreWinning() const;
+
+    storm::models::sparse::Pomdp<ValueType> const& pomdp;
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
+    std::vector<Configuration> configurations;
+    uint64_t numberOfThreads;
+    std::vector<std::unique_ptr<IterativePolicySearch<ValueType>>> searches;
+
+    WinningRegion winningRegion;
+    std::unique_ptr<WinningRegionQueryInterface<ValueType>> winningRegionQuery;
+    uint64_t rounds = 0;
+};
+
+}  // namespace pomdp
+}  // namespace storm
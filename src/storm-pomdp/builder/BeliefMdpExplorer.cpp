@@ -1,8 +1,13 @@
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/api/verification.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/results/CheckResult.h"
@@ -38,7 +43,11 @@ template<typename PomdpType, typename BeliefValueType>
 BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,
                                                                  storm::pomdp::storage::PreprocessingPomdpValueBounds<ValueType> const &pomdpValueBounds,
                                                                  ExplorationHeuristic explorationHeuristic)
-    : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), explHeuristic(explorationHeuristic), status(Status::Uninitialized) {
+    : beliefManager(beliefManager),
+      pomdpValueBounds(pomdpValueBounds),
+      incrementalSolving(true),
+      explHeuristic(explorationHeuristic),
+      status(Status::Uninitialized) {
     // Intentionally left empty
 }
 
@@ -79,6 +88,7 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::startNewExploration(std::opt
     optimalChoicesReachableMdpStates = std::nullopt;
     scheduler = nullptr;
     exploredMdp = nullptr;
+    lastCheckedMdp = std::nullopt;
     internalAddRowGroupIndex();  // Mark the start of the first row group
 
     // Add some states with special treatment (if requested)
@@ -235,6 +245,19 @@ std::vector<uint64_t> BeliefMdpExplorer<PomdpType, BeliefValueType>::getUnexplor
     return res;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getNextBeliefsToExplore(
+    uint64_t maxNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> res;
+    res.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplorePrioState.size()));
+    // States are taken from the back of the queue (see exploreNextState)
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && res.size() < maxNumberOfBeliefs; ++stateIt) {
+        res.push_back(mdpStateToBeliefIdMap[stateIt->second]);
+    }
+    return res;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplorer<PomdpType, BeliefValueType>::exploreNextState() {
     STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
@@ -916,23 +939,266 @@ void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(s
     STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
     STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
     auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-    auto task = createStandardCheckTask(property);
 
-    std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
-    if (res) {
-        values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
-        scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+    // Try to only analyze the states whose values might have changed since the last check
+    std::vector<MdpStateType> previousStates;
+    storm::storage::BitVector affectedStates;
+    std::shared_ptr<storm::models::sparse::Mdp<ValueType>> affectedStatesMdp;
+    if (canComputeValuesIncrementally(env, dir)) {
+        affectedStates = computeAffectedStates(previousStates);
+        affectedStatesMdp = buildMdpOfAffectedStates(affectedStates, previousStates);
+    }
+
+    bool resultObtained = false;
+    if (affectedStatesMdp) {
+        STORM_LOG_DEBUG("Analyzing " << affectedStates.getNumberOfSetBits() << " of " << exploredMdp->getNumberOfStates()
+                                     << " states of the explored MDP. The values of the remaining states are taken from the previous check.");
+        std::vector<ValueType> affectedValues;
+        std::unique_ptr<storm::modelchecker::CheckResult> res;
+        if (!affectedStates.empty()) {
+            // The fresh target state has value one (probabilities) or zero (rewards). The fresh sink state (if present) has value zero.
+            std::vector<ValueType> resultHint = storm::utility::vector::filterVector(values, affectedStates);
+            resultHint.push_back(exploredMdp->hasRewardModel() ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+            resultHint.resize(affectedStatesMdp->getNumberOfStates(), storm::utility::zero<ValueType>());
+            auto task = createStandardCheckTask(property, resultHint);
+            res = storm::api::verifyWithSparseEngine<ValueType>(env, affectedStatesMdp, task);
+        }
+        if (res || affectedStates.empty()) {
+            uint64_t const numberOfStates = exploredMdp->getNumberOfStates();
+            values.resize(numberOfStates);
+            scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(numberOfStates);
+            uint64_t affectedState = 0;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (affectedStates.get(state)) {
+                    values[state] = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector()[affectedState]);
+                    scheduler->setChoice(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler().getChoice(affectedState), state);
+                    ++affectedState;
+                } else {
+                    values[state] = lastCheckedMdp->values[previousStates[state]];
+                    if (lastCheckedMdp->scheduler) {
+                        scheduler->setChoice(lastCheckedMdp->scheduler->getChoice(previousStates[state]), state);
+                    }
+                }
+            }
+            resultObtained = true;
+        }
+    } else {
+        auto task = createStandardCheckTask(property, values);
+        std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(env, exploredMdp, task));
+        if (res) {
+            values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+            scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(res->asExplicitQuantitativeCheckResult<ValueType>().getScheduler());
+            resultObtained = true;
+        }
+    }
+
+    if (resultObtained) {
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                   "Computed values are smaller than the lower bound.");
         STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
                                   "Computed values are larger than the upper bound.");
+        if (incrementalSolving) {
+            lastCheckedMdp = CheckedMdpInformation{exploredMdp, mdpStateToBeliefIdMap, extraTargetState, extraBottomState, dir, values, scheduler};
+        }
     } else {
         STORM_LOG_ASSERT(storm::utility::resources::isTerminate(), "Empty check result!");
         STORM_LOG_ERROR("No result obtained while checking.");
+        lastCheckedMdp = std::nullopt;
     }
     status = Status::ModelChecked;
 }
 
+template<typename PomdpType, typename BeliefValueType>
+void BeliefMdpExplorer<PomdpType, BeliefValueType>::setIncrementalSolving(bool value) {
+    incrementalSolving = value;
+    if (!incrementalSolving) {
+        lastCheckedMdp = std::nullopt;
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType>
+bool BeliefMdpExplorer<PomdpType, BeliefValueType>::canComputeValuesIncrementally(storm::Environment const &env,
+                                                                                  storm::solver::OptimizationDirection const &dir) const {
+    if (!incrementalSolving || !lastCheckedMdp || lastCheckedMdp->dir != dir || exploredMdp->hasRewardModel() != lastCheckedMdp->mdp->hasRewardModel()) {
+        return false;
+    }
+    // The error of the reused values would accumulate with the error of the newly computed values.
+    if (env.solver().isForceSoundness()) {
+        return false;
+    }
+    // Transition rewards (as introduced by clipping) are not supported.
+    if (exploredMdp->hasRewardModel() &&
+        (exploredMdp->getUniqueRewardModel().hasTransitionRewards() || lastCheckedMdp->mdp->getUniqueRewardModel().hasTransitionRewards())) {
+        return false;
+    }
+    return true;
+}
+
+template<typename PomdpType, typename BeliefValueType>
+storm::storage::BitVector BeliefMdpExplorer<PomdpType, BeliefValueType>::computeAffectedStates(std::vector<MdpStateType> &previousStates) const {
+    STORM_LOG_ASSERT(lastCheckedMdp, "No previously checked MDP available.");
+    auto const &transitions = exploredMdp->getTransitionMatrix();
+    auto const &previousTransitions = lastCheckedMdp->mdp->getTransitionMatrix();
+    auto const &targets = exploredMdp->getStates("target");
+    auto const &previousTargets = lastCheckedMdp->mdp->getStates("target");
+    std::vector<ValueType> const *rewards = nullptr;
+    std::vector<ValueType> const *previousRewards = nullptr;
+    if (exploredMdp->hasRewardModel()) {
+        rewards = &exploredMdp->getUniqueRewardModel().getStateActionRewardVector();
+        previousRewards = &lastCheckedMdp->mdp->getUniqueRewardModel().getStateActionRewardVector();
+    }
+    uint64_t const numberOfStates = exploredMdp->getNumberOfStates();
+
+    // Find the corresponding states of the previously checked MDP. States are identified via their beliefs.
+    std::unordered_map<BeliefId, MdpStateType> previousBeliefIdToMdpStateMap;
+    for (MdpStateType previousState = 0; previousState < lastCheckedMdp->mdpStateToBeliefIdMap.size(); ++previousState) {
+        if (lastCheckedMdp->mdpStateToBeliefIdMap[previousState] != beliefManager->noId()) {
+            previousBeliefIdToMdpStateMap.emplace(lastCheckedMdp->mdpStateToBeliefIdMap[previousState], previousState);
+        }
+    }
+    previousStates.assign(numberOfStates, noState());
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        if (state == extraTargetState) {
+            previousStates[state] = lastCheckedMdp->extraTargetState.value_or(noState());
+        } else if (state == extraBottomState) {
+            previousStates[state] = lastCheckedMdp->extraBottomState.value_or(noState());
+        } else {
+            auto findRes = previousBeliefIdToMdpStateMap.find(mdpStateToBeliefIdMap[state]);
+            if (findRes != previousBeliefIdToMdpStateMap.end()) {
+                previousStates[state] = findRes->second;
+            }
+        }
+    }
+
+    // Find the states whose behavior is new or has changed.
+    storm::storage::BitVector changedStates(numberOfStates, false);
+    std::vector<std::pair<MdpStateType, ValueType>> rowEntries;
+    auto hasChangedChoice = [&](MdpStateType state, MdpStateType previousState) {
+        for (uint64_t localChoice = 0; localChoice < transitions.getRowGroupSize(state); ++localChoice) {
+            uint64_t choice = transitions.getRowGroupIndices()[state] + localChoice;
+            uint64_t previousChoice = previousTransitions.getRowGroupIndices()[previousState] + localChoice;
+            if (rewards && (*rewards)[choice] != (*previousRewards)[previousChoice]) {
+                return true;
+            }
+            auto previousRow = previousTransitions.getRow(previousChoice);
+            if (transitions.getRow(choice).getNumberOfEntries() != previousRow.getNumberOfEntries()) {
+                return true;
+            }
+            // Translate the successors to states of the previous MDP. Successors without such a state are translated to noState() and sorted last.
+            rowEntries.clear();
+            for (auto const &entry : transitions.getRow(choice)) {
+                rowEntries.emplace_back(previousStates[entry.getColumn()], entry.getValue());
+            }
+            std::sort(rowEntries.begin(), rowEntries.end(), [](auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; });
+            if (!std::equal(rowEntries.begin(), rowEntries.end(), previousRow.begin(),
+                            [](auto const &lhs, auto const &rhs) { return lhs.first == rhs.getColumn() && lhs.second == rhs.getValue(); })) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (MdpStateType state = 0; state < numberOfStates; ++state) {
+        MdpStateType previousState = previousStates[state];
+        if (previousState == noState() || targets.get(state) != previousTargets.get(previousState) ||
+            transitions.getRowGroupSize(state) != previousTransitions.getRowGroupSize(previousState) || hasChangedChoice(state, previousState)) {
+            changedStates.set(state, true);
+        }
+    }
+    if (changedStates.empty()) {
+        return changedStates;
+    }
+    return storm::utility::graph::performProbGreater0(exploredMdp->getBackwardTransitions(), storm::storage::BitVector(numberOfStates, true),
+                                                      changedStates);
+}
+
+template<typename PomdpType, typename BeliefValueType>
+std::shared_ptr<storm::models::sparse::Mdp<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>>
+BeliefMdpExplorer<PomdpType, BeliefValueType>::buildMdpOfAffectedStates(storm::storage::BitVector const &affectedStates,
+                                                                        std::vector<MdpStateType> const &previousStates) const {
+    auto const &transitions = exploredMdp->getTransitionMatrix();
+    bool const computeRewards = exploredMdp->hasRewardModel();
+    std::vector<ValueType> const *rewards = computeRewards ? &exploredMdp->getUniqueRewardModel().getStateActionRewardVector() : nullptr;
+
+    // For rewards, the value of a non-affected state is collected upon leaving the affected states. Hence, we only need a fresh target state.
+    uint64_t const numberOfAffectedStates = affectedStates.getNumberOfSetBits();
+    MdpStateType const freshTargetState = numberOfAffectedStates;
+    MdpStateType const freshBottomState = numberOfAffectedStates + 1;
+    uint64_t const numberOfStates = computeRewards ? numberOfAffectedStates + 1 : numberOfAffectedStates + 2;
+    uint64_t numberOfChoices = numberOfStates - numberOfAffectedStates;
+    for (auto state : affectedStates) {
+        numberOfChoices += transitions.getRowGroupSize(state);
+    }
+    std::vector<uint_fast64_t> stateToAffectedState = affectedStates.getNumberOfSetBitsBeforeIndices();
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfChoices, numberOfStates, 0, true, true, numberOfStates);
+    std::vector<ValueType> choiceRewards;
+    if (computeRewards) {
+        choiceRewards.reserve(numberOfChoices);
+    }
+    uint64_t choice = 0;
+    for (auto state : affectedStates) {
+        builder.newRowGroup(choice);
+        for (uint64_t row = transitions.getRowGroupIndices()[state]; row < transitions.getRowGroupIndices()[state + 1]; ++row, ++choice) {
+            ValueType targetProbability = storm::utility::zero<ValueType>();
+            ValueType bottomProbability = storm::utility::zero<ValueType>();
+            ValueType reward = computeRewards ? (*rewards)[row] : storm::utility::zero<ValueType>();
+            for (auto const &entry : transitions.getRow(row)) {
+                if (affectedStates.get(entry.getColumn())) {
+                    builder.addNextValue(choice, stateToAffectedState[entry.getColumn()], entry.getValue());
+                    continue;
+                }
+                ValueType const &previousValue = lastCheckedMdp->values[previousStates[entry.getColumn()]];
+                if (computeRewards) {
+                    if (storm::utility::isInfinity(previousValue)) {
+                        return nullptr;
+                    }
+                    reward += entry.getValue() * previousValue;
+                    targetProbability += entry.getValue();
+                } else {
+                    targetProbability += entry.getValue() * previousValue;
+                    bottomProbability += entry.getValue() * (storm::utility::one<ValueType>() - previousValue);
+                }
+            }
+            if (!storm::utility::isZero(targetProbability)) {
+                builder.addNextValue(choice, freshTargetState, targetProbability);
+            }
+            if (!storm::utility::isZero(bottomProbability)) {
+                builder.addNextValue(choice, freshBottomState, bottomProbability);
+            }
+            if (computeRewards) {
+                choiceRewards.push_back(std::move(reward));
+            }
+        }
+    }
+    for (MdpStateType freshState = numberOfAffectedStates; freshState < numberOfStates; ++freshState, ++choice) {
+        builder.newRowGroup(choice);
+        builder.addNextValue(choice, freshState, storm::utility::one<ValueType>());
+        if (computeRewards) {
+            choiceRewards.push_back(storm::utility::zero<ValueType>());
+        }
+    }
+
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    storm::storage::BitVector initialStates = exploredMdp->getInitialStates() % affectedStates;
+    initialStates.resize(numberOfStates, false);
+    if (initialStates.empty()) {
+        initialStates.set(freshTargetState, true);
+    }
+    labeling.addLabel("init", std::move(initialStates));
+    storm::storage::BitVector targetStates = exploredMdp->getStates("target") % affectedStates;
+    targetStates.resize(numberOfStates, false);
+    targetStates.set(freshTargetState, true);
+    labeling.addLabel("target", std::move(targetStates));
+
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+    if (computeRewards) {
+        rewardModels.emplace("default",
+                             storm::models::sparse::StandardRewardModel<ValueType>(std::optional<std::vector<ValueType>>(), std::move(choiceRewards)));
+    }
+    storm::storage::sparse::ModelComponents<ValueType> modelComponents(builder.build(), std::move(labeling), std::move(rewardModels));
+    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(modelComponents));
+}
+
 template<typename PomdpType, typename BeliefValueType>
 bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
     return status == Status::ModelChecked;
@@ -1079,12 +1345,13 @@ std::shared_ptr<storm::logic::Formula const> BeliefMdpExplorer<PomdpType, Belief
 
 template<typename PomdpType, typename BeliefValueType>
 storm::modelchecker::CheckTask<storm::logic::Formula, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>
-BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property) {
+BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property,
+                                                                       std::vector<ValueType> const &resultHint) {
     // Note: The property should not run out of scope after calling this because the task only stores the property by reference.
     //  Therefore, this method needs the property by reference (and not const reference)
     auto task = storm::api::createTask<ValueType>(property, false);
     auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
-    hint.setResultHint(values);
+    hint.setResultHint(resultHint);
     auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
     task.setHint(hintPtr);
     task.setProduceSchedulers();
@@ -63,6 +63,12 @@ class BeliefMdpExplorer {
 
     std::vector<uint64_t> getUnexploredStates();
 
+    /*!
+     * Retrieves the beliefs of (at most) the given number of states that are explored next.
+     * The beliefs are given in the order in which they would be explored if no further states are added to the exploration queue.
+     */
+    std::vector<BeliefId> getNextBeliefsToExplore(uint64_t maxNumberOfBeliefs) const;
+
     BeliefId exploreNextState();
 
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
@@ -180,8 +186,19 @@ class BeliefMdpExplorer {
 
     std::vector<storm::storage::Scheduler<ValueType>> getLowerValueBoundSchedulers() const;
 
+    /*!
+     * Computes the values and an optimal scheduler of the explored MDP.
+     * If incremental solving is enabled, the values and choices of the previously checked MDP are reused for all states that can not reach a state
+     * whose behavior has changed since then. Only the remaining states are analyzed.
+     */
     void computeValuesOfExploredMdp(storm::Environment const &env, storm::solver::OptimizationDirection const &dir);
 
+    /*!
+     * Sets whether the values of the explored MDP are computed incrementally, i.e., based on the results of the previously checked MDP (default: true).
+     * Incremental solving is never applied if sound results are requested.
+     */
+    void setIncrementalSolving(bool value);
+
     bool hasComputedValues() const;
 
     bool hasFMSchedulerValues() const;
@@ -260,7 +277,29 @@ class BeliefMdpExplorer {
 
     std::shared_ptr<storm::logic::Formula const> createStandardProperty(storm::solver::OptimizationDirection const &dir, bool computeRewards);
 
-    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property);
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property,
+                                                                                             std::vector<ValueType> const &resultHint);
+
+    /*!
+     * Checks whether the explored MDP can be analyzed based on the results of the previously checked MDP.
+     */
+    bool canComputeValuesIncrementally(storm::Environment const &env, storm::solver::OptimizationDirection const &dir) const;
+
+    /*!
+     * Computes the states of the explored MDP whose value might differ from the value of the corresponding state of the previously checked MDP, i.e.,
+     * the states that can reach a state whose choices, transitions or rewards are new or have changed.
+     * @param previousStates is filled with the corresponding states of the previously checked MDP (or noState() if there is none).
+     */
+    storm::storage::BitVector computeAffectedStates(std::vector<MdpStateType> &previousStates) const;
+
+    /*!
+     * Builds the sub-MDP of the explored MDP that consists of the given affected states. Transitions leaving the affected states are redirected to a
+     * fresh target state (and a fresh sink state) according to the values computed for the previously checked MDP.
+     * The fresh states are appended to the affected states.
+     * @return the sub-MDP or nullptr if the previously computed values can not be incorporated (e.g. infinite rewards).
+     */
+    std::shared_ptr<storm::models::sparse::Mdp<ValueType>> buildMdpOfAffectedStates(storm::storage::BitVector const &affectedStates,
+                                                                                   std::vector<MdpStateType> const &previousStates) const;
 
     MdpStateType getCurrentMdpState() const;
 
@@ -319,6 +358,19 @@ class BeliefMdpExplorer {
     std::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
     std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
 
+    // Information about the most recently checked MDP that is used to analyze the subsequently explored MDP incrementally
+    struct CheckedMdpInformation {
+        std::shared_ptr<storm::models::sparse::Mdp<ValueType>> mdp;
+        std::vector<BeliefId> mdpStateToBeliefIdMap;
+        std::optional<MdpStateType> extraTargetState;
+        std::optional<MdpStateType> extraBottomState;
+        storm::solver::OptimizationDirection dir;
+        std::vector<ValueType> values;
+        std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+    };
+    bool incrementalSolving;
+    std::optional<CheckedMdpInformation> lastCheckedMdp;
+
     // The current status of this explorer
     ExplorationHeuristic explHeuristic;
     Status status;
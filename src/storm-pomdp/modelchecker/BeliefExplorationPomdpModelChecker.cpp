@@ -322,10 +322,12 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         overApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
             options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+        overApproxBeliefManager->setNumberOfThreads(options.explorationThreads);
         if (rewardModelName) {
             overApproxBeliefManager->setRewardModel(rewardModelName);
         }
         overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, trivialPOMDPBounds, storm::builder::ExplorationHeuristic::BreadthFirst);
+        overApproximation->setIncrementalSolving(options.incrementalSolving);
         overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
         overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -350,10 +352,12 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         underApproxBeliefManager = std::make_shared<BeliefManagerType>(
             pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
             options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+        underApproxBeliefManager->setNumberOfThreads(options.explorationThreads);
         if (rewardModelName) {
             underApproxBeliefManager->setRewardModel(rewardModelName);
         }
         underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+        underApproximation->setIncrementalSolving(options.incrementalSolving);
         underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
         underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
         underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -588,12 +592,14 @@ void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     underApproxBeliefManager = std::make_shared<BeliefManagerType>(
         pomdp(), storm::utility::convertNumber<BeliefValueType>(options.numericPrecision),
         options.dynamicTriangulation ? BeliefManagerType::TriangulationMode::Dynamic : BeliefManagerType::TriangulationMode::Static);
+    underApproxBeliefManager->setNumberOfThreads(options.explorationThreads);
     if (rewardModelName) {
         underApproxBeliefManager->setRewardModel(rewardModelName);
     }
 
     // set up belief MDP explorer
     interactiveUnderApproximationExplorer = std::make_shared<ExplorerType>(underApproxBeliefManager, trivialPOMDPBounds, options.explorationHeuristic);
+    interactiveUnderApproximationExplorer->setIncrementalSolving(options.incrementalSolving);
     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
     underApproxHeuristicPar.sizeThreshold = std::numeric_limits<uint64_t>::max() - 1;  // we don't set a size threshold
@@ -920,6 +926,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                     checkRewireForAllActions = true;
                 }
             }
+            if (exploreAllActions || truncateAllActions || (checkRewireForAllActions && !restoreAllActions)) {
+                precomputeExpansions(currId, targetObservations, beliefManager, overApproximation, observationResolutionVector);
+            }
             bool expandedAtLeastOneAction = false;
             for (uint64_t action = 0, numActions = beliefManager->getBeliefNumberOfChoices(currId); action < numActions; ++action) {
                 bool expandCurrentAction = exploreAllActions || truncateAllActions;
@@ -1153,6 +1162,9 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
                 if (underApproximation->needsActionAdjustment(numActions)) {
                     underApproximation->adjustActions(numActions);
                 }
+                if (!stateAlreadyExplored) {
+                    precomputeExpansions(currId, targetObservations, beliefManager, underApproximation);
+                }
                 for (uint64_t action = 0; action < numActions; ++action) {
                     // Always restore old behavior if available
                     if (pomdp().hasChoiceLabeling()) {
@@ -1292,6 +1304,24 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     return fixPoint;
 }
 
+template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
+void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::precomputeExpansions(
+    uint64_t beliefId, std::set<uint32_t> const& targetObservations, std::shared_ptr<BeliefManagerType>& beliefManager,
+    std::shared_ptr<ExplorerType>& beliefExplorer, std::optional<std::vector<BeliefValueType>> const& observationResolutions) {
+    if (beliefManager->getNumberOfThreads() <= 1 || beliefManager->hasPrecomputedExpansion(beliefId, observationResolutions)) {
+        return;
+    }
+    // Expand a few beliefs per thread at once to keep the synchronization overhead low.
+    uint64_t const numberOfBeliefsPerThread = 16;
+    std::vector<uint64_t> beliefIds = {beliefId};
+    for (auto const& nextBeliefId : beliefExplorer->getNextBeliefsToExplore(numberOfBeliefsPerThread * beliefManager->getNumberOfThreads())) {
+        if (targetObservations.count(beliefManager->getBeliefObservation(nextBeliefId)) == 0) {
+            beliefIds.push_back(nextBeliefId);
+        }
+    }
+    beliefManager->precomputeExpansions(beliefIds, observationResolutions);
+}
+
 template<typename PomdpModelType, typename BeliefValueType, typename BeliefMDPType>
 void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefMDPType>::clipToGrid(uint64_t clippingStateId, bool computeRewards, bool min,
                                                                                                     std::shared_ptr<BeliefManagerType>& beliefManager,
@@ -292,6 +292,19 @@ class BeliefExplorationPomdpModelChecker {
                                  HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager,
                                  std::shared_ptr<ExplorerType>& underApproximation, bool interactive);
 
+    /**
+     * If beliefs are expanded concurrently, precomputes the expansions of the given belief and of the beliefs that are explored next (unless this
+     * has already been done). Since successor beliefs are only registered when the expansions are taken, the explored MDP remains the same.
+     * @param beliefId the belief that is about to be expanded
+     * @param targetObservations the target observations of the objective (beliefs with these observations are not expanded)
+     * @param beliefManager the belief manager used
+     * @param beliefExplorer the belief MDP explorer used
+     * @param observationResolutions if given, the successor beliefs are triangulated with these resolutions
+     */
+    void precomputeExpansions(uint64_t beliefId, std::set<uint32_t> const& targetObservations, std::shared_ptr<BeliefManagerType>& beliefManager,
+                              std::shared_ptr<ExplorerType>& beliefExplorer,
+                              std::optional<std::vector<BeliefValueType>> const& observationResolutions = std::nullopt);
+
     /**
      * Clips the belief with the given state ID to a belief grid by clipping its direct successor ("grid clipping")
      * Transitions to explored successors and successors on the grid are added, otherwise successors are not generated
@@ -29,6 +29,10 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     uint64_t refineStepLimit = 0;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    // The number of threads used to expand beliefs concurrently. The explored belief MDPs do not depend on this number.
+    uint64_t explorationThreads = 1;
+    // If set, refined belief MDPs are analyzed incrementally, reusing the results for states that are not affected by the refinement.
+    bool incrementalSolving = true;
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
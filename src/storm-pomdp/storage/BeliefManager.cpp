@@ -1,11 +1,14 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/solver/GlpkLpSolver.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace storage {
@@ -31,13 +34,13 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(BeliefView const &lhBelief, BeliefView const &rhBelief) const {
+    return lhBelief.size() == rhBelief.size() && std::equal(lhBelief.begin(), lhBelief.end(), rhBelief.begin());
 }
 
 template<>
-bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
-                                                                                                        const BeliefType &rhBelief) const {
+bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(BeliefView const &lhBelief,
+                                                                                                        BeliefView const &rhBelief) const {
     // If the sizes are different, we don't have to look inside the belief
     if (lhBelief.size() != rhBelief.size()) {
         return false;
@@ -57,7 +60,7 @@ bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Beli
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(BeliefView const &belief) const {
     std::size_t seed = 0;
     // Assumes that beliefs are ordered
     for (auto const &entry : belief) {
@@ -68,7 +71,7 @@ std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::op
 }
 
 template<>
-std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(const BeliefType &belief) const {
+std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(BeliefView const &belief) const {
     std::size_t seed = 0;
     // Assumes that beliefs are ordered
     for (auto const &entry : belief) {
@@ -83,10 +86,45 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType co
                                                                     TriangulationMode const &triangulationMode)
     : pomdp(pomdp), triangulationMode(triangulationMode) {
     cc = storm::utility::ConstantsComparator<BeliefValueType>(precision, false);
-    beliefToIdMap.resize(pomdp.getNrObservations());
+    beliefOffsets.push_back(0);
+    beliefIdTables.resize(pomdp.getNrObservations());
+    beliefIdTableLoads.resize(pomdp.getNrObservations(), 0);
+    expansionBuffers.resize(1);
     initialBeliefId = computeInitialBelief();
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+BeliefManager<PomdpType, BeliefValueType, StateType>::~BeliefManager() = default;
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::PendingDestinations::size() const {
+    return values.size();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::PendingDestinations::clear() {
+    beliefEntries.clear();
+    beliefOffsets.resize(1);
+    values.clear();
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::PendingDestinations::append(PendingDestinations const &other, uint64_t firstDestination) {
+    uint64_t otherEntriesBegin = other.beliefOffsets[firstDestination];
+    uint64_t entriesBegin = beliefEntries.size();
+    beliefEntries.insert(beliefEntries.end(), other.beliefEntries.begin() + otherEntriesBegin, other.beliefEntries.end());
+    for (uint64_t destination = firstDestination + 1; destination < other.beliefOffsets.size(); ++destination) {
+        beliefOffsets.push_back(entriesBegin + other.beliefOffsets[destination] - otherEntriesBegin);
+    }
+    values.insert(values.end(), other.values.begin() + firstDestination, other.values.end());
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::PendingDestinations::getBelief(
+    uint64_t destination) const {
+    return BeliefView(beliefEntries, beliefOffsets[destination], beliefOffsets[destination + 1]);
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 void BeliefManager<PomdpType, BeliefValueType, StateType>::setRewardModel(std::optional<std::string> rewardModelName) {
     if (rewardModelName) {
@@ -221,7 +259,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-    return beliefs.size();
+    return beliefOffsets.size() - 1;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -248,25 +286,90 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+void BeliefManager<PomdpType, BeliefValueType, StateType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    if (numberOfThreads > 1) {
+        threadPool = std::make_unique<storm::utility::ThreadPool>(numberOfThreads);
+    } else {
+        threadPool.reset();
+    }
+    expansionBuffers.resize(std::max<uint64_t>(numberOfThreads, 1));
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfThreads() const {
+    return threadPool ? threadPool->getNumberOfThreads() : 1;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::precomputeExpansions(std::vector<BeliefId> const &beliefIds,
+                                                                                std::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+    precomputedExpansions.clear();
+    precomputedExpansionsResolutions = observationResolutions;
+
+    // Gather the belief action pairs to expand.
+    std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+    std::vector<PendingDestinations *> results;
+    for (auto const &beliefId : beliefIds) {
+        auto &expansions = precomputedExpansions[beliefId];
+        if (expansions.empty()) {
+            expansions.resize(getBeliefNumberOfChoices(beliefId));
+            for (uint64_t action = 0; action < expansions.size(); ++action) {
+                beliefActionPairs.emplace_back(beliefId, action);
+                results.push_back(&expansions[action]);
+            }
+        }
+    }
+
+    // Expanding only reads the stored beliefs. Hence, each thread can process its pairs independently (with its own buffers).
+    auto expandPairs = [this, &beliefActionPairs, &results](uint64_t begin, uint64_t end, uint64_t chunkIndex) {
+        STORM_LOG_ASSERT(chunkIndex < expansionBuffers.size(), "No expansion buffers for chunk " << chunkIndex << ".");
+        for (uint64_t i = begin; i < end; ++i) {
+            computeDestinations(getBelief(beliefActionPairs[i].first), beliefActionPairs[i].second, precomputedExpansionsResolutions,
+                                expansionBuffers[chunkIndex], *results[i]);
+        }
+    };
+    if (threadPool) {
+        threadPool->processInParallel(0, beliefActionPairs.size(), expandPairs);
+    } else {
+        expandPairs(0, beliefActionPairs.size(), 0);
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPrecomputedExpansion(
+    BeliefId const &beliefId, std::optional<std::vector<BeliefValueType>> const &observationResolutions) const {
+    return precomputedExpansions.count(beliefId) > 0 && precomputedExpansionsResolutions == observationResolutions;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    return BeliefView(beliefEntries, beliefOffsets[id], beliefOffsets[id + 1]);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
-    BeliefType const &belief) const {
+    BeliefView const &belief) const {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-    return idIt->second;
+    STORM_LOG_ASSERT(obs < beliefIdTables.size(), "Belief has unknown observation.");
+    auto const &table = beliefIdTables[obs];
+    STORM_LOG_ASSERT(!table.empty(), "Unknown Belief.");
+    uint64_t fingerprint = BeliefHash()(belief);
+    uint64_t const mask = table.size() - 1;
+    for (uint64_t slot = fingerprint & mask; table[slot] != noId(); slot = (slot + 1) & mask) {
+        if (beliefFingerprints[table[slot]] == fingerprint && Belief_equal_to()(getBelief(table[slot]), belief)) {
+            return table[slot];
+        }
+    }
+    STORM_LOG_ASSERT(false, "Unknown Belief.");
+    return noId();
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+template<typename BeliefRangeType>
+std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefRangeType const &belief) const {
     std::stringstream str;
     str << "{ ";
     bool first = true;
@@ -283,7 +386,8 @@ std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(Belie
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const {
     if (first.size() != second.size()) {
         return false;
     }
@@ -301,7 +405,8 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType co
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+template<typename BeliefRangeType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefRangeType const &belief) const {
     auto sum = storm::utility::zero<BeliefValueType>();
     std::optional<uint32_t> observation;
     for (auto const &entry : belief) {
@@ -342,34 +447,31 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefTy
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
-    if (triangulation.weights.size() != triangulation.gridPoints.size()) {
-        STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
-        return false;
-    }
-    if (triangulation.size() == 0) {
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefView const &belief, PendingDestinations const &triangulation,
+                                                                               uint64_t firstDestination) const {
+    if (triangulation.size() <= firstDestination) {
         STORM_LOG_ERROR("Empty triangulation.");
         return false;
     }
     BeliefType triangulatedBelief;
     auto weightSum = storm::utility::zero<BeliefValueType>();
-    for (uint64_t i = 0; i < triangulation.weights.size(); ++i) {
-        if (cc.isZero(triangulation.weights[i])) {
+    for (uint64_t i = firstDestination; i < triangulation.size(); ++i) {
+        BeliefValueType const &weight = triangulation.values[i];
+        if (cc.isZero(weight)) {
             STORM_LOG_ERROR("Zero weight in triangulation.");
             return false;
         }
-        if (cc.isLess(triangulation.weights[i], storm::utility::zero<BeliefValueType>())) {
+        if (cc.isLess(weight, storm::utility::zero<BeliefValueType>())) {
             STORM_LOG_ERROR("Negative weight in triangulation.");
             return false;
         }
-        if (cc.isLess(storm::utility::one<BeliefValueType>(), triangulation.weights[i])) {
+        if (cc.isLess(storm::utility::one<BeliefValueType>(), weight)) {
             STORM_LOG_ERROR("Weight greater than one in triangulation.");
         }
-        weightSum += triangulation.weights[i];
-        BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-        for (auto const &pointEntry : gridPoint) {
+        weightSum += weight;
+        for (auto const &pointEntry : triangulation.getBelief(i)) {
             BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<BeliefValueType>()).first->second;
-            triangulatedValue += triangulation.weights[i] * pointEntry.second;
+            triangulatedValue += weight * pointEntry.second;
         }
     }
     if (!cc.isOne(weightSum)) {
@@ -387,14 +489,15 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+template<typename BeliefRangeType>
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefRangeType const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution,
+                                                                                        ExpansionBuffers &buffers, PendingDestinations &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -402,56 +505,59 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
     // Probabilities will be triangulated to values in 0/N, 1/N, 2/N, ..., N/N
     // Variable names are mostly based on the paper
     // However, we speed this up a little by exploiting that belief states usually have sparse support (i.e. numEntries is much smaller than
-    // pomdp.getNumberOfStates()). Initialize diffs and the first row of the 'qs' matrix (aka v)
-    std::set<FreudenthalDiff, std::greater<>> sorted_diffs;  // d (and p?) in the paper
-    std::vector<BeliefValueType> qsRow;                      // Row of the 'qs' matrix from the paper (initially corresponds to v
-    qsRow.reserve(numEntries);
-    std::vector<StateType> toOriginalIndicesMap;  // Maps 'local' indices to the original pomdp state indices
-    toOriginalIndicesMap.reserve(numEntries);
+    // pomdp.getNumberOfStates()). We work with local indices, i.e., the j-th entry of the belief corresponds to dimension j.
+    // Instead of the rows of the 'qs' matrix from the paper, we keep the current vertex (qs[j] - qs[j+1] for all j). Moving to the next row of the
+    // 'qs' matrix increments a single entry of the row and thus only changes two entries of the vertex.
+    auto &sortedDiffs = buffers.freudenthalDiffs;  // d (and p?) in the paper
+    auto &vertex = buffers.freudenthalVertex;      // Initially corresponds to v[j] - v[j+1]
+    sortedDiffs.clear();
+    vertex.resize(numEntries);
     BeliefValueType x = resolution;
-    for (auto const &entry : belief) {
-        qsRow.push_back(storm::utility::floor(x));                            // v
-        sorted_diffs.emplace(toOriginalIndicesMap.size(), x - qsRow.back());  // x-v
-        toOriginalIndicesMap.push_back(entry.first);
-        x -= entry.second * resolution;
-    }
-    // Insert a dummy 0 column in the qs matrix so the loops below are a bit simpler
-    qsRow.push_back(storm::utility::zero<BeliefValueType>());
-
-    result.weights.reserve(numEntries);
-    result.gridPoints.reserve(numEntries);
-    auto currentSortedDiff = sorted_diffs.begin();
-    auto previousSortedDiff = sorted_diffs.end();
-    --previousSortedDiff;
-    for (StateType i = 0; i < numEntries; ++i) {
+    BeliefValueType previousV = storm::utility::floor(x);
+    sortedDiffs.emplace_back(0, x - previousV);  // x-v
+    x -= belief.begin()->second * resolution;
+    for (StateType j = 1; j < numEntries; ++j) {
+        BeliefValueType v = storm::utility::floor(x);  // v
+        vertex[j - 1] = previousV - v;
+        sortedDiffs.emplace_back(j, x - v);
+        previousV = std::move(v);
+        x -= belief.begin()[j].second * resolution;
+    }
+    vertex[numEntries - 1] = std::move(previousV);
+    std::sort(sortedDiffs.begin(), sortedDiffs.end(), std::greater<>());
+
+    auto previousSortedDiff = sortedDiffs.end() - 1;
+    for (auto currentSortedDiff = sortedDiffs.begin(); currentSortedDiff != sortedDiffs.end(); ++currentSortedDiff) {
         // Compute the weight for the grid points
         BeliefValueType weight = previousSortedDiff->diff - currentSortedDiff->diff;
-        if (i == 0) {
+        if (currentSortedDiff == sortedDiffs.begin()) {
             // The first weight is a bit different
             weight += storm::utility::one<BeliefValueType>();
         } else {
-            // 'compute' the next row of the qs matrix
-            qsRow[previousSortedDiff->dimension] += storm::utility::one<BeliefValueType>();
+            // 'compute' the next row of the qs matrix and update the vertex accordingly
+            StateType dimension = previousSortedDiff->dimension;
+            vertex[dimension] += storm::utility::one<BeliefValueType>();
+            if (dimension > 0) {
+                vertex[dimension - 1] -= storm::utility::one<BeliefValueType>();
+            }
         }
         if (!cc.isZero(weight)) {
-            result.weights.push_back(weight);
-            // Compute the grid point
-            BeliefType gridPoint;
+            // Add the grid point. As the original indices are ordered, so are the entries of the grid point.
             for (StateType j = 0; j < numEntries; ++j) {
-                BeliefValueType gridPointEntry = qsRow[j] - qsRow[j + 1];
-                if (!cc.isZero(gridPointEntry)) {
-                    gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
+                if (!cc.isZero(vertex[j])) {
+                    result.beliefEntries.emplace_back(belief.begin()[j].first, vertex[j] / resolution);
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.beliefOffsets.push_back(result.beliefEntries.size());
+            result.values.push_back(weight);
         }
-        previousSortedDiff = currentSortedDiff++;
+        previousSortedDiff = currentSortedDiff;
     }
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution,
+                                                                                    ExpansionBuffers &buffers, PendingDestinations &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -485,97 +591,212 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
     STORM_LOG_TRACE("Picking resolution " << finalResolution << " for belief " << toString(belief));
 
     // do standard freudenthal with the found resolution
-    triangulateBeliefFreudenthal(belief, finalResolution, result);
+    triangulateBeliefFreudenthal(belief, finalResolution, buffers, result);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution,
+                                                                             ExpansionBuffers &buffers, PendingDestinations &result) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
-        result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
-    } else {
-        auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
-        switch (triangulationMode) {
-            case TriangulationMode::Static:
-                triangulateBeliefFreudenthal(belief, ceiledResolution, result);
-                break;
-            case TriangulationMode::Dynamic:
-                triangulateBeliefDynamic(belief, ceiledResolution, result);
-                break;
-            default:
-                STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
+        result.beliefEntries.insert(result.beliefEntries.end(), belief.begin(), belief.end());
+        result.beliefOffsets.push_back(result.beliefEntries.size());
+        result.values.push_back(storm::utility::one<BeliefValueType>());
+        return;
+    }
+
+    // Look up the triangulation in the cache. Since the belief has to match exactly, the result does not depend on the cache contents.
+    TriangulationCacheEntry *cacheEntry = nullptr;
+    std::size_t hash = 0;
+    if (belief.size() <= maxCachedBeliefSize) {
+        if (buffers.triangulationCache.empty()) {
+            buffers.triangulationCache.resize(triangulationCacheSize);
+        }
+        hash = BeliefHash()(belief);
+        boost::hash_combine(hash, resolution);
+        cacheEntry = &buffers.triangulationCache[hash & (triangulationCacheSize - 1)];
+        if (cacheEntry->hasTriangulation && cacheEntry->hash == hash && cacheEntry->resolution == resolution &&
+            std::equal(belief.begin(), belief.end(), cacheEntry->belief.begin(), cacheEntry->belief.end())) {
+            result.append(cacheEntry->triangulation);
+            return;
+        }
+    }
+
+    uint64_t firstDestination = result.size();
+    auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
+    switch (triangulationMode) {
+        case TriangulationMode::Static:
+            triangulateBeliefFreudenthal(belief, ceiledResolution, buffers, result);
+            break;
+        case TriangulationMode::Dynamic:
+            triangulateBeliefDynamic(belief, ceiledResolution, buffers, result);
+            break;
+        default:
+            STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
+    }
+
+    if (cacheEntry) {
+        if (cacheEntry->hash == hash && !cacheEntry->hasTriangulation) {
+            // This is the second request in a row for this slot, so we store the triangulation.
+            cacheEntry->hasTriangulation = true;
+            cacheEntry->resolution = resolution;
+            cacheEntry->belief.assign(belief.begin(), belief.end());
+            cacheEntry->triangulation.clear();
+            cacheEntry->triangulation.append(result, firstDestination);
+        } else if (cacheEntry->hash != hash) {
+            cacheEntry->hash = hash;
+            cacheEntry->hasTriangulation = false;
         }
     }
-    STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
-    return result;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
-                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
-                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
-    std::vector<std::pair<BeliefId, ValueType>> destinations;
-
-    BeliefType belief = getBelief(beliefId);
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefView const &belief, BeliefValueType const &resolution) {
+    pendingDestinations.clear();
+    triangulateBelief(belief, resolution, expansionBuffers.front(), pendingDestinations);
+    STORM_LOG_ASSERT(assertTriangulation(belief, pendingDestinations, 0), "Incorrect triangulation of belief " << toString(belief) << ".");
+    Triangulation result;
+    result.gridPoints.reserve(pendingDestinations.size());
+    for (uint64_t i = 0; i < pendingDestinations.size(); ++i) {
+        result.gridPoints.push_back(getOrAddBeliefId(pendingDestinations.getBelief(i)));
+    }
+    result.weights = pendingDestinations.values;
+    return result;
+}
 
-    // Find the probability we go to each observation
-    BeliefType successorObs;  // This is actually not a belief but has the same type
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+template<typename SuccessorFunctionType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex, ExpansionBuffers &buffers,
+                                                                                   SuccessorFunctionType const &successorFunction) const {
+    auto &successorEntryBuffer = buffers.successorEntries;
+    auto &successorBeliefBuffer = buffers.successorBelief;
+    // Gather the successor states together with their observation and the probability to reach them.
+    successorEntryBuffer.clear();
     for (auto const &pointEntry : belief) {
         uint64_t state = pointEntry.first;
         for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
             if (!storm::utility::isZero(pomdpTransition.getValue())) {
-                auto obs = pomdp.getObservation(pomdpTransition.getColumn());
-                addToDistribution(successorObs, obs, pointEntry.second * storm::utility::convertNumber<BeliefValueType>(pomdpTransition.getValue()));
+                successorEntryBuffer.push_back({pomdp.getObservation(pomdpTransition.getColumn()), pomdpTransition.getColumn(),
+                                                pointEntry.second * storm::utility::convertNumber<BeliefValueType>(pomdpTransition.getValue()),
+                                                successorEntryBuffer.size()});
             }
         }
     }
-    adjustDistribution(successorObs);
-
-    // Now for each successor observation we find and potentially triangulate the successor belief
-    for (auto const &successor : successorObs) {
-        BeliefType successorBelief;
-        for (auto const &pointEntry : belief) {
-            uint64_t state = pointEntry.first;
-            for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
-                if (pomdp.getObservation(pomdpTransition.getColumn()) == successor.first) {
-                    BeliefValueType prob = pointEntry.second * storm::utility::convertNumber<BeliefValueType>(pomdpTransition.getValue()) / successor.second;
-                    addToDistribution(successorBelief, pomdpTransition.getColumn(), prob);
-                }
-            }
+    // Group the successors by observation. Within each group, the successors remain in the order in which they were encountered.
+    std::sort(successorEntryBuffer.begin(), successorEntryBuffer.end(), [](SuccessorEntry const &lhs, SuccessorEntry const &rhs) {
+        return lhs.observation < rhs.observation || (lhs.observation == rhs.observation && lhs.index < rhs.index);
+    });
+    bool singleObservation = successorEntryBuffer.empty() || successorEntryBuffer.front().observation == successorEntryBuffer.back().observation;
+
+    // Now for each successor observation we compute the successor belief
+    for (auto groupBegin = successorEntryBuffer.begin(); groupBegin != successorEntryBuffer.end();) {
+        uint32_t successorObservation = groupBegin->observation;
+        // Find the probability we go to the observation
+        auto successorObservationProbability = storm::utility::zero<BeliefValueType>();
+        auto groupEnd = groupBegin;
+        for (; groupEnd != successorEntryBuffer.end() && groupEnd->observation == successorObservation; ++groupEnd) {
+            successorObservationProbability += groupEnd->value;
+        }
+        if (singleObservation && cc.isEqual(successorObservationProbability, storm::utility::one<BeliefValueType>())) {
+            // If there is only one successor observation and its probability is sufficiently close to 1, make it exactly 1 to avoid numerical problems
+            successorObservationProbability = storm::utility::one<BeliefValueType>();
         }
-        adjustDistribution(successorBelief);
-        STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
 
-        // Insert the destination. We know that destinations have to be disjoint since they have different observations
-        if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
-            for (size_t j = 0; j < triangulation.size(); ++j) {
-                // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
-                destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
-            }
-        } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
-                                                       storm::storage::BitVector(pomdp.getNumberOfStates()));
-            if (clipping.isClippable) {
-                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
-                destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
+        // Sort the successors by state and sum up the probabilities of equal states
+        std::sort(groupBegin, groupEnd, [](SuccessorEntry const &lhs, SuccessorEntry const &rhs) {
+            return lhs.state < rhs.state || (lhs.state == rhs.state && lhs.index < rhs.index);
+        });
+        successorBeliefBuffer.clear();
+        for (auto entryIt = groupBegin; entryIt != groupEnd; ++entryIt) {
+            BeliefValueType prob = entryIt->value / successorObservationProbability;
+            if (!successorBeliefBuffer.empty() && successorBeliefBuffer.back().first == entryIt->state) {
+                successorBeliefBuffer.back().second += prob;
             } else {
-                // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+                successorBeliefBuffer.emplace_back(entryIt->state, prob);
             }
-        } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
         }
+        adjustDistribution(successorBeliefBuffer);
+        BeliefView successorBeliefView(successorBeliefBuffer, 0, successorBeliefBuffer.size());
+        STORM_LOG_ASSERT(assertBelief(successorBeliefView), "Invalid successor belief.");
+
+        successorFunction(successorObservation, successorObservationProbability, successorBeliefView);
+        groupBegin = groupEnd;
     }
+}
 
-    return destinations;
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::computeDestinations(BeliefView const &belief, uint64_t actionIndex,
+                                                                               std::optional<std::vector<BeliefValueType>> const &observationResolutions,
+                                                                               ExpansionBuffers &buffers, PendingDestinations &result) const {
+    result.clear();
+    // The destinations are disjoint since they have different observations
+    computeSuccessorBeliefs(belief, actionIndex, buffers,
+                            [this, &observationResolutions, &buffers, &result](uint32_t observation, BeliefValueType const &observationProbability,
+                                                                               BeliefView const &successorBeliefView) {
+                                if (observationResolutions) {
+                                    uint64_t firstGridPoint = result.size();
+                                    triangulateBelief(successorBeliefView, observationResolutions.value()[observation], buffers, result);
+                                    STORM_LOG_ASSERT(assertTriangulation(successorBeliefView, result, firstGridPoint),
+                                                     "Incorrect triangulation of belief " << toString(successorBeliefView) << ".");
+                                    // Here we additionally assume that the triangulation does not contain the same grid point multiple times
+                                    for (uint64_t i = firstGridPoint; i < result.size(); ++i) {
+                                        result.values[i] *= observationProbability;
+                                    }
+                                } else {
+                                    result.beliefEntries.insert(result.beliefEntries.end(), successorBeliefView.begin(), successorBeliefView.end());
+                                    result.beliefOffsets.push_back(result.beliefEntries.size());
+                                    result.values.push_back(observationProbability);
+                                }
+                            });
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::registerDestinations(PendingDestinations const &destinations) {
+    std::vector<std::pair<BeliefId, ValueType>> result;
+    result.reserve(destinations.size());
+    for (uint64_t i = 0; i < destinations.size(); ++i) {
+        result.emplace_back(getOrAddBeliefId(destinations.getBelief(i)), storm::utility::convertNumber<ValueType>(destinations.values[i]));
+    }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId,
+                      typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                     std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions,
+                                                                     std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
+    if (observationGridClippingResolutions) {
+        std::vector<std::pair<BeliefId, ValueType>> destinations;
+        computeSuccessorBeliefs(getBelief(beliefId), actionIndex, expansionBuffers.front(),
+                                [this, &observationGridClippingResolutions, &destinations](uint32_t observation, BeliefValueType const &observationProbability,
+                                                                                          BeliefView const &successorBeliefView) {
+                                    BeliefClipping clipping = clipBeliefToGrid(successorBeliefView, observationGridClippingResolutions.value()[observation],
+                                                                               storm::storage::BitVector(pomdp.getNumberOfStates()));
+                                    if (clipping.isClippable) {
+                                        BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * observationProbability;
+                                        destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
+                                    } else {
+                                        // Belief on Grid
+                                        destinations.emplace_back(getOrAddBeliefId(successorBeliefView),
+                                                                  storm::utility::convertNumber<ValueType>(observationProbability));
+                                    }
+                                });
+        return destinations;
+    }
+
+    // Take the precomputed expansion, if available. Registering its beliefs yields the same ids as a regular expansion.
+    auto precomputed = precomputedExpansions.find(beliefId);
+    if (precomputed != precomputedExpansions.end() && precomputedExpansionsResolutions == observationTriangulationResolutions) {
+        STORM_LOG_ASSERT(actionIndex < precomputed->second.size(), "Action index " << actionIndex << " is out of range.");
+        return registerDestinations(precomputed->second[actionIndex]);
+    }
+    computeDestinations(getBelief(beliefId), actionIndex, observationTriangulationResolutions, expansionBuffers.front(), pendingDestinations);
+    return registerDestinations(pendingDestinations);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -588,9 +809,9 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping Be
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
-    BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
+    BeliefView const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(obs < beliefIdTables.size(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -759,8 +980,9 @@ template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::computeInitialBelief() {
     STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() < 2, "POMDP contains more than one initial state");
     STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() == 1, "POMDP does not contain an initial state");
-    BeliefType belief;
-    belief[*pomdp.getInitialStates().begin()] = storm::utility::one<BeliefValueType>();
+    beliefBuffer.clear();
+    beliefBuffer.emplace_back(*pomdp.getInitialStates().begin(), storm::utility::one<BeliefValueType>());
+    BeliefView belief(beliefBuffer, 0, beliefBuffer.size());
 
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid initial belief.");
     return getOrAddBeliefId(belief);
@@ -768,17 +990,54 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
-    BeliefType const &belief) {
+    BeliefView const &belief) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    STORM_LOG_ASSERT(obs < beliefIdTables.size(), "Belief has unknown observation.");
+    // Keep the load factor of the table below 1/2
+    if (2 * (beliefIdTableLoads[obs] + 1) > beliefIdTables[obs].size()) {
+        growBeliefIdTable(obs);
+    }
+    auto &table = beliefIdTables[obs];
+    uint64_t fingerprint = BeliefHash()(belief);
+    uint64_t const mask = table.size() - 1;
+    uint64_t slot = fingerprint & mask;
+    for (; table[slot] != noId(); slot = (slot + 1) & mask) {
+        if (beliefFingerprints[table[slot]] == fingerprint && Belief_equal_to()(getBelief(table[slot]), belief)) {
+            return table[slot];
+        }
+    }
+    // The belief is new. Note that the given belief can not refer to the stored entries as these beliefs would have been found.
+    BeliefId id = getNumberOfBeliefIds();
+    STORM_LOG_TRACE("Add Belief " << id << " " << toString(belief));
+    beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+    beliefOffsets.push_back(beliefEntries.size());
+    beliefFingerprints.push_back(fingerprint);
+    table[slot] = id;
+    ++beliefIdTableLoads[obs];
+    return id;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
+    BeliefType const &belief) {
+    beliefBuffer.assign(belief.begin(), belief.end());
+    return getOrAddBeliefId(BeliefView(beliefBuffer, 0, beliefBuffer.size()));
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::growBeliefIdTable(uint32_t observation) {
+    std::vector<BeliefId> newTable(std::max<uint64_t>(16, 2 * beliefIdTables[observation].size()), noId());
+    uint64_t const mask = newTable.size() - 1;
+    for (auto const &id : beliefIdTables[observation]) {
+        if (id != noId()) {
+            uint64_t slot = beliefFingerprints[id] & mask;
+            while (newTable[slot] != noId()) {
+                slot = (slot + 1) & mask;
+            }
+            newTable[slot] = id;
+        }
     }
-    // Return the id
-    return insertioRes.first->second;
+    beliefIdTables[observation] = std::move(newTable);
 }
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
@@ -801,7 +1060,7 @@ std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(const BeliefType &belief) {
+std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(BeliefView const &belief) {
     std::vector<BeliefValueType> res(pomdp.getNumberOfStates(), storm::utility::zero<BeliefValueType>());
     for (auto const &stateprob : belief) {
         res[stateprob.first] = stateprob.second;
@@ -2,6 +2,7 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -13,6 +14,9 @@
 #include "storm/utility/solver.h"
 
 namespace storm {
+namespace utility {
+class ThreadPool;
+}
 namespace storage {
 // Forward declaration
 template<typename ValueType>
@@ -30,6 +34,8 @@ class BeliefManager {
 
     BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode);
 
+    ~BeliefManager();
+
     void setRewardModel(std::optional<std::string> rewardModelName = std::nullopt);
 
     void unsetRewardModel();
@@ -93,6 +99,31 @@ class BeliefManager {
 
     std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+    /*!
+     * Sets the number of threads that are used to precompute expansions (see precomputeExpansions).
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Concurrently expands the given beliefs under all their actions. If resolutions are given, the successor beliefs are also triangulated.
+     * The successor beliefs (or grid points) are not registered at this point. Instead, the results are stored and taken by subsequent calls of
+     * expand (or expandAndTriangulate with the same resolutions), which register the successor beliefs in the same way as a regular expansion.
+     * Hence, the assigned belief ids (and thus explored belief MDPs) do not depend on the number of threads.
+     * Expansions that have been precomputed previously are dropped.
+     *
+     * @param beliefIds The beliefs to expand
+     * @param observationResolutions If given, the successors are triangulated using these resolutions.
+     */
+    void precomputeExpansions(std::vector<BeliefId> const &beliefIds,
+                              std::optional<std::vector<BeliefValueType>> const &observationResolutions = std::nullopt);
+
+    /*!
+     * Returns true if the expansion of the given belief has been precomputed with the given resolutions (see precomputeExpansions).
+     */
+    bool hasPrecomputedExpansion(BeliefId const &beliefId, std::optional<std::vector<BeliefValueType>> const &observationResolutions = std::nullopt) const;
+
     BeliefClipping clipBeliefToGrid(BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite = storm::storage::BitVector());
 
     std::string getObservationLabel(BeliefId const &beliefId);
@@ -100,21 +131,52 @@ class BeliefManager {
     std::vector<BeliefValueType> computeMatrixBeliefProduct(BeliefId const &beliefId, storm::storage::SparseMatrix<BeliefValueType> &matrix);
 
    private:
+    typedef std::pair<StateType, BeliefValueType> BeliefEntryType;
+
+    /*!
+     * A view on a belief whose entries are stored consecutively (and ordered by state) within some vector.
+     * As the view refers to positions within the vector, it remains valid if further entries are appended to the vector.
+     */
+    class BeliefView {
+       public:
+        BeliefView(std::vector<BeliefEntryType> const &storage, uint64_t beginIndex, uint64_t endIndex)
+            : storage(&storage), beginIndex(beginIndex), endIndex(endIndex) {
+            // Intentionally left empty
+        }
+
+        BeliefEntryType const *begin() const {
+            return storage->data() + beginIndex;
+        }
+
+        BeliefEntryType const *end() const {
+            return storage->data() + endIndex;
+        }
+
+        uint64_t size() const {
+            return endIndex - beginIndex;
+        }
+
+       private:
+        std::vector<BeliefEntryType> const *storage;
+        uint64_t beginIndex;
+        uint64_t endIndex;
+    };
+
     std::vector<BeliefValueType> getBeliefAsVector(BeliefId const &beliefId);
 
-    std::vector<BeliefValueType> getBeliefAsVector(const BeliefType &belief);
+    std::vector<BeliefValueType> getBeliefAsVector(BeliefView const &belief);
 
-    BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
+    BeliefClipping clipBeliefToGrid(BeliefView const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
     void adjustDistribution(DistributionType &distr);
 
     struct BeliefHash {
-        std::size_t operator()(const BeliefType &belief) const;
+        std::size_t operator()(BeliefView const &belief) const;
     };
 
     struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+        bool operator()(BeliefView const &lhBelief, BeliefView const &rhBelief) const;
     };
 
     struct FreudenthalDiff {
@@ -125,25 +187,122 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    /*!
+     * A successor state reached when expanding a belief, together with its observation, the probability to reach it, and
+     * the position at which it was encountered (to sum up probabilities in a deterministic order).
+     */
+    struct SuccessorEntry {
+        uint32_t observation;
+        StateType state;
+        BeliefValueType value;
+        uint64_t index;
+    };
+
+    /*!
+     * Destinations of an expansion (or triangulation) whose beliefs are not registered, yet.
+     * The i-th destination is the belief consisting of the entries in [beliefOffsets[i], beliefOffsets[i+1]). It is reached with probability
+     * (or has weight) values[i].
+     */
+    struct PendingDestinations {
+        uint64_t size() const;
+        void clear();
+        BeliefView getBelief(uint64_t destination) const;
+
+        /*!
+         * Appends the destinations of the given other destinations, starting with the given one.
+         */
+        void append(PendingDestinations const &other, uint64_t firstDestination = 0);
+
+        std::vector<BeliefEntryType> beliefEntries;
+        std::vector<uint64_t> beliefOffsets = {0};
+        std::vector<BeliefValueType> values;
+    };
+
+    /*!
+     * A slot of the (direct-mapped) cache for triangulations. To only memoize triangulations that are requested frequently, a triangulation is
+     * stored once the same belief and resolution were requested twice in a row for the slot. Until then, the slot only holds the hash of the request.
+     */
+    struct TriangulationCacheEntry {
+        std::size_t hash = 0;
+        bool hasTriangulation = false;
+        BeliefValueType resolution;
+        std::vector<BeliefEntryType> belief;
+        PendingDestinations triangulation;
+    };
+
+    /*!
+     * Buffers that are reused to avoid allocations when expanding and triangulating beliefs. Each thread uses its own buffers.
+     */
+    struct ExpansionBuffers {
+        std::vector<SuccessorEntry> successorEntries;
+        std::vector<BeliefEntryType> successorBelief;
+        // The diffs (sorted decreasingly) and the current vertex of the Freudenthal triangulation
+        std::vector<FreudenthalDiff> freudenthalDiffs;
+        std::vector<BeliefValueType> freudenthalVertex;
+        std::vector<TriangulationCacheEntry> triangulationCache;
+    };
+
+    // The number of slots of the triangulation cache (a power of two) and the maximal size of beliefs whose triangulations are cached.
+    static constexpr uint64_t triangulationCacheSize = 1024;
+    static constexpr uint64_t maxCachedBeliefSize = 32;
+
+    BeliefView getBelief(BeliefId const &id) const;
+
+    BeliefId getId(BeliefView const &belief) const;
+
+    template<typename BeliefRangeType>
+    std::string toString(BeliefRangeType const &belief) const;
+
+    template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+    bool isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const;
+
+    template<typename BeliefRangeType>
+    bool assertBelief(BeliefRangeType const &belief) const;
 
-    BeliefId getId(BeliefType const &belief) const;
+    /*!
+     * Checks that the destinations starting at the given index form a valid triangulation of the given belief.
+     */
+    bool assertTriangulation(BeliefView const &belief, PendingDestinations const &triangulation, uint64_t firstDestination) const;
 
-    std::string toString(BeliefType const &belief) const;
+    template<typename BeliefRangeType>
+    uint32_t getBeliefObservation(BeliefRangeType const &belief) const;
 
-    bool isEqual(BeliefType const &first, BeliefType const &second) const;
+    /*!
+     * Appends the Freudenthal triangulation of the given belief to the given destinations. Only uses the given buffers as scratch space.
+     */
+    void triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers,
+                                      PendingDestinations &result) const;
 
-    bool assertBelief(BeliefType const &belief) const;
+    void triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers, PendingDestinations &result) const;
 
-    bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+    /*!
+     * Appends the grid points of the triangulation of the given belief (together with their weights) to the given destinations.
+     * Triangulations of frequently requested beliefs are memoized in the cache of the given buffers.
+     */
+    void triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution, ExpansionBuffers &buffers, PendingDestinations &result) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    Triangulation triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution);
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    /*!
+     * Computes the successor beliefs of the given belief under the given action. For each successor observation, the given function is called with
+     * the observation, the probability to observe it, and the successor belief.
+     * The given buffers are used to avoid allocations. Only reads the data of this manager and can thus be called concurrently (with different buffers).
+     */
+    template<typename SuccessorFunctionType>
+    void computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex, ExpansionBuffers &buffers,
+                                 SuccessorFunctionType const &successorFunction) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    /*!
+     * Computes the (optionally triangulated) destinations of the given belief under the given action without registering any beliefs.
+     * Only reads the data of this manager and can thus be called concurrently (with different buffers and results).
+     */
+    void computeDestinations(BeliefView const &belief, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationResolutions,
+                             ExpansionBuffers &buffers, PendingDestinations &result) const;
 
-    Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+    /*!
+     * Registers the beliefs of the given destinations (in their order) and returns the destinations with the corresponding ids.
+     */
+    std::vector<std::pair<BeliefId, ValueType>> registerDestinations(PendingDestinations const &destinations);
 
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
@@ -151,15 +310,40 @@ class BeliefManager {
 
     BeliefId computeInitialBelief();
 
+    BeliefId getOrAddBeliefId(BeliefView const &belief);
+
     BeliefId getOrAddBeliefId(BeliefType const &belief);
 
+    /*!
+     * Doubles the capacity of the table that maps beliefs with the given observation to their ids.
+     */
+    void growBeliefIdTable(uint32_t observation);
+
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    // The entries of all beliefs are stored consecutively. The belief with id i consists of the entries in [beliefOffsets[i], beliefOffsets[i+1]).
+    std::vector<BeliefEntryType> beliefEntries;
+    std::vector<uint64_t> beliefOffsets;
+    std::vector<uint64_t> beliefFingerprints;
+    // For each observation, an open addressing hash table (with linear probing) that maps the beliefs with that observation to their ids.
+    // The size of each table is a power of two and empty slots are marked with noId().
+    std::vector<std::vector<BeliefId>> beliefIdTables;
+    std::vector<uint64_t> beliefIdTableLoads;
     BeliefId initialBeliefId;
 
+    // Buffers that are reused to avoid allocations when expanding and triangulating beliefs.
+    // The i-th expansion buffers are used by the i-th thread. The first ones are also used when expanding sequentially.
+    std::vector<ExpansionBuffers> expansionBuffers;
+    std::vector<BeliefEntryType> beliefBuffer;
+    PendingDestinations pendingDestinations;
+
+    // Expansions that have been computed in advance (possibly concurrently), indexed by the belief id and the local action index.
+    // All expansions were computed with the stored triangulation resolutions (or without triangulation if these are not given).
+    std::unordered_map<BeliefId, std::vector<PendingDestinations>> precomputedExpansions;
+    std::optional<std::vector<BeliefValueType>> precomputedExpansionsResolutions;
+    std::unique_ptr<storm::utility::ThreadPool> threadPool;
+
     storm::utility::ConstantsComparator<BeliefValueType> cc;
 
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
@@ -33,6 +33,7 @@
 
 #include "storm/storage/SymbolicModelDescription.h"
 
+#include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/macros.h"
@@ -286,6 +287,42 @@ std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistribution
     return result;
 }
 
+/*!
+ * Computes the probabilities of the given property of the form P=? [phi U<=t psi] for each of the given upper time bounds (in ascending order).
+ * For CTMCs, this uses a single uniformization pass. For Markov automata, the time bounds are processed concurrently using Unif+.
+ * The upper time bound of the property itself is ignored.
+ *
+ * @return For each time bound, the probabilities of all states.
+ */
+template<typename ValueType>
+std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBoundsWithSparseEngine(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(model->getType() == storm::models::ModelType::Ctmc || model->getType() == storm::models::ModelType::MarkovAutomaton,
+                    storm::exceptions::NotSupportedException,
+                    "Computing probabilities for multiple time bounds at once is not supported for the model type " << model->getType() << ".");
+    storm::logic::Formula const& formula = task.getFormula();
+    STORM_LOG_THROW(formula.isProbabilityOperatorFormula() && formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula(),
+                    storm::exceptions::NotSupportedException,
+                    "Computing probabilities for multiple time bounds at once is only supported for time-bounded reachability properties.");
+    auto untilTask = task.substituteFormula(formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
+        // The model checker for Markov automata is not available for parametric models.
+        if constexpr (std::is_same_v<ValueType, storm::RationalFunction>) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                            "Computing probabilities for multiple time bounds at once is not supported for parametric Markov automata.");
+        } else {
+            auto ma = model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            STORM_LOG_THROW(ma->isClosed(), storm::exceptions::InvalidOperationException, "Unable to check non-closed Markov automaton.");
+            storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<ValueType>> modelchecker(*ma);
+            return modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(env, untilTask, upperBounds);
+        }
+    }
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(
+        *model->template as<storm::models::sparse::Ctmc<ValueType>>());
+    return modelchecker.computeBoundedUntilProbabilitiesForTimeBounds(env, untilTask, upperBounds);
+}
+
 template<typename ValueType>
 std::unique_ptr<storm::modelchecker::CheckResult> computeExpectedVisitingTimesWithSparseEngine(
     storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
@@ -9,6 +9,12 @@
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
 namespace storm {
 namespace automata {
@@ -50,6 +56,18 @@ AcceptanceCondition::ptr DeterministicAutomaton::getAcceptance() const {
     return acceptance;
 }
 
+DeterministicAutomaton::ptr DeterministicAutomaton::renameAPs(const std::map<std::string, std::string>& renaming) const {
+    APSet renamedAPSet;
+    for (auto const& ap : apSet.getAPs()) {
+        auto it = renaming.find(ap);
+        renamedAPSet.add(it == renaming.end() ? ap : it->second);
+    }
+    STORM_LOG_THROW(renamedAPSet.size() == apSet.size(), storm::exceptions::InvalidArgumentException, "Renaming of atomic propositions is not injective.");
+    DeterministicAutomaton::ptr result(new DeterministicAutomaton(std::move(renamedAPSet), numberOfStates, initialState, acceptance));
+    result->successors = successors;
+    return result;
+}
+
 void DeterministicAutomaton::printHOA(std::ostream& out) const {
     out << "HOA: v1\n";
 
@@ -86,6 +104,185 @@ void DeterministicAutomaton::printHOA(std::ostream& out) const {
     }
 }
 
+namespace detail {
+// Identifies the binary format. The last character is the version of the format.
+const char binaryFormatMagic[8] = {'S', 'T', 'O', 'R', 'M', 'D', 'A', '1'};
+
+// The maximal nesting depth of acceptance expressions that is accepted when reading the binary format.
+const uint64_t maxAcceptanceExpressionDepth = 1024;
+
+template<typename T>
+void writeBinaryValue(std::ostream& out, T const& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+T readBinaryValue(std::istream& in) {
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    STORM_LOG_THROW(in.good(), storm::exceptions::WrongFormatException, "Unexpected end of binary automaton.");
+    return value;
+}
+
+/*!
+ * Retrieves the number of bytes that remain to be read from the given stream.
+ * If the stream does not support seeking, the maximal value is returned.
+ */
+uint64_t getNumberOfRemainingBytes(std::istream& in) {
+    std::istream::pos_type const current = in.tellg();
+    if (current == std::istream::pos_type(-1)) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    in.seekg(0, std::ios::end);
+    std::istream::pos_type const end = in.tellg();
+    in.seekg(current);
+    STORM_LOG_THROW(in.good(), storm::exceptions::WrongFormatException, "Unable to determine the size of the binary automaton.");
+    return end == std::istream::pos_type(-1) ? std::numeric_limits<uint64_t>::max() : static_cast<uint64_t>(end - current);
+}
+
+void writeBinaryAcceptanceExpression(std::ostream& out, AcceptanceCondition::acceptance_expr::ptr const& expr) {
+    auto type = expr->getType();
+    writeBinaryValue<uint8_t>(out, static_cast<uint8_t>(type));
+    switch (type) {
+        case AcceptanceCondition::acceptance_expr::EXP_AND:
+        case AcceptanceCondition::acceptance_expr::EXP_OR:
+            writeBinaryAcceptanceExpression(out, expr->getLeft());
+            writeBinaryAcceptanceExpression(out, expr->getRight());
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_NOT:
+            writeBinaryAcceptanceExpression(out, expr->getLeft());
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_TRUE:
+        case AcceptanceCondition::acceptance_expr::EXP_FALSE:
+            break;
+        case AcceptanceCondition::acceptance_expr::EXP_ATOM: {
+            cpphoafparser::AtomAcceptance const& atom = expr->getAtom();
+            writeBinaryValue<uint8_t>(out, static_cast<uint8_t>(atom.getType()));
+            writeBinaryValue<uint8_t>(out, atom.isNegated() ? 1 : 0);
+            writeBinaryValue<uint32_t>(out, atom.getAcceptanceSet());
+            break;
+        }
+    }
+}
+
+AcceptanceCondition::acceptance_expr::ptr readBinaryAcceptanceExpression(std::istream& in, unsigned int numberOfAcceptanceSets, uint64_t depth = 0) {
+    typedef AcceptanceCondition::acceptance_expr acceptance_expr;
+    STORM_LOG_THROW(depth < maxAcceptanceExpressionDepth, storm::exceptions::WrongFormatException,
+                    "Acceptance expression in binary automaton exceeds the maximal nesting depth of " << maxAcceptanceExpressionDepth << ".");
+    switch (readBinaryValue<uint8_t>(in)) {
+        case acceptance_expr::EXP_AND: {
+            auto left = readBinaryAcceptanceExpression(in, numberOfAcceptanceSets, depth + 1);
+            return left & readBinaryAcceptanceExpression(in, numberOfAcceptanceSets, depth + 1);
+        }
+        case acceptance_expr::EXP_OR: {
+            auto left = readBinaryAcceptanceExpression(in, numberOfAcceptanceSets, depth + 1);
+            return left | readBinaryAcceptanceExpression(in, numberOfAcceptanceSets, depth + 1);
+        }
+        case acceptance_expr::EXP_NOT:
+            return !readBinaryAcceptanceExpression(in, numberOfAcceptanceSets, depth + 1);
+        case acceptance_expr::EXP_TRUE:
+            return acceptance_expr::True();
+        case acceptance_expr::EXP_FALSE:
+            return acceptance_expr::False();
+        case acceptance_expr::EXP_ATOM: {
+            uint8_t atomType = readBinaryValue<uint8_t>(in);
+            STORM_LOG_THROW(atomType == cpphoafparser::AtomAcceptance::TEMPORAL_FIN || atomType == cpphoafparser::AtomAcceptance::TEMPORAL_INF,
+                            storm::exceptions::WrongFormatException, "Invalid acceptance atom in binary automaton.");
+            bool negated = readBinaryValue<uint8_t>(in) != 0;
+            uint32_t acceptanceSet = readBinaryValue<uint32_t>(in);
+            STORM_LOG_THROW(acceptanceSet < numberOfAcceptanceSets, storm::exceptions::WrongFormatException,
+                            "Invalid acceptance set " << acceptanceSet << " in binary automaton.");
+            return acceptance_expr::Atom(std::make_shared<cpphoafparser::AtomAcceptance>(
+                static_cast<cpphoafparser::AtomAcceptance::AtomType>(atomType), acceptanceSet, negated));
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Invalid acceptance expression in binary automaton.");
+}
+}  // namespace detail
+
+void DeterministicAutomaton::writeBinary(std::ostream& out) const {
+    STORM_LOG_THROW(numberOfStates <= std::numeric_limits<uint32_t>::max(), storm::exceptions::InvalidArgumentException,
+                    "Automaton is too large for the binary format.");
+    out.write(detail::binaryFormatMagic, sizeof(detail::binaryFormatMagic));
+
+    detail::writeBinaryValue<uint32_t>(out, apSet.size());
+    for (auto const& ap : apSet.getAPs()) {
+        detail::writeBinaryValue<uint32_t>(out, ap.size());
+        out.write(ap.data(), ap.size());
+    }
+
+    detail::writeBinaryValue<uint32_t>(out, numberOfStates);
+    detail::writeBinaryValue<uint32_t>(out, initialState);
+
+    detail::writeBinaryValue<uint32_t>(out, acceptance->getNumberOfAcceptanceSets());
+    detail::writeBinaryAcceptanceExpression(out, acceptance->getAcceptanceExpression());
+    for (unsigned int i = 0; i < acceptance->getNumberOfAcceptanceSets(); ++i) {
+        storm::storage::BitVector const& acceptanceSet = acceptance->getAcceptanceSet(i);
+        for (uint64_t bitIndex = 0; bitIndex < numberOfStates; bitIndex += 64) {
+            detail::writeBinaryValue<uint64_t>(out, acceptanceSet.getAsInt(bitIndex, std::min<uint64_t>(64, numberOfStates - bitIndex)));
+        }
+    }
+
+    for (auto const& successor : successors) {
+        detail::writeBinaryValue<uint32_t>(out, successor);
+    }
+    STORM_LOG_THROW(out.good(), storm::exceptions::FileIoException, "Could not write binary automaton.");
+}
+
+DeterministicAutomaton::ptr DeterministicAutomaton::parseBinary(std::istream& in) {
+    char magic[sizeof(detail::binaryFormatMagic)];
+    in.read(magic, sizeof(magic));
+    STORM_LOG_THROW(in.good() && std::memcmp(magic, detail::binaryFormatMagic, sizeof(magic)) == 0, storm::exceptions::WrongFormatException,
+                    "Input is not a binary automaton of a supported version.");
+
+    APSet apSet;
+    uint32_t numberOfAPs = detail::readBinaryValue<uint32_t>(in);
+    STORM_LOG_THROW(numberOfAPs <= apSet.MAX_APS, storm::exceptions::WrongFormatException, "Too many atomic propositions in binary automaton.");
+    for (uint32_t i = 0; i < numberOfAPs; ++i) {
+        uint32_t nameLength = detail::readBinaryValue<uint32_t>(in);
+        STORM_LOG_THROW(nameLength <= detail::getNumberOfRemainingBytes(in), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary automaton.");
+        std::string ap(nameLength, '\0');
+        in.read(ap.data(), ap.size());
+        STORM_LOG_THROW(in.good(), storm::exceptions::WrongFormatException, "Unexpected end of binary automaton.");
+        apSet.add(ap);
+    }
+
+    uint32_t numberOfStates = detail::readBinaryValue<uint32_t>(in);
+    uint32_t initialState = detail::readBinaryValue<uint32_t>(in);
+    STORM_LOG_THROW(initialState < numberOfStates, storm::exceptions::WrongFormatException, "Invalid initial state in binary automaton.");
+
+    uint32_t numberOfAcceptanceSets = detail::readBinaryValue<uint32_t>(in);
+
+    // Make sure that the stream is large enough to hold the acceptance sets and the successors before allocating them.
+    uint64_t const remainingBytes = detail::getNumberOfRemainingBytes(in);
+    STORM_LOG_THROW(numberOfStates <= ((remainingBytes / sizeof(uint32_t)) >> numberOfAPs), storm::exceptions::WrongFormatException,
+                    "Unexpected end of binary automaton.");
+    uint64_t const successorBytes = (static_cast<uint64_t>(numberOfStates) << numberOfAPs) * sizeof(uint32_t);
+    uint64_t const acceptanceSetBytes = static_cast<uint64_t>(numberOfAcceptanceSets) * ((numberOfStates + 63) / 64) * sizeof(uint64_t);
+    STORM_LOG_THROW(acceptanceSetBytes <= remainingBytes - successorBytes, storm::exceptions::WrongFormatException, "Unexpected end of binary automaton.");
+
+    auto acceptanceExpression = detail::readBinaryAcceptanceExpression(in, numberOfAcceptanceSets);
+    AcceptanceCondition::ptr acceptance(new AcceptanceCondition(numberOfStates, numberOfAcceptanceSets, acceptanceExpression));
+    for (unsigned int i = 0; i < numberOfAcceptanceSets; ++i) {
+        storm::storage::BitVector& acceptanceSet = acceptance->getAcceptanceSet(i);
+        for (uint64_t bitIndex = 0; bitIndex < numberOfStates; bitIndex += 64) {
+            uint64_t numberOfBits = std::min<uint64_t>(64, numberOfStates - bitIndex);
+            uint64_t bits = detail::readBinaryValue<uint64_t>(in);
+            STORM_LOG_THROW(numberOfBits == 64 || (bits >> numberOfBits) == 0, storm::exceptions::WrongFormatException,
+                            "Invalid acceptance set in binary automaton.");
+            acceptanceSet.setFromInt(bitIndex, numberOfBits, bits);
+        }
+    }
+
+    DeterministicAutomaton::ptr da(new DeterministicAutomaton(std::move(apSet), numberOfStates, initialState, acceptance));
+    for (auto& successor : da->successors) {
+        successor = detail::readBinaryValue<uint32_t>(in);
+        STORM_LOG_THROW(successor < numberOfStates, storm::exceptions::WrongFormatException, "Invalid successor state in binary automaton.");
+    }
+    return da;
+}
+
 DeterministicAutomaton::ptr DeterministicAutomaton::parse(std::istream& in) {
     HOAConsumerDA::ptr consumer(new HOAConsumerDA());
     cpphoafparser::HOAIntermediateCheckValidity::ptr validator(new cpphoafparser::HOAIntermediateCheckValidity(consumer));
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <map>
 #include <memory>
 #include "storm/automata/APSet.h"
 
@@ -27,10 +28,23 @@ class DeterministicAutomaton {
 
     std::shared_ptr<AcceptanceCondition> getAcceptance() const;
 
+    /*!
+     * Creates a copy of this automaton in which the atomic propositions are renamed according to the given map.
+     * Atomic propositions that do not appear in the map keep their name.
+     */
+    DeterministicAutomaton::ptr renameAPs(const std::map<std::string, std::string>& renaming) const;
+
     void printHOA(std::ostream& out) const;
 
+    /*!
+     * Writes the automaton in a compact binary format that can be read (much faster than HOA) via parseBinary.
+     * The format is not portable across platforms with different endianness.
+     */
+    void writeBinary(std::ostream& out) const;
+
     static DeterministicAutomaton::ptr parse(std::istream& in);
     static DeterministicAutomaton::ptr parseFromFile(const std::string& filename);
+    static DeterministicAutomaton::ptr parseBinary(std::istream& in);
 
    private:
     APSet apSet;
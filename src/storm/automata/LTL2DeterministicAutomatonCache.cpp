@@ -0,0 +1,226 @@
+#include "storm/automata/LTL2DeterministicAutomatonCache.h"
+
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/logic/AtomicLabelFormula.h"
+#include "storm/logic/Formula.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <unistd.h>
+
+namespace storm {
+namespace automata {
+
+LTL2DeterministicAutomatonCache::LTL2DeterministicAutomatonCache(uint64_t capacity)
+    : capacity(capacity), numberOfMemoryHits(0), numberOfDiskHits(0), numberOfTranslations(0) {
+    // Intentionally left empty
+}
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomatonCache::translate(storm::logic::Formula const& f, std::string const& translatorId,
+                                                                                   Translator const& translator) {
+    bool cacheEnabled;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cacheEnabled = capacity > 0 || directory.is_initialized();
+        if (!cacheEnabled) {
+            ++numberOfTranslations;
+        }
+    }
+    if (!cacheEnabled) {
+        return translator(f);
+    }
+
+    std::map<std::string, std::string> normalizedToOriginal;
+    std::shared_ptr<storm::logic::Formula> normalizedFormula = normalize(f, normalizedToOriginal);
+    std::string key = translatorId + "\n" + normalizedFormula->toPrefixString();
+
+    std::shared_ptr<DeterministicAutomaton> da = lookup(key);
+    if (da) {
+        STORM_LOG_INFO("Found deterministic automaton for " << f.toPrefixString() << " in memory.");
+    } else {
+        da = load(key);
+        if (da) {
+            STORM_LOG_INFO("Loaded deterministic automaton for " << f.toPrefixString() << " from " << getFileName(key) << ".");
+            std::lock_guard<std::mutex> lock(mutex);
+            ++numberOfDiskHits;
+        } else {
+            // The translation is done without holding the lock so that independent queries do not block each other.
+            da = translator(*normalizedFormula);
+            store(key, *da);
+            std::lock_guard<std::mutex> lock(mutex);
+            ++numberOfTranslations;
+        }
+        insert(key, da);
+    }
+    return da->renameAPs(normalizedToOriginal);
+}
+
+void LTL2DeterministicAutomatonCache::setCapacity(uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = value;
+    while (entries.size() > capacity) {
+        keyToEntry.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+uint64_t LTL2DeterministicAutomatonCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return capacity;
+}
+
+void LTL2DeterministicAutomatonCache::setDirectory(boost::optional<std::string> const& value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    directory = value;
+}
+
+boost::optional<std::string> LTL2DeterministicAutomatonCache::getDirectory() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return directory;
+}
+
+void LTL2DeterministicAutomatonCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    keyToEntry.clear();
+}
+
+uint64_t LTL2DeterministicAutomatonCache::getNumberOfMemoryHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfMemoryHits;
+}
+
+uint64_t LTL2DeterministicAutomatonCache::getNumberOfDiskHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfDiskHits;
+}
+
+uint64_t LTL2DeterministicAutomatonCache::getNumberOfTranslations() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numberOfTranslations;
+}
+
+std::shared_ptr<storm::logic::Formula> LTL2DeterministicAutomatonCache::normalize(storm::logic::Formula const& f,
+                                                                                  std::map<std::string, std::string>& normalizedToOriginal) {
+    std::map<std::string, std::string> originalToNormalized;
+    for (auto const& atomicLabelFormula : f.getAtomicLabelFormulas()) {
+        std::string const& label = atomicLabelFormula->getLabel();
+        if (originalToNormalized.count(label) == 0) {
+            std::string normalizedLabel = "ap" + std::to_string(originalToNormalized.size());
+            originalToNormalized.emplace(label, normalizedLabel);
+            normalizedToOriginal.emplace(std::move(normalizedLabel), label);
+        }
+    }
+    return f.substitute(originalToNormalized);
+}
+
+LTL2DeterministicAutomatonCache& LTL2DeterministicAutomatonCache::getGlobalCache() {
+    static LTL2DeterministicAutomatonCache globalCache;
+    return globalCache;
+}
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomatonCache::lookup(std::string const& key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = keyToEntry.find(key);
+    if (it == keyToEntry.end()) {
+        return nullptr;
+    }
+    // Mark the entry as most recently used.
+    entries.splice(entries.begin(), entries, it->second);
+    ++numberOfMemoryHits;
+    return it->second->second;
+}
+
+void LTL2DeterministicAutomatonCache::insert(std::string const& key, std::shared_ptr<DeterministicAutomaton> const& da) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (capacity == 0 || keyToEntry.count(key) > 0) {
+        return;
+    }
+    entries.emplace_front(key, da);
+    keyToEntry.emplace(key, entries.begin());
+    if (entries.size() > capacity) {
+        keyToEntry.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+std::string LTL2DeterministicAutomatonCache::getFileName(std::string const& key) const {
+    // Use a hash function that is stable across platforms and builds (64 bit FNV-1a) such that the files can be shared.
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    std::stringstream fileName;
+    fileName << getDirectory().get() << "/" << std::hex << std::setw(16) << std::setfill('0') << hash << ".da";
+    return fileName.str();
+}
+
+std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomatonCache::load(std::string const& key) const {
+    if (!getDirectory()) {
+        return nullptr;
+    }
+    std::string fileName = getFileName(key);
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in.good()) {
+        return nullptr;
+    }
+    try {
+        // Each file starts with the key of the automaton to detect hash collisions.
+        uint64_t keyLength = 0;
+        in.read(reinterpret_cast<char*>(&keyLength), sizeof(keyLength));
+        if (!in.good() || keyLength != key.size()) {
+            return nullptr;
+        }
+        std::string storedKey(keyLength, '\0');
+        in.read(storedKey.data(), keyLength);
+        if (!in.good() || storedKey != key) {
+            return nullptr;
+        }
+        return DeterministicAutomaton::parseBinary(in);
+    } catch (storm::exceptions::WrongFormatException const& e) {
+        STORM_LOG_WARN("Ignoring malformed cached automaton " << fileName << ": " << e.what());
+        return nullptr;
+    }
+}
+
+void LTL2DeterministicAutomatonCache::store(std::string const& key, DeterministicAutomaton const& da) const {
+    if (!getDirectory()) {
+        return;
+    }
+    std::string fileName = getFileName(key);
+    // Write to a temporary file first and then move it in place such that concurrent runs never read partially written files.
+    std::string temporaryFileName = fileName + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream out(temporaryFileName, std::ios::binary | std::ios::trunc);
+        if (!out.good()) {
+            STORM_LOG_WARN("Could not store deterministic automaton in " << temporaryFileName << ".");
+            return;
+        }
+        uint64_t keyLength = key.size();
+        out.write(reinterpret_cast<const char*>(&keyLength), sizeof(keyLength));
+        out.write(key.data(), keyLength);
+        try {
+            da.writeBinary(out);
+        } catch (storm::exceptions::BaseException const& e) {
+            STORM_LOG_WARN("Could not store deterministic automaton in " << temporaryFileName << ": " << e.what());
+            out.close();
+            std::remove(temporaryFileName.c_str());
+            return;
+        }
+    }
+    if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+        STORM_LOG_WARN("Could not store deterministic automaton in " << fileName << ".");
+        std::remove(temporaryFileName.c_str());
+    }
+}
+
+}  // namespace automata
+}  // namespace storm
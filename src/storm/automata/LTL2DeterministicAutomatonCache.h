@@ -0,0 +1,107 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace storm {
+
+namespace logic {
+// fwd
+class Formula;
+}  // namespace logic
+
+namespace automata {
+// fwd
+class DeterministicAutomaton;
+
+/*!
+ * Caches the deterministic automata obtained from translating LTL formulas.
+ * Formulas are identified up to a renaming of their atomic propositions, i.e., two formulas that only differ in the names of their
+ * atomic propositions share a single translation.
+ * The most recently used automata are kept in memory. Additionally, automata can be stored in (and retrieved from) a directory in a
+ * compact binary format such that they can be reused across runs without calling the translator and parsing its output again.
+ */
+class LTL2DeterministicAutomatonCache {
+   public:
+    typedef std::function<std::shared_ptr<DeterministicAutomaton>(storm::logic::Formula const&)> Translator;
+
+    /*!
+     * Creates a cache that keeps (at most) the given number of automata in memory.
+     */
+    LTL2DeterministicAutomatonCache(uint64_t capacity = 0);
+
+    /*!
+     * Retrieves a deterministic automaton for the given LTL formula. If no automaton for the formula (up to renaming of its atomic propositions)
+     * is cached, the translator is invoked on a normalized version of the formula and the result is cached.
+     *
+     * @param f The LTL formula.
+     * @param translatorId Identifies the translator and its configuration. Automata obtained with different identifiers are never mixed up.
+     * @param translator The translation to invoke on cache misses.
+     * @return An automaton equivalent to the formula whose atomic propositions are named as in the formula.
+     */
+    std::shared_ptr<DeterministicAutomaton> translate(storm::logic::Formula const& f, std::string const& translatorId, Translator const& translator);
+
+    /*!
+     * Sets the number of automata kept in memory. If zero, automata are not cached in memory.
+     */
+    void setCapacity(uint64_t value);
+    uint64_t getCapacity() const;
+
+    /*!
+     * Sets the directory in which automata are stored persistently. If none is given, automata are only cached in memory.
+     */
+    void setDirectory(boost::optional<std::string> const& value);
+    boost::optional<std::string> getDirectory() const;
+
+    /*!
+     * Removes all automata from memory. Automata stored on disk are not affected.
+     */
+    void clear();
+
+    uint64_t getNumberOfMemoryHits() const;
+    uint64_t getNumberOfDiskHits() const;
+    uint64_t getNumberOfTranslations() const;
+
+    /*!
+     * Normalizes the given formula by renaming its atomic propositions in order of their first occurrence.
+     *
+     * @param f The formula.
+     * @param normalizedToOriginal Is filled with the renaming that maps the normalized names back to the original ones.
+     * @return The normalized formula.
+     */
+    static std::shared_ptr<storm::logic::Formula> normalize(storm::logic::Formula const& f, std::map<std::string, std::string>& normalizedToOriginal);
+
+    /*!
+     * Retrieves the cache that is shared by all LTL model checking queries of this process.
+     */
+    static LTL2DeterministicAutomatonCache& getGlobalCache();
+
+   private:
+    std::shared_ptr<DeterministicAutomaton> lookup(std::string const& key);
+    void insert(std::string const& key, std::shared_ptr<DeterministicAutomaton> const& da);
+    std::string getFileName(std::string const& key) const;
+    std::shared_ptr<DeterministicAutomaton> load(std::string const& key) const;
+    void store(std::string const& key, DeterministicAutomaton const& da) const;
+
+    mutable std::mutex mutex;
+    uint64_t capacity;
+    boost::optional<std::string> directory;
+
+    // The cached automata, ordered from most to least recently used.
+    std::list<std::pair<std::string, std::shared_ptr<DeterministicAutomaton>>> entries;
+    std::unordered_map<std::string, decltype(entries)::iterator> keyToEntry;
+
+    uint64_t numberOfMemoryHits;
+    uint64_t numberOfDiskHits;
+    uint64_t numberOfTranslations;
+};
+
+}  // namespace automata
+}  // namespace storm
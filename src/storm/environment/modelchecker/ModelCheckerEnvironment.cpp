@@ -1,5 +1,7 @@
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
+#include <algorithm>
+
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -17,6 +19,14 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    ltl2daCacheSize = mcSettings.getLtl2daCacheSize();
+    if (mcSettings.isLtl2daCacheDirectorySet()) {
+        ltl2daCacheDirectory = mcSettings.getLtl2daCacheDirectory();
+    }
+    numberOfEpochThreads = mcSettings.getNumberOfEpochThreads();
+    epochMemoryLimit = mcSettings.getEpochMemoryLimit();
+    exactStepBoundedEvaluation = mcSettings.isExactStepBoundedEvaluationSet();
+    numberOfGraphAnalysisThreads = mcSettings.getNumberOfGraphAnalysisThreads();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     steadyStateDistributionAlgorithm = ioSettings.getSteadyStateDistributionAlgorithm();
 }
@@ -57,4 +67,60 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+uint64_t const& ModelCheckerEnvironment::getLtl2daCacheSize() const {
+    return ltl2daCacheSize;
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheSize(uint64_t value) {
+    ltl2daCacheSize = value;
+}
+
+bool ModelCheckerEnvironment::isLtl2daCacheDirectorySet() const {
+    return ltl2daCacheDirectory.is_initialized();
+}
+
+std::string const& ModelCheckerEnvironment::getLtl2daCacheDirectory() const {
+    return ltl2daCacheDirectory.get();
+}
+
+void ModelCheckerEnvironment::setLtl2daCacheDirectory(std::string const& value) {
+    ltl2daCacheDirectory = value;
+}
+
+void ModelCheckerEnvironment::unsetLtl2daCacheDirectory() {
+    ltl2daCacheDirectory = boost::none;
+}
+
+uint64_t const& ModelCheckerEnvironment::getNumberOfEpochThreads() const {
+    return numberOfEpochThreads;
+}
+
+void ModelCheckerEnvironment::setNumberOfEpochThreads(uint64_t value) {
+    numberOfEpochThreads = std::max<uint64_t>(value, 1);
+}
+
+uint64_t const& ModelCheckerEnvironment::getEpochMemoryLimit() const {
+    return epochMemoryLimit;
+}
+
+void ModelCheckerEnvironment::setEpochMemoryLimit(uint64_t value) {
+    epochMemoryLimit = value;
+}
+
+bool ModelCheckerEnvironment::isExactStepBoundedEvaluationSet() const {
+    return exactStepBoundedEvaluation;
+}
+
+void ModelCheckerEnvironment::setExactStepBoundedEvaluation(bool value) {
+    exactStepBoundedEvaluation = value;
+}
+
+uint64_t const& ModelCheckerEnvironment::getNumberOfGraphAnalysisThreads() const {
+    return numberOfGraphAnalysisThreads;
+}
+
+void ModelCheckerEnvironment::setNumberOfGraphAnalysisThreads(uint64_t value) {
+    numberOfGraphAnalysisThreads = std::max<uint64_t>(value, 1);
+}
+
 }  // namespace storm
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -29,9 +30,38 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    uint64_t const& getLtl2daCacheSize() const;
+    void setLtl2daCacheSize(uint64_t value);
+
+    bool isLtl2daCacheDirectorySet() const;
+    std::string const& getLtl2daCacheDirectory() const;
+    void setLtl2daCacheDirectory(std::string const& value);
+    void unsetLtl2daCacheDirectory();
+
+    uint64_t const& getNumberOfEpochThreads() const;
+    void setNumberOfEpochThreads(uint64_t value);
+
+    /// The (approximate) number of bytes that stored epoch solutions may occupy before epochs are no longer analyzed concurrently. Zero means no limit.
+    uint64_t const& getEpochMemoryLimit() const;
+    void setEpochMemoryLimit(uint64_t value);
+
+    /// If set, step-bounded properties are evaluated by performing every step, i.e., without stopping once the values have converged.
+    bool isExactStepBoundedEvaluationSet() const;
+    void setExactStepBoundedEvaluation(bool value);
+
+    /// The number of threads used for the qualitative (prob0/prob1) graph analyses. With more than one thread, a layered backward search is used.
+    uint64_t const& getNumberOfGraphAnalysisThreads() const;
+    void setNumberOfGraphAnalysisThreads(uint64_t value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    uint64_t ltl2daCacheSize;
+    boost::optional<std::string> ltl2daCacheDirectory;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
+    uint64_t numberOfEpochThreads;
+    uint64_t epochMemoryLimit;
+    bool exactStepBoundedEvaluation;
+    uint64_t numberOfGraphAnalysisThreads;
 };
 }  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
+#include <algorithm>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MultiObjectiveSettings.h"
 #include "storm/utility/constants.h"
@@ -49,6 +51,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
 
     printResults = multiobjectiveSettings.isPrintResultsSet();
     useLexicographicModelChecking = multiobjectiveSettings.isLexicographicModelCheckingSet();
+    numberOfWeightVectorThreads = multiobjectiveSettings.getNumberOfWeightVectorThreads();
 }
 
 MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -196,4 +199,12 @@ bool MultiObjectiveModelCheckerEnvironment::isLexicographicModelCheckingSet() co
 void MultiObjectiveModelCheckerEnvironment::setLexicographicModelChecking(bool value) {
     useLexicographicModelChecking = value;
 }
-}  // namespace storm
\ No newline at end of file
+
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getNumberOfWeightVectorThreads() const {
+    return numberOfWeightVectorThreads;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setNumberOfWeightVectorThreads(uint64_t value) {
+    numberOfWeightVectorThreads = std::max<uint64_t>(value, 1);
+}
+}  // namespace storm
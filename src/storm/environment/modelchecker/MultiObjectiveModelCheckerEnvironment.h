@@ -72,6 +72,9 @@ class MultiObjectiveModelCheckerEnvironment {
     bool isLexicographicModelCheckingSet() const;
     void setLexicographicModelChecking(bool value);
 
+    uint64_t const& getNumberOfWeightVectorThreads() const;
+    void setNumberOfWeightVectorThreads(uint64_t value);
+
    private:
     storm::modelchecker::multiobjective::MultiObjectiveMethod method;
     boost::optional<std::string> plotPathUnderApprox, plotPathOverApprox, plotPathParetoPoints;
@@ -85,5 +88,6 @@ class MultiObjectiveModelCheckerEnvironment {
     boost::optional<storm::storage::SchedulerClass> schedulerRestriction;
     bool printResults;
     bool useLexicographicModelChecking;
+    uint64_t numberOfWeightVectorThreads;
 };
 }  // namespace storm
@@ -1,5 +1,7 @@
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 
+#include <algorithm>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/LongRunAverageSolverSettings.h"
 #include "storm/utility/constants.h"
@@ -19,6 +21,7 @@ LongRunAverageSolverEnvironment::LongRunAverageSolverEnvironment() {
         maxIters = lraSettings.getMaximalIterationCount();
     }
     aperiodicFactor = storm::utility::convertNumber<storm::RationalNumber>(lraSettings.getAperiodicFactor());
+    numberOfThreads = lraSettings.getNumberOfThreads();
 }
 
 LongRunAverageSolverEnvironment::~LongRunAverageSolverEnvironment() {
@@ -91,4 +94,12 @@ void LongRunAverageSolverEnvironment::setAperiodicFactor(storm::RationalNumber v
     aperiodicFactor = value;
 }
 
+uint64_t const& LongRunAverageSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void LongRunAverageSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = std::max<uint64_t>(value, 1);
+}
+
 }  // namespace storm
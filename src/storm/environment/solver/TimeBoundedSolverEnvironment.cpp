@@ -1,5 +1,7 @@
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 
+#include <algorithm>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/TimeBoundedSolverSettings.h"
 #include "storm/utility/constants.h"
@@ -11,9 +13,11 @@ TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     auto const& tbSettings = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>();
     maMethod = tbSettings.getMaMethod();
     maMethodSetFromDefault = tbSettings.isMaMethodSetFromDefaultValue();
+    ctmcMethod = tbSettings.getCtmcMethod();
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    numberOfThreads = tbSettings.getNumberOfThreads();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -33,6 +37,14 @@ void TimeBoundedSolverEnvironment::setMaMethod(storm::solver::MaBoundedReachabil
     maMethodSetFromDefault = isSetFromDefault;
 }
 
+storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+    return ctmcMethod;
+}
+
+void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+    ctmcMethod = value;
+}
+
 storm::RationalNumber const& TimeBoundedSolverEnvironment::getPrecision() const {
     return precision;
 }
@@ -57,4 +69,12 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+uint64_t const& TimeBoundedSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TimeBoundedSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = std::max<uint64_t>(value, 1);
+}
+
 }  // namespace storm
@@ -16,6 +16,9 @@ class TimeBoundedSolverEnvironment {
     bool const& isMaMethodSetFromDefault() const;
     void setMaMethod(storm::solver::MaBoundedReachabilityMethod value, bool isSetFromDefault = false);
 
+    storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+    void setCtmcMethod(storm::solver::CtmcTransientMethod value);
+
     storm::RationalNumber const& getPrecision() const;
     void setPrecision(storm::RationalNumber value);
     bool const& getRelativeTerminationCriterion() const;
@@ -24,13 +27,20 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
 
+    storm::solver::CtmcTransientMethod ctmcMethod;
+
     storm::RationalNumber precision;
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
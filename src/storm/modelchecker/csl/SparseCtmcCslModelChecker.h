@@ -50,6 +50,16 @@ class SparseCtmcCslModelChecker : public SparsePropositionalModelChecker<SparseC
     virtual std::unique_ptr<CheckResult> computeTotalRewards(Environment const& env,
                                                              CheckTask<storm::logic::TotalRewardFormula, ValueType> const& checkTask) override;
 
+    /*!
+     * Computes the probabilities of the given time-bounded until formula for each of the given upper time bounds (in ascending order) at once.
+     * The upper time bound of the formula itself is ignored and it must not have a lower time bound.
+     *
+     * @return For each time bound, the probabilities of all states.
+     */
+    std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env,
+                                                                                      CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask,
+                                                                                      std::vector<double> const& upperBounds);
+
     /*!
      * Compute transient probabilities for all states.
      */
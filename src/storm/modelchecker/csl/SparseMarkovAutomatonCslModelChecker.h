@@ -48,6 +48,16 @@ class SparseMarkovAutomatonCslModelChecker : public SparsePropositionalModelChec
                                                                   CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env,
                                                                     CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
+
+    /*!
+     * Computes the optimal probabilities of the given time-bounded until formula for each of the given upper time bounds at once.
+     * The upper time bound of the formula itself is ignored and it must not have a lower time bound.
+     *
+     * @return For each time bound, the probabilities of all states.
+     */
+    std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env,
+                                                                                      CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask,
+                                                                                      std::vector<double> const& upperBounds);
 };
 }  // namespace modelchecker
 }  // namespace storm
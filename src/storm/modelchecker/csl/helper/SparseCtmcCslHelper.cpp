@@ -1,11 +1,16 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <algorithm>
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/TransientProbabilityHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
@@ -21,7 +26,9 @@
 #include "storm/utility/numerical.h"
 #include "storm/utility/vector.h"
 
+#include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -274,6 +281,93 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Env
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(std::is_sorted(upperBounds.begin(), upperBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The time bounds need to be given in ascending order.");
+    STORM_LOG_THROW(upperBounds.empty() || (upperBounds.front() >= 0.0 && upperBounds.back() != storm::utility::infinity<double>()),
+                    storm::exceptions::InvalidArgumentException, "The time bounds need to be non-negative and finite.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<std::vector<ValueType>> result;
+
+    // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+    // If we identify the states that have probability 0 of reaching the target states, we can exclude them from the
+    // further computations.
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    // the positions within the result for which the precision needs to be checked
+    storm::storage::BitVector relevantValues;
+    if (goal.hasRelevantValues()) {
+        relevantValues = std::move(goal.relevantValues());
+        relevantValues &= statesWithProbabilityGreater0;
+    } else {
+        relevantValues = statesWithProbabilityGreater0;
+    }
+
+    // The uniformized matrix does not depend on the precision, so we compute it only once.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix;
+    std::vector<ValueType> b;
+    ValueType uniformizationRate = storm::utility::zero<ValueType>();
+    if (!statesWithProbabilityGreater0NonPsi.empty()) {
+        // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+        for (auto state : statesWithProbabilityGreater0NonPsi) {
+            uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+        }
+        uniformizationRate *= 1.02;
+        STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+        uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+        // Compute the vector that is to be added as a compensation for removing the absorbing states.
+        b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+        for (auto& element : b) {
+            element /= uniformizationRate;
+        }
+    }
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& bound : upperBounds) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(bound));
+    }
+
+    bool repeat;
+    do {  // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+        std::vector<std::vector<ValueType>> subresults;
+        if (!statesWithProbabilityGreater0NonPsi.empty()) {
+            std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+            subresults = computeTransientProbabilitiesForTimeBounds(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+        }
+
+        result.assign(upperBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
+        repeat = false;
+        for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+            storm::utility::vector::setVectorValues<ValueType>(result[boundIndex], psiStates, storm::utility::one<ValueType>());
+            if (!subresults.empty()) {
+                storm::utility::vector::setVectorValues(result[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+            }
+            // Note that the epsilon is decreased for all time bounds that are not yet precise enough.
+            repeat |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result[boundIndex], relevantValues);
+        }
+    } while (repeat);
+    return result;
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                       storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -664,6 +758,22 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         return values;
     }
 
+    // Check whether an alternative to standard uniformization has been selected. These are only available for transient probabilities.
+    auto const& ctmcMethod = env.solver().timeBounded().getCtmcMethod();
+    if (!useMixedPoissonProbabilities && ctmcMethod == storm::solver::CtmcTransientMethod::Krylov) {
+        return storm::solver::helper::computeTransientProbabilitiesKrylov(env, uniformizedMatrix, addVector, timeBound, uniformizationRate, values, epsilon);
+    } else if (!useMixedPoissonProbabilities && ctmcMethod == storm::solver::CtmcTransientMethod::AdaptiveUniformization) {
+        auto adaptiveResult =
+            storm::solver::helper::computeTransientProbabilitiesAdaptively(env, uniformizedMatrix, addVector, timeBound, uniformizationRate, values, epsilon);
+        if (adaptiveResult) {
+            return std::move(adaptiveResult.value());
+        }
+        STORM_LOG_INFO("Falling back to standard uniformization.");
+    }
+    STORM_LOG_WARN_COND(!useMixedPoissonProbabilities || ctmcMethod == storm::solver::CtmcTransientMethod::Uniformization,
+                        "The selected CTMC method " << storm::solver::toString(ctmcMethod)
+                                                    << " is not supported for cumulative rewards. Falling back to standard uniformization.");
+
     // Use Fox-Glynn to get the truncation points and the weights.
     storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
     STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
@@ -754,6 +864,73 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+    std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+    STORM_LOG_THROW(std::is_sorted(timeBounds.begin(), timeBounds.end()), storm::exceptions::InvalidArgumentException,
+                    "The time bounds need to be given in ascending order.");
+    STORM_LOG_INFO_COND(env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Uniformization,
+                        "Multiple time bounds are always handled by standard uniformization.");
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+
+    // Get the truncation points and the weights for each time bound. If no time can pass, the initial values are the result.
+    std::vector<std::vector<ValueType>> result(timeBounds.size());
+    std::vector<boost::optional<storm::utility::numerical::FoxGlynnResult<ValueType>>> foxGlynnResults(timeBounds.size());
+    uint64_t maxRight = 0;
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        ValueType lambda = timeBounds[boundIndex] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            result[boundIndex] = values;
+            continue;
+        }
+        foxGlynnResults[boundIndex] = storm::utility::numerical::foxGlynn(lambda, epsilon);
+        auto const& foxGlynnResult = foxGlynnResults[boundIndex].get();
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[boundIndex] << ": left=" << foxGlynnResult.left
+                                                                  << ", right=" << foxGlynnResult.right);
+        maxRight = std::max<uint64_t>(maxRight, foxGlynnResult.right);
+        if (foxGlynnResult.left == 0) {
+            result[boundIndex] = values;
+            storm::utility::vector::scaleVectorInPlace(result[boundIndex], foxGlynnResult.weights.front());
+        } else {
+            result[boundIndex] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+        }
+    }
+
+    STORM_LOG_DEBUG("Starting " << maxRight << " iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount()
+                                << " matrix for " << timeBounds.size() << " time bounds.");
+
+    // Compute the powers of the uniformized matrix once and add them (scaled with the respective weight) to the results of all time bounds whose
+    // truncation points enclose the current iteration.
+    std::vector<ValueType> currentValues = values;
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    ValueType weight = 0;
+    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight](ValueType const& a, ValueType const& b) { return a + weight * b; };
+    for (uint64_t index = 1; index <= maxRight; ++index) {
+        multiplier->multiply(env, currentValues, addVector, currentValues);
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+            if (foxGlynnResult && foxGlynnResult->left <= index && index <= foxGlynnResult->right) {
+                weight = foxGlynnResult->weights[index - foxGlynnResult->left];
+                storm::utility::vector::applyPointwise(result[boundIndex], currentValues, result[boundIndex], addAndScale);
+            }
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted computation of transient probabilities after " << index << " iterations.");
+        }
+    }
+
+    // Finally, divide the results by the total weights.
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        if (foxGlynnResults[boundIndex]) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result[boundIndex],
+                                                                             storm::utility::one<ValueType>() / foxGlynnResults[boundIndex]->totalWeight);
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -838,6 +1015,15 @@ template std::vector<double> SparseCtmcCslHelper::computeCumulativeRewards(Envir
                                                                            storm::models::sparse::StandardRewardModel<double> const& rewardModel,
                                                                            double timeBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix,
+    storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> const& values, double epsilon);
+
 template std::vector<double> SparseCtmcCslHelper::computeAllTransientProbabilities(
     Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& initialStates,
     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, double timeBound);
@@ -861,6 +1047,15 @@ template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBounde
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds);
+template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds);
+
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
@@ -1,11 +1,14 @@
 #include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 
+#include <array>
+
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -22,6 +25,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -71,10 +75,50 @@ class UnifPlusHelper {
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                             ValueType const& upperTimeBound,
                                                             boost::optional<storm::storage::BitVector> const& relevantStates = boost::none) {
+        return computeBoundedUntilProbabilities(env, dir, phiStates, psiStates, getProb0States(dir, phiStates, psiStates), upperTimeBound, relevantStates);
+    }
+
+    std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(storm::Environment const& env, OptimizationDirection dir,
+                                                                                      storm::storage::BitVector const& phiStates,
+                                                                                      storm::storage::BitVector const& psiStates,
+                                                                                      std::vector<ValueType> const& upperTimeBounds) {
+        // The qualitative analysis does not depend on the time bound.
+        storm::storage::BitVector prob0States = getProb0States(dir, phiStates, psiStates);
+
+        // The time bounds are distributed among the threads. Since larger time bounds need more iterations, every thread takes every n-th time bound.
+        // The remaining threads are used within the computations for the individual time bounds.
+        uint64_t const numberOfThreads = env.solver().timeBounded().getNumberOfThreads();
+        uint64_t const numberOfBoundThreads = storm::utility::getNumberOfParallelChunks(0, upperTimeBounds.size(), numberOfThreads);
+        storm::Environment boundEnv = env;
+        boundEnv.solver().timeBounded().setNumberOfThreads(numberOfThreads / std::max<uint64_t>(1, numberOfBoundThreads));
+        std::vector<std::vector<ValueType>> result(upperTimeBounds.size());
+        storm::utility::processInParallel(0, numberOfBoundThreads, numberOfBoundThreads, [&](uint64_t begin, uint64_t end, uint64_t) {
+            for (uint64_t thread = begin; thread < end; ++thread) {
+                for (uint64_t boundIndex = thread; boundIndex < upperTimeBounds.size(); boundIndex += numberOfBoundThreads) {
+                    result[boundIndex] =
+                        computeBoundedUntilProbabilities(boundEnv, dir, phiStates, psiStates, prob0States, upperTimeBounds[boundIndex], boost::none);
+                }
+            }
+        });
+        return result;
+    }
+
+   private:
+    std::vector<ValueType> computeBoundedUntilProbabilities(storm::Environment const& env, OptimizationDirection dir,
+                                                            storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                            storm::storage::BitVector const& prob0States, ValueType const& upperTimeBound,
+                                                            boost::optional<storm::storage::BitVector> const& relevantStates) {
+        // If no time can pass, psi states can only be reached via probabilistic states.
+        if (storm::utility::isZero(upperTimeBound)) {
+            return SparseMarkovAutomatonCslHelper::computeUntilProbabilities<ValueType>(env, dir, transitionMatrix, transitionMatrix.transpose(true),
+                                                                                        phiStates & ~markovianStates, psiStates, false, false)
+                .values;
+        }
+
         // Since there is no lower time bound, we can treat the psiStates as if they are absorbing.
 
         // Compute some important subsets of states
-        storm::storage::BitVector maybeStates = ~(getProb0States(dir, phiStates, psiStates) | psiStates);
+        storm::storage::BitVector maybeStates = ~(prob0States | psiStates);
         storm::storage::BitVector markovianMaybeStates = markovianStates & maybeStates;
         storm::storage::BitVector probabilisticMaybeStates = ~markovianStates & maybeStates;
         storm::storage::BitVector markovianStatesModMaybeStates = markovianMaybeStates % maybeStates;
@@ -129,19 +173,30 @@ class UnifPlusHelper {
         // The probabilities to go from a probabilistic state to a psi state in one step
         std::vector<std::pair<uint64_t, ValueType>> probabilisticToPsiProbabilities = getSparseOneStepProbabilities(probabilisticMaybeStates, psiStates);
 
-        // Set up a solver for the transitions between probabilistic states (if there are some)
+        // If multiple threads are available, the sweeps for the upper and the lower bound are performed concurrently. Each sweep distributes its
+        // matrix-vector multiplications among its own share of the threads.
+        uint64_t const numberOfThreads = env.solver().timeBounded().getNumberOfThreads();
+        bool const concurrentSweeps = numberOfThreads > 1;
+        uint64_t const threadsPerSweep = concurrentSweeps ? std::max<uint64_t>(1, numberOfThreads / 2) : 1;
+
+        // Set up a solver for the transitions between probabilistic states (if there are some) and allocate auxiliary memory for each sweep.
         Environment solverEnv = env;
         solverEnv.solver().setForceExact(true);  // Errors within the inner iterations can propagate significantly
-        auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+        std::vector<SweepWorkspace> workspaces(concurrentSweeps ? 2 : 1);
+        // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
+        workspaces.front().nextMarkovianStateValues = std::move(markovianExitRates);
+        for (auto& workspace : workspaces) {
+            workspace.solver = setUpProbabilisticStatesSolver(solverEnv, dir, probabilisticToProbabilisticTransitions);
+            workspace.nextMarkovianStateValues.resize(markovianMaybeStates.getNumberOfSetBits());
+            workspace.nextProbabilisticStateValues.resize(probabilisticToProbabilisticTransitions.getRowGroupCount());
+            workspace.eqSysRhs.resize(probabilisticToProbabilisticTransitions.getRowCount());
+            workspace.threadPool = std::make_unique<storm::utility::ThreadPool>(threadsPerSweep);
+        }
 
         // Allocate auxiliary memory that can be used during the iterations
         std::vector<ValueType> maybeStatesValuesLower(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
         std::vector<ValueType> maybeStatesValuesWeightedUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());  // should be zero initially
         std::vector<ValueType> maybeStatesValuesUpper(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());          // should be zero initially
-        std::vector<ValueType> nextMarkovianStateValues = std::move(
-            markovianExitRates);  // At this point, the markovianExitRates are no longer needed, so we 'move' them away instead of allocating new memory
-        std::vector<ValueType> nextProbabilisticStateValues(probabilisticToProbabilisticTransitions.getRowGroupCount());
-        std::vector<ValueType> eqSysRhs(probabilisticToProbabilisticTransitions.getRowCount());
 
         // Start the outer iterations which increase the uniformization rate until lower and upper bound on the result vector is sufficiently small
         storm::utility::ProgressMeasurement progressIterations("iterations");
@@ -158,14 +213,19 @@ class UnifPlusHelper {
             // Scale the weights so they sum to one.
             // storm::utility::vector::scaleVectorInPlace(foxGlynnResult.weights, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
 
-            // Set up multiplier
-            auto markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
-            auto probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            // Set up multipliers
+            for (auto& workspace : workspaces) {
+                workspace.markovianToMaybeMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianToMaybeTransitions);
+                workspace.probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianTransitions);
+            }
 
-            // Perform inner iterations first for upper, then for lower bound
-            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
-            for (bool computeLowerBound : {false, true}) {
+            // Performs the inner iterations for the upper or the lower bound. Returns true iff the iterations have been aborted.
+            auto performSweep = [&](bool computeLowerBound, SweepWorkspace& workspace) {
                 auto& maybeStatesValues = computeLowerBound ? maybeStatesValuesLower : maybeStatesValuesWeightedUpper;
+                auto& nextMarkovianStateValues = workspace.nextMarkovianStateValues;
+                auto& nextProbabilisticStateValues = workspace.nextProbabilisticStateValues;
+                auto& eqSysRhs = workspace.eqSysRhs;
+                bool aborted = false;
                 ValueType targetValue = computeLowerBound ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
                 storm::utility::ProgressMeasurement progressSteps("steps in iteration " + std::to_string(iteration) + " for " +
                                                                   std::string(computeLowerBound ? "lower" : "upper") + " bounds.");
@@ -200,7 +260,8 @@ class UnifPlusHelper {
                         std::fill(nextMarkovianStateValues.begin(), nextMarkovianStateValues.end(), storm::utility::zero<ValueType>());
                     } else {
                         // Compute the values at Markovian maybe states.
-                        markovianToMaybeMultiplier->multiply(env, maybeStatesValues, nullptr, nextMarkovianStateValues);
+                        multiply(env, *workspace.markovianToMaybeMultiplier, markovianToMaybeTransitions, maybeStatesValues, nextMarkovianStateValues,
+                                 *workspace.threadPool);
                         for (auto const& oneStepProb : markovianToPsiProbabilities) {
                             nextMarkovianStateValues[oneStepProb.first] += oneStepProb.second * targetValue;
                         }
@@ -214,12 +275,13 @@ class UnifPlusHelper {
                     }
 
                     // Compute the values at probabilistic states.
-                    probabilisticToMarkovianMultiplier->multiply(env, nextMarkovianStateValues, nullptr, eqSysRhs);
+                    multiply(env, *workspace.probabilisticToMarkovianMultiplier, probabilisticToMarkovianTransitions, nextMarkovianStateValues, eqSysRhs,
+                             *workspace.threadPool);
                     for (auto const& oneStepProb : probabilisticToPsiProbabilities) {
                         eqSysRhs[oneStepProb.first] += oneStepProb.second * targetValue;
                     }
-                    if (solver) {
-                        solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
+                    if (workspace.solver) {
+                        workspace.solver->solveEquations(solverEnv, dir, nextProbabilisticStateValues, eqSysRhs);
                     } else {
                         storm::utility::vector::reduceVectorMinOrMax(dir, eqSysRhs, nextProbabilisticStateValues,
                                                                      probabilisticToProbabilisticTransitions.getRowGroupIndices());
@@ -241,7 +303,7 @@ class UnifPlusHelper {
 
                     progressSteps.updateProgress(N - k);
                     if (storm::utility::resources::isTerminate()) {
-                        abortedInnerIterations = true;
+                        aborted = true;
                         break;
                     }
                 }
@@ -251,19 +313,13 @@ class UnifPlusHelper {
                 } else {
                     storm::utility::vector::scaleVectorInPlace(maybeStatesValuesUpper, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 }
+                return aborted;
+            };
 
-                if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
-                    break;
-                }
-
-                // Check if the lower and upper bound are sufficiently close to each other
+            // Checks whether the lower and upper bound are sufficiently close to each other. If not, the best solution found so far is stored.
+            auto checkConvergenceAndStoreSolution = [&]() {
                 converged = checkConvergence(maybeStatesValuesLower, maybeStatesValuesUpper, relevantMaybeStates, epsilon, relativePrecision, kappa);
-                if (converged) {
-                    break;
-                }
-
-                // Store the best solution we have found so far.
-                if (relevantMaybeStates) {
+                if (!converged && relevantMaybeStates) {
                     auto currentSolIt = bestKnownSolution.begin();
                     for (auto state : relevantMaybeStates.get()) {
                         // We take the average of the lower and upper bounds
@@ -271,6 +327,31 @@ class UnifPlusHelper {
                         ++currentSolIt;
                     }
                 }
+            };
+
+            STORM_LOG_ASSERT(!storm::utility::vector::hasNonZeroEntry(maybeStatesValuesUpper), "Current values need to be initialized with zero.");
+            if (concurrentSweeps) {
+                std::array<bool, 2> abortedSweeps = {false, false};
+                storm::utility::processInParallel(0, 2, 2, [&](uint64_t sweep, uint64_t, uint64_t) {
+                    abortedSweeps[sweep] = performSweep(sweep == 1, workspaces[sweep]);
+                });
+                abortedInnerIterations = abortedSweeps[0] || abortedSweeps[1];
+                if (!abortedInnerIterations && !storm::utility::resources::isTerminate()) {
+                    checkConvergenceAndStoreSolution();
+                }
+            } else {
+                // Perform inner iterations first for upper, then for lower bound. As the lower bound of the previous iteration remains valid, we might
+                // already converge after computing the upper bound.
+                for (bool computeLowerBound : {false, true}) {
+                    abortedInnerIterations = performSweep(computeLowerBound, workspaces.front());
+                    if (abortedInnerIterations || storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                    checkConvergenceAndStoreSolution();
+                    if (converged) {
+                        break;
+                    }
+                }
             }
 
             if (!converged) {
@@ -325,7 +406,38 @@ class UnifPlusHelper {
         return result;
     }
 
-   private:
+    // The auxiliary data that is needed for performing the inner iterations.
+    struct SweepWorkspace {
+        std::vector<ValueType> nextMarkovianStateValues;
+        std::vector<ValueType> nextProbabilisticStateValues;
+        std::vector<ValueType> eqSysRhs;
+        std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianToMaybeMultiplier;
+        std::unique_ptr<storm::solver::Multiplier<ValueType>> probabilisticToMarkovianMultiplier;
+        std::unique_ptr<storm::utility::ThreadPool> threadPool;
+    };
+
+    /*!
+     * Computes result = matrix * x. If the given pool has multiple threads, the rows are distributed among them. Otherwise, the multiplier is used.
+     */
+    static void multiply(storm::Environment const& env, storm::solver::Multiplier<ValueType> const& multiplier,
+                         storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType>& result,
+                         storm::utility::ThreadPool& threadPool) {
+        if (threadPool.getNumberOfThreads() == 1) {
+            multiplier.multiply(env, x, nullptr, result);
+            return;
+        }
+        threadPool.processInParallel(0, matrix.getRowCount(), [&matrix, &x, &result](uint64_t begin, uint64_t end, uint64_t) {
+            for (uint64_t row = begin; row < end; ++row) {
+                ValueType sum = storm::utility::zero<ValueType>();
+                for (auto const& entry : matrix.getRow(row)) {
+                    sum += entry.getValue() * x[entry.getColumn()];
+                }
+                result[row] = sum;
+            }
+        });
+    }
+
     bool checkConvergence(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper,
                           boost::optional<storm::storage::BitVector> const& relevantValues, ValueType const& epsilon, bool relative, ValueType& kappa) {
         STORM_LOG_ASSERT(!relevantValues.is_initialized() || relevantValues->size() == lower.size(), "Relevant values size mismatch.");
@@ -722,6 +834,34 @@ std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbab
     STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_WARN_COND(env.solver().timeBounded().getMaMethod() == storm::solver::MaBoundedReachabilityMethod::UnifPlus ||
+                            env.solver().timeBounded().isMaMethodSetFromDefault(),
+                        "Using Unif+ method because multiple time bounds are only supported by Unif+.");
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(upperBounds.size());
+    for (auto const& bound : upperBounds) {
+        STORM_LOG_THROW(bound >= 0.0, storm::exceptions::InvalidArgumentException, "The time bound " << bound << " is negative.");
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(bound));
+    }
+
+    UnifPlusHelper<ValueType> helper(transitionMatrix, exitRateVector, markovianStates);
+    return helper.computeBoundedUntilProbabilitiesForTimeBounds(env, goal.direction(), phiStates, psiStates, timeBounds);
+}
+
+template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const&, storm::solver::SolveGoal<ValueType>&&, storm::storage::SparseMatrix<ValueType> const&, std::vector<ValueType> const&,
+    storm::storage::BitVector const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<double> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+}
+
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -785,6 +925,11 @@ template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntil
     std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
+    std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
 template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
@@ -811,6 +956,11 @@ template std::vector<storm::RationalNumber> SparseMarkovAutomatonCslHelper::comp
     std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<storm::RationalNumber>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(
+    Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& upperBounds);
+
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
@@ -1,4 +1,5 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedIterationHelper.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 
@@ -64,13 +65,13 @@ std::vector<ValueType> SparseDeterministicStepBoundedHorizonHelper<ValueType>::c
         // Perform the matrix vector multiplication
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
         if (lowerBound == 0) {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound);
+            performStepBoundedIterations<ValueType>(env, *multiplier, std::nullopt, subresult, &b, upperBound, true);
         } else {
-            multiplier->repeatedMultiply(env, subresult, &b, upperBound - lowerBound + 1);
+            performStepBoundedIterations<ValueType>(env, *multiplier, std::nullopt, subresult, &b, upperBound - lowerBound + 1, true);
             submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, true);
             multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiply(env, subresult, &b, lowerBound - 1);
+            // In the remaining steps, the values are moved but not increased. Hence, only periodic iterates can be skipped.
+            performStepBoundedIterations<ValueType>(env, *multiplier, std::nullopt, subresult, nullptr, lowerBound - 1, false);
         }
 
         // Set the values of the resulting vector accordingly.
@@ -1,4 +1,5 @@
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedIterationHelper.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 
@@ -65,13 +66,13 @@ std::vector<ValueType> SparseNondeterministicStepBoundedHorizonHelper<ValueType>
 
         auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
         if (lowerBound == 0) {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound);
+            performStepBoundedIterations<ValueType>(env, *multiplier, goal.direction(), subresult, &b, upperBound, true);
         } else {
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, upperBound - lowerBound + 1);
+            performStepBoundedIterations<ValueType>(env, *multiplier, goal.direction(), subresult, &b, upperBound - lowerBound + 1, true);
             storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
             auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-            b = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
-            multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, lowerBound - 1);
+            // In the remaining steps, the values are moved but not increased. Hence, only periodic iterates can be skipped.
+            performStepBoundedIterations<ValueType>(env, *multiplier, goal.direction(), subresult, nullptr, lowerBound - 1, false);
         }
         // Set the values of the resulting vector accordingly.
         storm::utility::vector::setVectorValues(result, maybeStates, subresult);
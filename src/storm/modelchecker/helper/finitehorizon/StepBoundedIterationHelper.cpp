@@ -0,0 +1,177 @@
+#include "storm/modelchecker/helper/finitehorizon/StepBoundedIterationHelper.h"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+namespace detail {
+/*!
+ * Retrieves the (absolute) precision up to which the result of a step-bounded iteration may be approximated.
+ * Returns none if no approximation shall be applied.
+ */
+template<typename ValueType>
+std::optional<ValueType> getStepBoundedApproximationPrecision(Environment const& env, bool nondeterministic) {
+    if constexpr (storm::NumberTraits<ValueType>::IsExact) {
+        return std::nullopt;
+    } else {
+        if (env.modelchecker().isExactStepBoundedEvaluationSet()) {
+            return std::nullopt;
+        }
+        if (nondeterministic) {
+            if (env.solver().minMax().getRelativeTerminationCriterion()) {
+                return std::nullopt;
+            }
+            return storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+        }
+        auto precision = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
+        if (!precision.first.is_initialized() || (precision.second.is_initialized() && precision.second.get())) {
+            return std::nullopt;
+        }
+        return storm::utility::convertNumber<ValueType>(precision.first.get());
+    }
+}
+}  // namespace detail
+
+template<typename ValueType>
+void performStepBoundedIterations(Environment const& env, storm::solver::Multiplier<ValueType> const& multiplier,
+                                  std::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                  uint64_t numberOfSteps, bool allowApproximation) {
+    auto performStep = [&env, &multiplier](std::optional<storm::solver::OptimizationDirection> const& d, std::vector<ValueType>& v,
+                                           std::vector<ValueType> const* offset) {
+        if (d) {
+            multiplier.multiplyAndReduce(env, *d, v, offset, v);
+        } else {
+            multiplier.multiply(env, v, offset, v);
+        }
+    };
+
+    // For the detection of periodic iterates, we use Brent's algorithm: The current iterate is compared to a stored one which is replaced
+    // whenever the number of steps since storing it reaches the next power of two.
+    // For rational functions, comparing iterates is too expensive (and periodicity is unlikely).
+    bool detectPeriod = !std::is_same_v<ValueType, storm::RationalFunction>;
+    std::vector<ValueType> storedIterate;
+    uint64_t storedStep = 0;
+    uint64_t stepsUntilStore = 1;
+    if (detectPeriod) {
+        storedIterate = x;
+    }
+
+    // For the detection of convergence, we track the maximal probabilities to stay within the considered states for k steps.
+    // For all k<=n, the difference between the k-th and the n-th iterate is bounded by these probabilities. Moreover, the maximum norm is sub-multiplicative,
+    // i.e., if the largest of these probabilities after m steps is rho, the difference after j*m steps is bounded by rho^j.
+    std::optional<ValueType> precision;
+    if (allowApproximation) {
+        precision = detail::getStepBoundedApproximationPrecision<ValueType>(env, dir.has_value());
+    }
+    // In the presence of nondeterminism, the maximal probabilities bound the difference for all schedulers.
+    std::optional<storm::solver::OptimizationDirection> stayDir;
+    if (dir) {
+        stayDir = storm::solver::OptimizationDirection::Maximize;
+    }
+    std::vector<ValueType> stayProbabilities;
+    if (precision) {
+        stayProbabilities.assign(x.size(), storm::utility::one<ValueType>());
+    }
+    uint64_t nextCheckpoint = 1;
+
+    storm::utility::ProgressMeasurement progress("multiplications");
+    progress.setMaxCount(numberOfSteps);
+    progress.startNewMeasurement(0);
+    uint64_t step = 0;
+    while (step < numberOfSteps) {
+        performStep(dir, x, b);
+        ++step;
+
+        if constexpr (!storm::NumberTraits<ValueType>::IsExact) {
+            if (!stayProbabilities.empty()) {
+                performStep(stayDir, stayProbabilities, nullptr);
+                if (step == nextCheckpoint) {
+                    nextCheckpoint *= 2;
+                    ValueType rho = *std::max_element(stayProbabilities.begin(), stayProbabilities.end());
+                    if (rho <= *precision) {
+                        // The n-th iterate lies between the current iterate x and x + stayProbabilities. We take the center of this interval.
+                        for (uint64_t i = 0; i < x.size(); ++i) {
+                            x[i] += stayProbabilities[i] / storm::utility::convertNumber<ValueType>(2.0);
+                        }
+                        STORM_LOG_INFO("Step bounded iteration converged after " << step << " of " << numberOfSteps << " steps.");
+                        break;
+                    }
+                    bool usefulBound = false;
+                    if (rho < storm::utility::one<ValueType>()) {
+                        double requiredSteps = std::ceil(std::log(storm::utility::convertNumber<double>(*precision)) /
+                                                         std::log(storm::utility::convertNumber<double>(rho))) *
+                                               static_cast<double>(step);
+                        if (requiredSteps < static_cast<double>(numberOfSteps)) {
+                            STORM_LOG_INFO("Step bounded iteration converges after at most " << static_cast<uint64_t>(requiredSteps) << " of " << numberOfSteps
+                                                                                             << " steps.");
+                            numberOfSteps = std::max<uint64_t>(step, static_cast<uint64_t>(requiredSteps));
+                            usefulBound = true;
+                        }
+                    }
+                    // Stop tracking the probabilities if they either already gave a bound or will most likely not give one in time.
+                    if (usefulBound || step >= x.size() || 2 * step >= numberOfSteps - step) {
+                        stayProbabilities.clear();
+                        stayProbabilities.shrink_to_fit();
+                    }
+                }
+            }
+        }
+
+        if (detectPeriod) {
+            if (x == storedIterate) {
+                uint64_t period = step - storedStep;
+                uint64_t remainingSteps = (numberOfSteps - step) % period;
+                STORM_LOG_INFO("Step bounded iteration is periodic with period " << period << " after " << step << " steps. Skipping "
+                                                                               << (numberOfSteps - step - remainingSteps) << " steps.");
+                numberOfSteps = step + remainingSteps;
+                detectPeriod = false;
+                storedIterate.clear();
+                storedIterate.shrink_to_fit();
+            } else if (step - storedStep == stepsUntilStore) {
+                storedIterate = x;
+                storedStep = step;
+                stepsUntilStore *= 2;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Aborting after " << step << " of " << numberOfSteps << " multiplications");
+            break;
+        }
+        progress.updateProgress(step);
+    }
+}
+
+template void performStepBoundedIterations<double>(Environment const& env, storm::solver::Multiplier<double> const& multiplier,
+                                                   std::optional<storm::solver::OptimizationDirection> const& dir, std::vector<double>& x,
+                                                   std::vector<double> const* b, uint64_t numberOfSteps, bool allowApproximation);
+template void performStepBoundedIterations<storm::RationalNumber>(Environment const& env, storm::solver::Multiplier<storm::RationalNumber> const& multiplier,
+                                                                  std::optional<storm::solver::OptimizationDirection> const& dir,
+                                                                  std::vector<storm::RationalNumber>& x, std::vector<storm::RationalNumber> const* b,
+                                                                  uint64_t numberOfSteps, bool allowApproximation);
+template void performStepBoundedIterations<storm::RationalFunction>(Environment const& env,
+                                                                    storm::solver::Multiplier<storm::RationalFunction> const& multiplier,
+                                                                    std::optional<storm::solver::OptimizationDirection> const& dir,
+                                                                    std::vector<storm::RationalFunction>& x, std::vector<storm::RationalFunction> const* b,
+                                                                    uint64_t numberOfSteps, bool allowApproximation);
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+
+class Environment;
+
+namespace solver {
+template<typename ValueType>
+class Multiplier;
+}
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Performs the steps x <- A*x + b underlying the analysis of step-bounded properties, where the result of each step is (optionally) reduced
+ * over the row groups of A. Instead of blindly performing all steps, the iteration is fast-forwarded in the following cases:
+ *
+ * - If an iterate coincides with a previous one, the sequence of iterates is periodic and all steps that complete a full period are skipped.
+ *   Since the iterates are computed deterministically, this does not change the result (not even in floating point arithmetic).
+ * - If approximation is allowed, the iteration stops as soon as the remaining steps provably change the result by at most the precision
+ *   of the environment. For this, the maximal probability to remain within the considered states for k steps (i.e. max_s (A^k*1)(s)) is
+ *   tracked alongside the iteration. This requires that the initial vector x is zero and that all iterates are bounded by one (as it is the case
+ *   for step-bounded reachability probabilities).
+ *   Approximation is never applied for exact value types or if exact step bounded evaluation is requested in the environment.
+ *
+ * @param env The environment.
+ * @param multiplier A multiplier for A.
+ * @param dir If given, results are reduced over the row groups of A in the given direction.
+ * @param x The initial vector which is overwritten with the result.
+ * @param b The vector that is added in each step (if not null).
+ * @param numberOfSteps The number of steps to perform.
+ * @param allowApproximation If true, the iteration can be stopped once the values have converged. See above for the requirements.
+ */
+template<typename ValueType>
+void performStepBoundedIterations(Environment const& env, storm::solver::Multiplier<ValueType> const& multiplier,
+                                  std::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b,
+                                  uint64_t numberOfSteps, bool allowApproximation);
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -617,11 +617,12 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
     // Compute for each BSCC get the probability with which we reach that BSCC
     auto bsccReachProbs = computeBsccReachabilityProbabilities(subEnv, initialDistributionGetter);
     // We are now ready to compute the resulting lra distribution
+    // Since the BSCCs are disjoint, they can be processed independently.
     std::vector<ValueType> steadyStateDistr(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-    for (uint64_t currentComponentIndex = 0; currentComponentIndex < this->_longRunComponentDecomposition->size(); ++currentComponentIndex) {
+    this->processComponents(subEnv, [&](Environment const& componentEnv, uint64_t currentComponentIndex) {
         auto const& component = (*this->_longRunComponentDecomposition)[currentComponentIndex];
         // Compute distribution for current bscc
-        auto bsccDistr = this->computeSteadyStateDistrForBscc(subEnv, component);
+        auto bsccDistr = this->computeSteadyStateDistrForBscc(componentEnv, component);
         // Scale with probability to reach that bscc
         auto const& scalingFactor = bsccReachProbs[currentComponentIndex];
         if (!storm::utility::isOne(scalingFactor)) {
@@ -635,7 +636,7 @@ std::vector<ValueType> SparseDeterministicInfiniteHorizonHelper<ValueType>::comp
             ++bsccDistrIt;
         }
         STORM_LOG_ASSERT(bsccDistrIt == bsccDistr.end(), "Unexpected number of entries in bscc distribution");
-    }
+    });
     return steadyStateDistr;
 }
 
@@ -1,5 +1,8 @@
 #include "SparseInfiniteHorizonHelper.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "storm/modelchecker/helper/infinitehorizon/internal/ComponentUtility.h"
 #include "storm/modelchecker/helper/infinitehorizon/internal/LraViHelper.h"
 
@@ -19,6 +22,7 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/solver.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
@@ -169,12 +173,14 @@ std::vector<ValueType> SparseInfiniteHorizonHelper<ValueType, Nondeterministic>:
     progress.setMaxCount(_longRunComponentDecomposition->size());
     progress.startNewMeasurement(0);
     STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-    std::vector<ValueType> componentLraValues;
-    componentLraValues.reserve(_longRunComponentDecomposition->size());
-    for (auto const& c : *_longRunComponentDecomposition) {
-        componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-        progress.updateProgress(componentLraValues.size());
-    }
+    std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+    processComponents(
+        underlyingSolverEnvironment,
+        [&](Environment const& componentEnv, uint64_t componentIndex) {
+            componentLraValues[componentIndex] =
+                computeLraForComponent(componentEnv, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+        },
+        &progress);
 
     // Solve the resulting SSP where end components are collapsed into single auxiliary states
     STORM_LOG_INFO("Solving stochastic shortest path problem.");
@@ -196,6 +202,76 @@ void SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::createBackwardTra
     }
 }
 
+template<typename ValueType, bool Nondeterministic>
+void SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::processComponents(Environment const& env,
+                                                                                 std::function<void(Environment const&, uint64_t)> const& function,
+                                                                                 storm::utility::ProgressMeasurement* progress) {
+    STORM_LOG_ASSERT(_longRunComponentDecomposition != nullptr, "Decomposition not computed, yet.");
+    uint64_t const numberOfComponents = _longRunComponentDecomposition->size();
+    uint64_t numberOfThreads = std::min<uint64_t>(env.solver().lra().getNumberOfThreads(), numberOfComponents);
+    if (numberOfThreads > 1 && !std::is_same<ValueType, double>::value) {
+        STORM_LOG_WARN("Long run components are only analyzed concurrently for models over doubles.");
+        numberOfThreads = 1;
+    } else if (numberOfThreads > 1 && !isConcurrentComponentAnalysisSupported(env)) {
+        STORM_LOG_WARN("The selected long run average method does not support analyzing components concurrently.");
+        numberOfThreads = 1;
+    }
+
+    if (numberOfThreads <= 1) {
+        for (uint64_t componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex) {
+            function(env, componentIndex);
+            if (progress) {
+                progress->updateProgress(componentIndex + 1);
+            }
+        }
+        return;
+    }
+
+    // Some component analyses require the backward transitions. We create them upfront so that the threads do not try to create them concurrently.
+    createBackwardTransitions();
+
+    // Consecutive components are grouped into batches that have at least a certain number of choices.
+    uint64_t const minimalBatchSize = 1024;
+    std::vector<uint64_t> batchBegins;
+    uint64_t currentBatchSize = minimalBatchSize;
+    for (uint64_t componentIndex = 0; componentIndex < numberOfComponents; ++componentIndex) {
+        if (currentBatchSize >= minimalBatchSize) {
+            batchBegins.push_back(componentIndex);
+            currentBatchSize = 0;
+        }
+        for (auto const& element : (*_longRunComponentDecomposition)[componentIndex]) {
+            currentBatchSize += internal::getComponentElementChoiceCount(element);
+        }
+    }
+    uint64_t const numberOfBatches = batchBegins.size();
+    batchBegins.push_back(numberOfComponents);
+    numberOfThreads = std::min(numberOfThreads, numberOfBatches);
+    STORM_LOG_INFO("Analyzing " << numberOfComponents << " components in " << numberOfBatches << " batches using " << numberOfThreads << " threads.");
+
+    // The effort for the individual batches can differ significantly, so the batches are assigned to the threads dynamically.
+    // Each thread works on its own copy of the environment.
+    std::vector<Environment> threadEnvironments(numberOfThreads, env);
+    std::atomic<uint64_t> nextBatch(0);
+    std::atomic<uint64_t> numberOfProcessedComponents(0);
+    storm::utility::processInParallel(0, numberOfThreads, numberOfThreads, [&](uint64_t thread, uint64_t, uint64_t) {
+        for (uint64_t batch = nextBatch++; batch < numberOfBatches; batch = nextBatch++) {
+            for (uint64_t componentIndex = batchBegins[batch]; componentIndex < batchBegins[batch + 1]; ++componentIndex) {
+                function(threadEnvironments[thread], componentIndex);
+            }
+            uint64_t processed = numberOfProcessedComponents += batchBegins[batch + 1] - batchBegins[batch];
+            // Only a single thread reports the progress.
+            if (progress && thread == 0) {
+                progress->updateProgress(processed);
+            }
+        }
+    });
+}
+
+template<typename ValueType, bool Nondeterministic>
+bool SparseInfiniteHorizonHelper<ValueType, Nondeterministic>::isConcurrentComponentAnalysisSupported(Environment const&) const {
+    return true;
+}
+
 template class SparseInfiniteHorizonHelper<double, true>;
 template class SparseInfiniteHorizonHelper<storm::RationalNumber, true>;
 
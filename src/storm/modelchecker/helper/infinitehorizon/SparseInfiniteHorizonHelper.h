@@ -9,6 +9,10 @@
 namespace storm {
 class Environment;
 
+namespace utility {
+class ProgressMeasurement;
+}
+
 namespace models {
 namespace sparse {
 template<typename VT>
@@ -118,6 +122,22 @@ class SparseInfiniteHorizonHelper : public SingleValueModelCheckerHelper<ValueTy
      */
     void createBackwardTransitions();
 
+    /*!
+     * Calls the given function for each long run component (in the order of the decomposition).
+     * If the environment specifies multiple threads, the components are processed concurrently. To keep the synchronization overhead low, consecutive
+     * small components are processed in batches.
+     * @param function called as function(env, componentIndex). The given environment is not shared with other threads.
+     * @param progress if given, the progress is reported for each processed component.
+     * @pre _longRunComponentDecomposition points to a decomposition of the long run components.
+     */
+    void processComponents(Environment const& env, std::function<void(Environment const&, uint64_t)> const& function,
+                           storm::utility::ProgressMeasurement* progress = nullptr);
+
+    /*!
+     * @return true iff the analysis of different components (e.g. via computeLraForComponent) can be performed concurrently in the given environment.
+     */
+    virtual bool isConcurrentComponentAnalysisSupported(Environment const& env) const;
+
     /*!
      * @post _longRunComponentDecomposition points to a decomposition of the long run components (MECs, BSCCs)
      */
@@ -1,6 +1,8 @@
 #pragma once
 #include "storm/modelchecker/helper/infinitehorizon/SparseInfiniteHorizonHelper.h"
 
+#include "storm/solver/SolverSelectionOptions.h"
+
 namespace storm {
 
 namespace storage {
@@ -65,6 +67,13 @@ class SparseNondeterministicInfiniteHorizonHelper : public SparseInfiniteHorizon
    protected:
     virtual void createDecomposition() override;
 
+    virtual bool isConcurrentComponentAnalysisSupported(Environment const& env) const override;
+
+    /*!
+     * @return the method that is used to analyze nontrivial MECs in the given environment
+     */
+    storm::solver::LraMethod getLraMethod(Environment const& env) const;
+
     std::pair<bool, ValueType> computeLraForTrivialMec(Environment const& env, ValueGetter const& stateValuesGetter, ValueGetter const& actionValuesGetter,
                                                        storm::storage::MaximalEndComponent const& mec);
 
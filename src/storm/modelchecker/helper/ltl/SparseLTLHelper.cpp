@@ -1,7 +1,11 @@
 #include "SparseLTLHelper.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/automata/DeterministicAutomaton.h"
 #include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomatonCache.h"
 
 #include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 
@@ -14,6 +18,7 @@
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
 
 #include "storm/exceptions/InvalidPropertyException.h"
 
@@ -196,6 +201,58 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
     return acceptingStates;
 }
 
+template<typename ValueType, bool Nondeterministic>
+boost::optional<std::vector<ValueType>> SparseLTLHelper<ValueType, Nondeterministic>::computeQualitativeValuesOfPartialProduct(
+    storm::automata::DeterministicAutomaton const& da, transformer::DAProductExplorer<productModelType> const& explorer) {
+    storm::storage::SparseMatrix<ValueType> transitionMatrix = explorer.buildTransitionMatrix();
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+    storm::automata::AcceptanceCondition::ptr acceptance =
+        da.getAcceptance()->lift(explorer.getNumberOfStates(), [&explorer](std::size_t prodState) { return explorer.getAutomatonState(prodState); });
+
+    // The self-loops of the frontier states do not correspond to components of the complete product.
+    storm::storage::BitVector frontierStates = explorer.getFrontierStates();
+    storm::storage::BitVector acceptingStates;
+    if (Nondeterministic) {
+        acceptingStates = computeAcceptingECs(*acceptance, transitionMatrix, backwardTransitions, nullptr);
+    } else {
+        acceptingStates = computeAcceptingBCCs(*acceptance, transitionMatrix);
+    }
+    acceptingStates &= ~frontierStates;
+    storm::storage::BitVector acceptingOrFrontierStates = acceptingStates | frontierStates;
+
+    // Lower and upper bounds for the (maximal) probability to reach an accepting component in the complete product
+    storm::storage::BitVector allStates(transitionMatrix.getRowGroupCount(), true);
+    storm::storage::BitVector lowerProbGreater0, lowerProb1, upperProbGreater0, upperProb1;
+    if (Nondeterministic) {
+        lowerProbGreater0 = storm::utility::graph::performProbGreater0E(backwardTransitions, allStates, acceptingStates);
+        lowerProb1 = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates,
+                                                          acceptingStates);
+        upperProbGreater0 = storm::utility::graph::performProbGreater0E(backwardTransitions, allStates, acceptingOrFrontierStates);
+        upperProb1 = storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates,
+                                                          acceptingOrFrontierStates);
+    } else {
+        lowerProbGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, acceptingStates);
+        lowerProb1 = storm::utility::graph::performProb1(backwardTransitions, allStates, acceptingStates);
+        upperProbGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, acceptingOrFrontierStates);
+        upperProb1 = storm::utility::graph::performProb1(backwardTransitions, allStates, acceptingOrFrontierStates);
+    }
+
+    std::vector<ValueType> result(this->_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+    for (auto productState : explorer.getStatesOfInterest()) {
+        ValueType& value = result[explorer.getModelState(productState)];
+        if (!upperProbGreater0.get(productState)) {
+            value = storm::utility::zero<ValueType>();
+        } else if (lowerProb1.get(productState)) {
+            value = storm::utility::one<ValueType>();
+        } else if (lowerProbGreater0.get(productState) && !upperProb1.get(productState)) {
+            value = storm::utility::convertNumber<ValueType>(0.5);
+        } else {
+            return boost::none;
+        }
+    }
+    return result;
+}
+
 template<typename ValueType, bool Nondeterministic>
 std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAProductProbabilities(
     Environment const& env, storm::automata::DeterministicAutomaton const& da, std::map<std::string, storm::storage::BitVector>& apSatSets) {
@@ -222,8 +279,26 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     STORM_LOG_INFO("Building " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product with deterministic automaton, starting from "
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
-
-    auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
+    transformer::DAProductExplorer<productModelType> explorer(productBuilder, this->_transitionMatrix, statesOfInterest);
+
+    if (this->isQualitativeSet() && !this->isProduceSchedulerSet()) {
+        // Explore the product incrementally and stop as soon as the qualitative values of the states of interest are known.
+        // The number of explored states is doubled in every round so that the overall effort for analyzing partial products is linear.
+        uint64_t explorationBound = std::max<uint64_t>(1024, statesOfInterest.getNumberOfSetBits());
+        while (!explorer.explore(explorationBound)) {
+            STORM_LOG_INFO("Analyzing partial product with " << explorer.getNumberOfExploredStates() << " explored and " << explorer.getNumberOfStates()
+                                                             << " discovered states...");
+            auto qualitativeValues = computeQualitativeValuesOfPartialProduct(da, explorer);
+            if (qualitativeValues) {
+                STORM_LOG_INFO("Qualitative values of the states of interest are decided on the partial product.");
+                return std::move(qualitativeValues.get());
+            }
+            explorationBound = explorer.getNumberOfExploredStates();
+        }
+    } else {
+        explorer.explore(std::numeric_limits<uint64_t>::max());
+    }
+    auto product = explorer.buildProduct(da);
 
     STORM_LOG_INFO("Product " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " has "
                    << product->getProductModel().getNumberOfStates() << " states and " << product->getProductModel().getNumberOfTransitions()
@@ -316,14 +391,27 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLP
     STORM_LOG_INFO(" in prefix format: " << ltlFormula->toPrefixString());
 
     // Convert LTL formula to a deterministic automaton
+    // Translations are cached (up to renaming of the APs) as property suites typically contain the same formula patterns over and over again.
+    auto& daCache = storm::automata::LTL2DeterministicAutomatonCache::getGlobalCache();
+    daCache.setCapacity(env.modelchecker().getLtl2daCacheSize());
+    if (env.modelchecker().isLtl2daCacheDirectorySet()) {
+        daCache.setDirectory(env.modelchecker().getLtl2daCacheDirectory());
+    } else {
+        daCache.setDirectory(boost::none);
+    }
     std::shared_ptr<storm::automata::DeterministicAutomaton> da;
     if (env.modelchecker().isLtl2daToolSet()) {
         // Use the external tool given via ltl2da
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(*ltlFormula, env.modelchecker().getLtl2daTool());
+        std::string const& ltl2daTool = env.modelchecker().getLtl2daTool();
+        da = daCache.translate(*ltlFormula, "external:" + ltl2daTool, [&ltl2daTool](storm::logic::Formula const& f) {
+            return storm::automata::LTL2DeterministicAutomaton::ltl2daExternalTool(f, ltl2daTool);
+        });
     } else {
         // Use the internal tool (Spot)
         // For nondeterministic models the acceptance condition is transformed into DNF
-        da = storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(*ltlFormula, Nondeterministic);
+        da = daCache.translate(*ltlFormula, Nondeterministic ? "spot:dnf" : "spot", [](storm::logic::Formula const& f) {
+            return storm::automata::LTL2DeterministicAutomaton::ltl2daSpot(f, Nondeterministic);
+        });
     }
 
     STORM_LOG_INFO("Deterministic automaton for LTL formula has " << da->getNumberOfStates() << " states, " << da->getAPSet().size()
@@ -6,6 +6,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/transformer/DAProductBuilder.h"
+#include "storm/transformer/DAProductExplorer.h"
 
 namespace storm {
 
@@ -104,6 +105,17 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                   typename transformer::DAProduct<productModelType>::ptr product);
 
+    /*!
+     * Tries to decide the qualitative values of the states of interest based on a partially explored product.
+     * Accepting components among the explored states are accepting components of the complete product, and the probability to reach an accepting
+     * component of the complete product is bounded from above by the probability to reach an accepting component or an unexplored state.
+     * @param da the automaton of the product
+     * @param explorer the (partially explored) product
+     * @return if all states of interest could be decided, a value for each model state, where a value strictly between zero and one is represented by 1/2.
+     */
+    boost::optional<std::vector<ValueType>> computeQualitativeValuesOfPartialProduct(storm::automata::DeterministicAutomaton const& da,
+                                                                                     transformer::DAProductExplorer<productModelType> const& explorer);
+
     /*!
      * Computes a set S of states that are contained in BSCCs that satisfy the given acceptance conditon.
      * @param acceptance the acceptance condition
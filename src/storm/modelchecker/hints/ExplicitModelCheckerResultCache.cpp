@@ -0,0 +1,213 @@
+#include "storm/modelchecker/hints/ExplicitModelCheckerResultCache.h"
+
+#include <tuple>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::Key::operator<(Key const& other) const {
+    return std::tie(type, phiStates, psiStates, rewardModelName, direction) <
+           std::tie(other.type, other.phiStates, other.psiStates, other.rewardModelName, other.direction);
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::SolutionPrecision::isAtLeastAsStrictAs(SolutionPrecision const& other) const {
+    if (exact) {
+        return true;
+    }
+    if (other.exact || (other.sound && !sound)) {
+        return false;
+    }
+    // Relative and absolute precisions are incomparable in general.
+    return relative == other.relative && precision <= other.precision;
+}
+
+template<typename ValueType>
+typename ExplicitModelCheckerResultCache<ValueType>::SolutionPrecision ExplicitModelCheckerResultCache<ValueType>::getLinearEquationSolverPrecision(
+    Environment const& env) {
+    SolutionPrecision result;
+    result.exact = storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact();
+    result.sound = env.solver().isForceSoundness();
+    auto precision = env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType());
+    // Solvers without a precision (e.g. elimination) are direct methods.
+    if (precision.first) {
+        result.precision = precision.first.get();
+    }
+    if (precision.second) {
+        result.relative = precision.second.get();
+    }
+    return result;
+}
+
+template<typename ValueType>
+typename ExplicitModelCheckerResultCache<ValueType>::SolutionPrecision ExplicitModelCheckerResultCache<ValueType>::getMinMaxSolverPrecision(
+    Environment const& env) {
+    SolutionPrecision result;
+    result.exact = storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact();
+    result.sound = env.solver().isForceSoundness();
+    result.precision = env.solver().minMax().getPrecision();
+    result.relative = env.solver().minMax().getRelativeTerminationCriterion();
+    return result;
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::isEmpty() const {
+    return entries.empty();
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::isExplicitModelCheckerResultCache() const {
+    return true;
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::hasQualitativeInformation(Key const& key) const {
+    auto entryIt = entries.find(key);
+    return entryIt != entries.end() && entryIt->second.maybeStates.is_initialized();
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerResultCache<ValueType>::setQualitativeInformation(Key const& key, storm::storage::BitVector const& maybeStates,
+                                                                           std::vector<ValueType> const& qualitativeValues) const {
+    STORM_LOG_THROW(maybeStates.size() == qualitativeValues.size(), storm::exceptions::InvalidOperationException,
+                    "Inconsistent sizes of maybe states and qualitative values.");
+    Entry& entry = entries[key];
+    entry.maybeStates = maybeStates;
+    entry.qualitativeValues = qualitativeValues;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerResultCache<ValueType>::setQualitativeInformation(Key const& key, storm::storage::BitVector const& statesWithProbability0,
+                                                                           storm::storage::BitVector const& statesWithProbability1) const {
+    std::vector<ValueType> qualitativeValues(statesWithProbability0.size(), storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues(qualitativeValues, statesWithProbability1, storm::utility::one<ValueType>());
+    setQualitativeInformation(key, ~(statesWithProbability0 | statesWithProbability1), qualitativeValues);
+}
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> ExplicitModelCheckerResultCache<ValueType>::check(
+    Key const& key, QueryInformation const& queryInformation, std::function<ComputationResult(ModelCheckerHint const& hint)> const& computation) const {
+    Entry& entry = entries[key];
+    if (isAnsweredByEntry(entry, queryInformation)) {
+        STORM_LOG_INFO("Result of model checking query is taken from the result cache.");
+        ++numberOfCacheHits;
+        return createCheckResult(entry, queryInformation);
+    }
+
+    ComputationResult computationResult = computation(*createHint(entry));
+    std::vector<ValueType>& values = computationResult.first;
+
+    if (!queryInformation.qualitative) {
+        storm::storage::BitVector preciseStates(values.size(), !queryInformation.mayTerminateEarly);
+        if (!queryInformation.mayTerminateEarly && queryInformation.relevantStates) {
+            preciseStates = queryInformation.relevantStates.get();
+        }
+        // Only replace the cached values if the new values are at least as informative.
+        if (!entry.values || (entry.preciseStates.isSubsetOf(preciseStates) && queryInformation.precision.isAtLeastAsStrictAs(entry.precision))) {
+            entry.values = values;
+            entry.preciseStates = std::move(preciseStates);
+            entry.precision = queryInformation.precision;
+            if (computationResult.second) {
+                entry.scheduler = std::make_shared<storm::storage::Scheduler<ValueType>>(*computationResult.second);
+            } else {
+                entry.scheduler.reset();
+            }
+        }
+    }
+
+    std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(values));
+    if (queryInformation.produceScheduler && computationResult.second) {
+        result->template asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::move(computationResult.second));
+    }
+    return result;
+}
+
+template<typename ValueType>
+void ExplicitModelCheckerResultCache<ValueType>::clear() const {
+    entries.clear();
+}
+
+template<typename ValueType>
+uint64_t ExplicitModelCheckerResultCache<ValueType>::getNumberOfCacheHits() const {
+    return numberOfCacheHits;
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::hasPreciseValues(Entry const& entry, QueryInformation const& queryInformation) const {
+    if (!entry.values || !entry.precision.isAtLeastAsStrictAs(queryInformation.precision)) {
+        return false;
+    }
+    return queryInformation.relevantStates ? queryInformation.relevantStates->isSubsetOf(entry.preciseStates) : entry.preciseStates.full();
+}
+
+template<typename ValueType>
+bool ExplicitModelCheckerResultCache<ValueType>::isAnsweredByEntry(Entry const& entry, QueryInformation const& queryInformation) const {
+    if (queryInformation.produceScheduler && !entry.scheduler) {
+        return false;
+    }
+    if (hasPreciseValues(entry, queryInformation)) {
+        return true;
+    }
+    return queryInformation.qualitative && !queryInformation.produceScheduler && entry.maybeStates.is_initialized();
+}
+
+template<typename ValueType>
+std::unique_ptr<CheckResult> ExplicitModelCheckerResultCache<ValueType>::createCheckResult(Entry const& entry, QueryInformation const& queryInformation) const {
+    std::vector<ValueType> values;
+    if (hasPreciseValues(entry, queryInformation)) {
+        values = entry.values.get();
+    } else {
+        // Set the values for all maybe-states to 0.5 to indicate that their values are neither 0 nor 1.
+        values = entry.qualitativeValues.get();
+        storm::utility::vector::setVectorValues(values, entry.maybeStates.get(), storm::utility::convertNumber<ValueType>(0.5));
+    }
+    std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::move(values));
+    if (queryInformation.produceScheduler) {
+        result->template asExplicitQuantitativeCheckResult<ValueType>().setScheduler(std::make_unique<storm::storage::Scheduler<ValueType>>(*entry.scheduler));
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::shared_ptr<ModelCheckerHint> ExplicitModelCheckerResultCache<ValueType>::createHint(Entry const& entry) const {
+    auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+    if (entry.maybeStates) {
+        // Take the values of the non-maybe states from the qualitative analysis and (if available) initial values for the maybe states from a previous
+        // computation.
+        std::vector<ValueType> resultHint = entry.qualitativeValues.get();
+        if (entry.values) {
+            storm::utility::vector::setVectorValues(resultHint, entry.maybeStates.get(),
+                                                    storm::utility::vector::filterVector(entry.values.get(), entry.maybeStates.get()));
+        }
+        hint->setResultHint(std::move(resultHint));
+        hint->setMaybeStates(entry.maybeStates.get());
+        hint->setComputeOnlyMaybeStates(true);
+    } else if (entry.values) {
+        hint->setResultHint(entry.values.get());
+    }
+    if (entry.scheduler) {
+        hint->setSchedulerHint(*entry.scheduler);
+    }
+    return hint;
+}
+
+template class ExplicitModelCheckerResultCache<double>;
+template class ExplicitModelCheckerResultCache<storm::RationalNumber>;
+template class ExplicitModelCheckerResultCache<storm::RationalFunction>;
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/hints/ModelCheckerHint.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+
+namespace storm {
+
+class Environment;
+
+namespace modelchecker {
+
+class CheckResult;
+
+/*!
+ * This class caches the results of explicit model checking queries on a single model so that they can be reused across properties.
+ * A query is identified by the kind of computation, the phi/psi states, the reward model, and the optimization direction.
+ * - Queries whose result is cached precisely for all relevant states and with at least the requested solver precision are answered without any
+ *   computation.
+ * - Otherwise, the cached qualitative information (e.g. the states with probability zero/one), values, and schedulers are
+ *   used to warm-start the computation.
+ * @note A cache must only be used for a single (unmodified) model.
+ */
+template<typename ValueType>
+class ExplicitModelCheckerResultCache : public ModelCheckerHint {
+   public:
+    enum class QueryType { UntilProbabilities, ReachabilityRewards };
+
+    struct Key {
+        QueryType type;
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+        // The name of the considered reward model (empty for probabilities or for the unique reward model)
+        std::string rewardModelName;
+        boost::optional<storm::OptimizationDirection> direction;
+
+        bool operator<(Key const& other) const;
+    };
+
+    /*!
+     * Describes the precision with which values are computed.
+     */
+    struct SolutionPrecision {
+        // If set, the values are computed exactly and the remaining fields are ignored.
+        bool exact = false;
+        // If set, the values are guaranteed to be within the given precision.
+        bool sound = false;
+        storm::RationalNumber precision = storm::utility::zero<storm::RationalNumber>();
+        bool relative = false;
+
+        /*!
+         * Returns true iff values computed with this precision also meet the other precision.
+         */
+        bool isAtLeastAsStrictAs(SolutionPrecision const& other) const;
+    };
+
+    /*!
+     * Describes how the result of a query is going to be used.
+     */
+    struct QueryInformation {
+        // If set, only the values of these states are required to be precise.
+        boost::optional<storm::storage::BitVector> relevantStates;
+        // If set, only the qualitative information (value zero/one/infinity) is required.
+        bool qualitative = false;
+        // If set, the result also needs to provide a scheduler.
+        bool produceScheduler = false;
+        // If set, the computation might terminate early (e.g. because the values are only compared against a bound). Such results are only
+        // used as a hint for later computations.
+        bool mayTerminateEarly = false;
+        // The precision that is requested for the values.
+        SolutionPrecision precision;
+    };
+
+    using ComputationResult = std::pair<std::vector<ValueType>, std::unique_ptr<storm::storage::Scheduler<ValueType>>>;
+
+    ExplicitModelCheckerResultCache() = default;
+    virtual ~ExplicitModelCheckerResultCache() = default;
+
+    // Returns true iff the cache does not contain any information
+    virtual bool isEmpty() const override;
+
+    // Returns true iff this is an explicit model checker result cache
+    virtual bool isExplicitModelCheckerResultCache() const override;
+
+    /*!
+     * Returns true iff qualitative information (the maybe states and the values of the remaining states) is cached for the given query.
+     */
+    bool hasQualitativeInformation(Key const& key) const;
+
+    /*!
+     * Adds qualitative information to the cache.
+     * @param maybeStates the states whose value is not determined by the qualitative analysis
+     * @param qualitativeValues the values of the non-maybe states (e.g. zero or one). Entries of maybe states are ignored.
+     */
+    void setQualitativeInformation(Key const& key, storm::storage::BitVector const& maybeStates, std::vector<ValueType> const& qualitativeValues) const;
+
+    /*!
+     * Convenience method to add the qualitative information for until probabilities.
+     */
+    void setQualitativeInformation(Key const& key, storm::storage::BitVector const& statesWithProbability0,
+                                   storm::storage::BitVector const& statesWithProbability1) const;
+
+    /*!
+     * Returns the result of the given query. If the cache can not answer the query, the given computation is invoked with a hint derived from the
+     * cached information and its result is added to the cache.
+     */
+    std::unique_ptr<CheckResult> check(Key const& key, QueryInformation const& queryInformation,
+                                       std::function<ComputationResult(ModelCheckerHint const& hint)> const& computation) const;
+
+    /*!
+     * Retrieves the precision of values that are computed with a linear equation solver in the given environment.
+     */
+    static SolutionPrecision getLinearEquationSolverPrecision(Environment const& env);
+
+    /*!
+     * Retrieves the precision of values that are computed with a min-max equation solver in the given environment.
+     */
+    static SolutionPrecision getMinMaxSolverPrecision(Environment const& env);
+
+    /*!
+     * Derives the information on how the result of the given check task is going to be used.
+     * @param precision the precision of the solver that computes the values (see getLinearEquationSolverPrecision and getMinMaxSolverPrecision)
+     */
+    template<typename FormulaType>
+    static QueryInformation getQueryInformation(CheckTask<FormulaType, ValueType> const& checkTask, storm::storage::BitVector const& initialStates,
+                                                SolutionPrecision const& precision) {
+        QueryInformation result;
+        if (checkTask.isOnlyInitialStatesRelevantSet()) {
+            result.relevantStates = initialStates;
+        }
+        result.qualitative = checkTask.isQualitativeSet();
+        result.produceScheduler = checkTask.isProduceSchedulersSet();
+        result.mayTerminateEarly = checkTask.isBoundSet();
+        result.precision = precision;
+        return result;
+    }
+
+    /*!
+     * Removes all cached information.
+     */
+    void clear() const;
+
+    /*!
+     * Retrieves the number of queries that have been answered directly from the cache.
+     */
+    uint64_t getNumberOfCacheHits() const;
+
+   private:
+    struct Entry {
+        boost::optional<storm::storage::BitVector> maybeStates;
+        boost::optional<std::vector<ValueType>> qualitativeValues;
+        boost::optional<std::vector<ValueType>> values;
+        // The states for which the cached values are precise.
+        storm::storage::BitVector preciseStates;
+        // The precision with which the cached values were computed.
+        SolutionPrecision precision;
+        std::shared_ptr<storm::storage::Scheduler<ValueType>> scheduler;
+    };
+
+    bool hasPreciseValues(Entry const& entry, QueryInformation const& queryInformation) const;
+    bool isAnsweredByEntry(Entry const& entry, QueryInformation const& queryInformation) const;
+    std::unique_ptr<CheckResult> createCheckResult(Entry const& entry, QueryInformation const& queryInformation) const;
+    std::shared_ptr<ModelCheckerHint> createHint(Entry const& entry) const;
+
+    // The cache is filled while model checking which only gets const access to the hint.
+    mutable std::map<Key, Entry> entries;
+    mutable uint64_t numberOfCacheHits = 0;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
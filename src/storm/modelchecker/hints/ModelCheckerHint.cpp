@@ -1,6 +1,7 @@
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerResultCache.h"
 
 namespace storm {
 namespace modelchecker {
@@ -23,6 +24,15 @@ ExplicitModelCheckerHint<ValueType>& ModelCheckerHint::asExplicitModelCheckerHin
     return dynamic_cast<ExplicitModelCheckerHint<ValueType>&>(*this);
 }
 
+bool ModelCheckerHint::isExplicitModelCheckerResultCache() const {
+    return false;
+}
+
+template<typename ValueType>
+ExplicitModelCheckerResultCache<ValueType> const& ModelCheckerHint::asExplicitModelCheckerResultCache() const {
+    return dynamic_cast<ExplicitModelCheckerResultCache<ValueType> const&>(*this);
+}
+
 template ExplicitModelCheckerHint<double> const& ModelCheckerHint::asExplicitModelCheckerHint() const;
 template ExplicitModelCheckerHint<double>& ModelCheckerHint::asExplicitModelCheckerHint();
 template ExplicitModelCheckerHint<storm::RationalNumber> const& ModelCheckerHint::asExplicitModelCheckerHint() const;
@@ -32,5 +42,9 @@ template ExplicitModelCheckerHint<storm::RationalFunction>& ModelCheckerHint::as
 template ExplicitModelCheckerHint<storm::Interval> const& ModelCheckerHint::asExplicitModelCheckerHint() const;
 template ExplicitModelCheckerHint<storm::Interval>& ModelCheckerHint::asExplicitModelCheckerHint();
 
+template ExplicitModelCheckerResultCache<double> const& ModelCheckerHint::asExplicitModelCheckerResultCache() const;
+template ExplicitModelCheckerResultCache<storm::RationalNumber> const& ModelCheckerHint::asExplicitModelCheckerResultCache() const;
+template ExplicitModelCheckerResultCache<storm::RationalFunction> const& ModelCheckerHint::asExplicitModelCheckerResultCache() const;
+
 }  // namespace modelchecker
 }  // namespace storm
@@ -7,6 +7,8 @@ namespace modelchecker {
 
 template<typename ValueType>
 class ExplicitModelCheckerHint;
+template<typename ValueType>
+class ExplicitModelCheckerResultCache;
 
 /*!
  * This class contains information that might accelerate the model checking process.
@@ -28,6 +30,12 @@ class ModelCheckerHint {
 
     template<typename ValueType>
     ExplicitModelCheckerHint<ValueType> const& asExplicitModelCheckerHint() const;
+
+    // Returns true iff this is an explicit model checker result cache.
+    virtual bool isExplicitModelCheckerResultCache() const;
+
+    template<typename ValueType>
+    ExplicitModelCheckerResultCache<ValueType> const& asExplicitModelCheckerResultCache() const;
 };
 
 }  // namespace modelchecker
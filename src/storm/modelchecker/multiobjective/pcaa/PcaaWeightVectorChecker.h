@@ -69,6 +69,13 @@ class PcaaWeightVectorChecker {
      */
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const;
 
+    /*!
+     * Uses the information obtained in the most recent check of the given weight vector checker (operating on the same preprocessed model and objectives)
+     * to warm-start the next call of check(..) of this checker. This is beneficial if the corresponding weight vectors are close to each other.
+     * Weight vector checkers that do not support warm-starting ignore the hint.
+     */
+    virtual void setWarmStartHint(PcaaWeightVectorChecker<ModelType> const& other);
+
    protected:
     /*!
      * Computes the weighted lower or upper bounds for the provided set of objectives.
@@ -56,9 +56,20 @@ template<class SparseModelType, typename GeometryValueType>
 bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchievability(Environment const& env) {
     // repeatedly refine the over/ under approximation until the threshold point is either in the under approx. or not in the over approx.
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        WeightVector separatingVector = this->findSeparatingVector(thresholds);
-        this->updateWeightedPrecision(separatingVector);
-        this->performRefinementStep(env, std::move(separatingVector));
+        std::vector<WeightVector> separatingVectors = this->findSeparatingVectors(thresholds, this->getNumberOfConcurrentRefinementSteps(env));
+        // All vectors of a batch are checked with the finest precision required for one of them.
+        // The precision is kept if it can not be computed for any of the vectors.
+        boost::optional<typename SparseModelType::ValueType> weightedPrecision;
+        for (auto const& separatingVector : separatingVectors) {
+            auto precision = computeWeightedPrecision(separatingVector);
+            if (precision && (!weightedPrecision || precision.get() < weightedPrecision.get())) {
+                weightedPrecision = precision;
+            }
+        }
+        if (weightedPrecision) {
+            this->weightVectorChecker->setWeightedPrecision(weightedPrecision.get());
+        }
+        this->performRefinementSteps(env, std::move(separatingVectors));
         if (!checkIfThresholdsAreSatisfied(this->overApproximation)) {
             return false;
         }
@@ -71,7 +82,8 @@ bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchi
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::updateWeightedPrecision(WeightVector const& weights) {
+boost::optional<typename SparseModelType::ValueType> SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::computeWeightedPrecision(
+    WeightVector const& weights) const {
     // Our heuristic considers the distance between the under- and the over approximation w.r.t. the given direction
     std::pair<Point, bool> optimizationResOverApprox = this->overApproximation->optimize(weights);
     if (optimizationResOverApprox.second) {
@@ -83,10 +95,11 @@ void SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::updateWei
             // Normalize the distance by dividing it with the Euclidean Norm of the weight-vector
             distance /= storm::utility::sqrt(storm::utility::vector::dotProduct(weights, weights));
             distance /= GeometryValueType(2);
-            this->weightVectorChecker->setWeightedPrecision(storm::utility::convertNumber<typename SparseModelType::ValueType>(distance));
+            return storm::utility::convertNumber<typename SparseModelType::ValueType>(distance);
         }
     }
     // do not update the precision if one of the approximations is unbounded in the provided direction
+    return boost::none;
 }
 
 template<class SparseModelType, typename GeometryValueType>
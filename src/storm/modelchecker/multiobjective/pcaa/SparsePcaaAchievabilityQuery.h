@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAACHIEVABILITYQUERY_H_
 #define STORM_MODELCHECKER_MULTIOBJECTIVE_PCAA_SPARSEPCAAACHIEVABILITYQUERY_H_
 
+#include <boost/optional.hpp>
+
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
 namespace storm {
@@ -40,9 +42,10 @@ class SparsePcaaAchievabilityQuery : public SparsePcaaQuery<SparseModelType, Geo
     bool checkAchievability(Environment const& env);
 
     /*
-     * Updates the precision of the weightVectorChecker w.r.t. the provided weights
+     * Computes the precision of the weightVectorChecker w.r.t. the provided weights.
+     * Returns none if one of the approximations is unbounded in the provided direction.
      */
-    void updateWeightedPrecision(WeightVector const& weights);
+    boost::optional<typename SparseModelType::ValueType> computeWeightedPrecision(WeightVector const& weights) const;
 
     /*
      * Returns true iff there is one point in the given polytope that satisfies the given thresholds.
@@ -10,6 +10,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
+#include <algorithm>
+
 namespace storm {
 namespace modelchecker {
 namespace multiobjective {
@@ -63,37 +65,49 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        std::vector<WeightVector> directions;
+        for (uint64_t batchSize = this->getNumberOfConcurrentRefinementSteps(env); directions.size() < batchSize && objIndex < this->objectives.size();
+             ++objIndex) {
+            directions.emplace_back(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            directions.back()[objIndex] = storm::utility::one<GeometryValueType>();
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation ordered by their maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        GeometryValueType const precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
+        std::vector<std::pair<GeometryValueType, uint_fast64_t>> distanceAndHalfspaceIndex;
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
             for (auto const& vertex : overApproxVertices) {
-                GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
-                }
+                farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
+            }
+            if (farestDistance >= precision && !storm::utility::isZero(farestDistance)) {
+                distanceAndHalfspaceIndex.emplace_back(std::move(farestDistance), halfspaceIndex);
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        if (distanceAndHalfspaceIndex.empty()) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        std::stable_sort(distanceAndHalfspaceIndex.begin(), distanceAndHalfspaceIndex.end(),
+                         [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(distanceAndHalfspaceIndex.front().first));
+        // Refine in the directions of the farthest halfspaces. Without concurrency, this is only the farthest one.
+        std::vector<WeightVector> directions;
+        uint64_t const batchSize = std::min<uint64_t>(this->getNumberOfConcurrentRefinementSteps(env), distanceAndHalfspaceIndex.size());
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            directions.push_back(underApproxHalfspaces[distanceAndHalfspaceIndex[i].second].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -12,6 +14,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -29,8 +32,12 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
+    this->lastCheckedWeightVectors.resize(1);
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
     this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
@@ -88,17 +95,59 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
 }
 
 template<class SparseModelType, typename GeometryValueType>
-void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector>
+SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors) {
+    std::vector<WeightVector> result;
+    result.push_back(findSeparatingVector(pointToBeSeparated));
+    if (maxNumberOfVectors <= 1) {
+        return result;
+    }
+
+    if (underApproximation->isEmpty()) {
+        // Every weight vector is separating. We take the Dirac weight vectors that still need to be checked.
+        for (auto objIndex : storm::storage::BitVector(diracWeightVectorsToBeChecked)) {
+            if (result.size() >= maxNumberOfVectors) {
+                break;
+            }
+            WeightVector diracVector(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
+            diracVector[objIndex] = storm::utility::one<GeometryValueType>();
+            result.push_back(std::move(diracVector));
+            diracWeightVectorsToBeChecked.set(objIndex, false);
+        }
+        return result;
+    }
+
+    // Take the normal vectors of the remaining halfspaces that separate the point, the farthest ones first.
+    std::vector<std::pair<GeometryValueType, WeightVector>> candidates;
+    for (auto const& halfspace : underApproximation->getHalfspaces()) {
+        GeometryValueType distance = halfspace.euclideanDistance(pointToBeSeparated);
+        if (!storm::utility::isZero(distance) && halfspace.normalVector() != result.front()) {
+            candidates.emplace_back(std::move(distance), halfspace.normalVector());
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+    for (auto& candidate : candidates) {
+        if (result.size() >= maxNumberOfVectors) {
+            break;
+        }
+        result.push_back(std::move(candidate.second));
+    }
+    return result;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::checkWeightVector(
+    Environment const& env, WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const {
     // Normalize the direction vector so that the entries sum up to one
     storm::utility::vector::scaleVectorInPlace(
         direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+    checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
     STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                        storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
     RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+    step.weightVector = std::move(direction);
+    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
     // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
         if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -106,12 +155,105 @@ void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(
             step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
         }
     }
-    refinementSteps.push_back(std::move(step));
+    return step;
+}
+
+template<class SparseModelType, typename GeometryValueType>
+PcaaWeightVectorChecker<SparseModelType>& SparsePcaaQuery<SparseModelType, GeometryValueType>::getWeightVectorChecker(uint64_t index) {
+    if (index == 0) {
+        return *weightVectorChecker;
+    }
+    while (additionalWeightVectorCheckers.size() < index) {
+        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+        lastCheckedWeightVectors.emplace_back();
+    }
+    return *additionalWeightVectorCheckers[index - 1];
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
+    refinementSteps.push_back(checkWeightVector(env, std::move(direction), *weightVectorChecker));
+    lastCheckedWeightVectors.front() = refinementSteps.back().weightVector;
 
     updateOverApproximation();
     updateUnderApproximation();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getNumberOfConcurrentRefinementSteps(Environment const& env) const {
+    uint64_t result = env.modelchecker().multi().getNumberOfWeightVectorThreads();
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t const maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps > refinementSteps.size() ? maxSteps - refinementSteps.size() : 0);
+    }
+    return std::max<uint64_t>(result, 1);
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    uint64_t const numberOfThreads = std::min<uint64_t>(env.modelchecker().multi().getNumberOfWeightVectorThreads(), directions.size());
+    bool const concurrent = numberOfThreads > 1 && std::is_same<typename SparseModelType::ValueType, double>::value;
+    STORM_LOG_WARN_COND(concurrent || numberOfThreads <= 1, "Weight vectors are only checked concurrently for models with floating point values.");
+    if (!concurrent) {
+        for (auto& direction : directions) {
+            performRefinementStep(env, std::move(direction));
+        }
+        return;
+    }
+
+    for (uint64_t batchBegin = 0; batchBegin < directions.size(); batchBegin += numberOfThreads) {
+        uint64_t const batchSize = std::min<uint64_t>(numberOfThreads, directions.size() - batchBegin);
+
+        // Prepare the weight vector checkers. Each check is warm-started with the results of the checker whose last weight vector is most similar.
+        std::vector<storm::Environment> environments(batchSize, env);
+        std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers;
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            checkers.push_back(&getWeightVectorChecker(i));
+        }
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            auto& checker = *checkers[i];
+            checker.setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+            WeightVector const& direction = directions[batchBegin + i];
+            uint64_t mostSimilarChecker = lastCheckedWeightVectors.size();
+            GeometryValueType smallestDistance;
+            for (uint64_t other = 0; other < lastCheckedWeightVectors.size(); ++other) {
+                if (lastCheckedWeightVectors[other].empty()) {
+                    continue;
+                }
+                // Compare the directions of the (not necessarily normalized) vectors.
+                auto difference = lastCheckedWeightVectors[other];
+                GeometryValueType directionSum = std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>());
+                for (uint64_t objIndex = 0; objIndex < difference.size(); ++objIndex) {
+                    difference[objIndex] -= direction[objIndex] / directionSum;
+                }
+                GeometryValueType distance = storm::utility::vector::dotProduct(difference, difference);
+                if (mostSimilarChecker == lastCheckedWeightVectors.size() || distance < smallestDistance) {
+                    mostSimilarChecker = other;
+                    smallestDistance = std::move(distance);
+                }
+            }
+            if (mostSimilarChecker < lastCheckedWeightVectors.size()) {
+                checker.setWarmStartHint(getWeightVectorChecker(mostSimilarChecker));
+            }
+        }
+
+        std::vector<RefinementStep> steps(batchSize);
+        storm::utility::processInParallel(0, batchSize, batchSize, [&](uint64_t chunkBegin, uint64_t chunkEnd, uint64_t) {
+            for (uint64_t i = chunkBegin; i < chunkEnd; ++i) {
+                steps[i] = checkWeightVector(environments[i], std::move(directions[batchBegin + i]), *checkers[i]);
+            }
+        });
+
+        // Incorporate the results in the order of the given directions.
+        for (uint64_t i = 0; i < batchSize; ++i) {
+            lastCheckedWeightVectors[i] = steps[i].weightVector;
+            refinementSteps.push_back(std::move(steps[i]));
+            updateOverApproximation();
+        }
+        updateUnderApproximation();
+    }
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
     storm::storage::geometry::Halfspace<GeometryValueType> h(
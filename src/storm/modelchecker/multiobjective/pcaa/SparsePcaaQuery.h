@@ -63,11 +63,31 @@ class SparsePcaaQuery {
      */
     WeightVector findSeparatingVector(Point const& pointToBeSeparated);
 
+    /*
+     * Returns (at most the given number of) weight vectors that separate the under approximation from the given point.
+     * The first weight vector is the one returned by findSeparatingVector. The remaining ones are normal vectors of other halfspaces of the under
+     * approximation that also separate the point, ordered by their distance to the point.
+     */
+    std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors);
+
     /*
      * Refines the current result w.r.t. the given direction vector.
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. the given direction vectors.
+     * If enabled in the environment, the weight vectors are checked concurrently, each with its own weight vector checker.
+     * In this case, each check is warm-started with the information of the most similar weight vector that has been checked before.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of weight vectors that can be checked concurrently in a single call of performRefinementSteps(..),
+     * taking the maximum number of refinement steps into account.
+     */
+    uint64_t getNumberOfConcurrentRefinementSteps(Environment const& env) const;
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -105,6 +125,24 @@ class SparsePcaaQuery {
     // stores for each objective whether it still makes sense to check for this objective individually (i.e., with weight vector given by w_{i}>0 iff i=objIndex
     // )
     storm::storage::BitVector diracWeightVectorsToBeChecked;
+
+   private:
+    /*
+     * Normalizes the given direction vector and checks it using the given weight vector checker.
+     */
+    RefinementStep checkWeightVector(Environment const& env, WeightVector&& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const;
+
+    /*
+     * Retrieves the weight vector checker with the given index, where index zero refers to the main weight vector checker.
+     */
+    PcaaWeightVectorChecker<SparseModelType>& getWeightVectorChecker(uint64_t index);
+
+    // The preprocessed query (required to create further weight vector checkers)
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
+    // Further weight vector checkers that are used to check weight vectors concurrently
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+    // For each weight vector checker (including the main one), the weight vector of its most recent check (if any)
+    std::vector<WeightVector> lastCheckedWeightVectors;
 };
 
 }  // namespace multiobjective
@@ -67,7 +67,8 @@ void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::boundedPhase(Enviro
     // Allocate some memory so this does not need to happen for each time epoch
     std::vector<uint_fast64_t> optimalChoicesInCurrentEpoch(this->transitionMatrix.getRowGroupCount());
     std::vector<ValueType> choiceValues(weightedRewardVector.size());
-    std::vector<ValueType> temporaryResult(this->transitionMatrix.getRowGroupCount());
+    std::vector<std::vector<ValueType>> temporaryResults;
+    std::vector<uint_fast64_t> consideredObjIndices;
     // Get for each occurring timeBound the indices of the objectives with that bound.
     std::map<uint_fast64_t, storm::storage::BitVector, std::greater<uint_fast64_t>> stepBounds;
     for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
@@ -109,22 +110,22 @@ void StandardMdpPcaaWeightVectorChecker<SparseMdpModelType>::boundedPhase(Enviro
         storm::utility::vector::addVectors(choiceValues, weightedRewardVector, choiceValues);
         storm::utility::vector::reduceVectorMax(choiceValues, this->weightedResult, this->transitionMatrix.getRowGroupIndices(), &optimalChoicesInCurrentEpoch);
 
-        // get values for individual objectives
-        for (auto objIndex : consideredObjectives) {
-            std::vector<ValueType>& objectiveResult = this->objectiveResults[objIndex];
-            std::vector<ValueType> const& objectiveRewards = this->actionRewards[objIndex];
-            auto rowGroupIndexIt = this->transitionMatrix.getRowGroupIndices().begin();
-            auto optimalChoiceIt = optimalChoicesInCurrentEpoch.begin();
-            for (ValueType& stateValue : temporaryResult) {
-                uint_fast64_t row = (*rowGroupIndexIt) + (*optimalChoiceIt);
-                ++rowGroupIndexIt;
-                ++optimalChoiceIt;
-                stateValue = objectiveRewards[row];
-                for (auto const& entry : this->transitionMatrix.getRow(row)) {
-                    stateValue += entry.getValue() * objectiveResult[entry.getColumn()];
+        // get values for individual objectives. All objectives are processed in a single pass over the matrix.
+        consideredObjIndices.assign(consideredObjectives.begin(), consideredObjectives.end());
+        temporaryResults.resize(consideredObjIndices.size(), std::vector<ValueType>(this->transitionMatrix.getRowGroupCount()));
+        for (uint_fast64_t state = 0; state < this->transitionMatrix.getRowGroupCount(); ++state) {
+            uint_fast64_t row = this->transitionMatrix.getRowGroupIndices()[state] + optimalChoicesInCurrentEpoch[state];
+            for (uint_fast64_t i = 0; i < consideredObjIndices.size(); ++i) {
+                temporaryResults[i][state] = this->actionRewards[consideredObjIndices[i]][row];
+            }
+            for (auto const& entry : this->transitionMatrix.getRow(row)) {
+                for (uint_fast64_t i = 0; i < consideredObjIndices.size(); ++i) {
+                    temporaryResults[i][state] += entry.getValue() * this->objectiveResults[consideredObjIndices[i]][entry.getColumn()];
                 }
             }
-            objectiveResult.swap(temporaryResult);
+        }
+        for (uint_fast64_t i = 0; i < consideredObjIndices.size(); ++i) {
+            this->objectiveResults[consideredObjIndices[i]].swap(temporaryResults[i]);
         }
         --currentEpoch;
     }
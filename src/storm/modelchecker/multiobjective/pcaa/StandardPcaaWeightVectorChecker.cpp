@@ -3,6 +3,9 @@
 #include <map>
 #include <set>
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/multiobjective/preprocessing/SparseMultiObjectiveRewardAnalysis.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
@@ -14,7 +17,10 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/helper/ValueIterationHelper.h"
+#include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/transformer/GoalStateMerger.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -29,6 +35,23 @@ namespace storm {
 namespace modelchecker {
 namespace multiobjective {
 
+/*!
+ * Returns true if the values of the individual objectives are to be computed simultaneously using (unsound) value iteration.
+ * As this is not sound, it is only done if the user explicitly selected the native power method and no sound or exact results are required.
+ * Otherwise, the objectives are checked one after another using the configured linear equation solver.
+ */
+template<typename ValueType>
+bool useValueIterationForIndividualObjectives(Environment const& env) {
+    if (!std::is_same_v<ValueType, double> || env.solver().isForceSoundness() || env.solver().isForceExact()) {
+        return false;
+    }
+    if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue() || env.solver().native().isMethodSetFromDefault()) {
+        return false;
+    }
+    return env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native &&
+           env.solver().native().getMethod() == storm::solver::NativeLinearEquationSolverMethod::Power;
+}
+
 template<class SparseModelType>
 StandardPcaaWeightVectorChecker<SparseModelType>::StandardPcaaWeightVectorChecker(
     preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult)
@@ -191,6 +214,14 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::check(Environment const&
                     "The desired precision was not reached");
 }
 
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::setWarmStartHint(PcaaWeightVectorChecker<SparseModelType> const& other) {
+    auto const* otherStandardChecker = dynamic_cast<StandardPcaaWeightVectorChecker<SparseModelType> const*>(&other);
+    if (otherStandardChecker && otherStandardChecker->ecqSchedulerOfLastCheck) {
+        ecqSchedulerHint = otherStandardChecker->ecqSchedulerOfLastCheck;
+    }
+}
+
 template<class SparseModelType>
 std::vector<typename StandardPcaaWeightVectorChecker<SparseModelType>::ValueType>
 StandardPcaaWeightVectorChecker<SparseModelType>::getUnderApproximationOfInitialStateResults() const {
@@ -434,7 +465,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     solver->setTrackScheduler(true);
     solver->setHasUniqueSolution(true);
     solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
-    auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize);
+    // The optimal scheduler of a previous check is valid for the same EC quotient as it does not stay in an EC forever.
+    bool useSchedulerHint = ecqSchedulerHint && ecqSchedulerHint->origReward0Choices == ecQuotient->origReward0Choices;
+    auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize, useSchedulerHint);
     setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix,
                       ecQuotient->rowsWithSumLessOne, ecQuotient->auxChoiceValues);
     if (solver->hasLowerBound()) {
@@ -443,10 +476,14 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     if (solver->hasUpperBound()) {
         req.clearUpperBounds();
     }
-    if (req.validInitialScheduler()) {
+    if (useSchedulerHint) {
+        solver->setInitialScheduler(std::move(ecqSchedulerHint->choices));
+        req.clearValidInitialScheduler();
+    } else if (req.validInitialScheduler()) {
         solver->setInitialScheduler(computeValidInitialScheduler(ecQuotient->matrix, ecQuotient->rowsWithSumLessOne));
         req.clearValidInitialScheduler();
     }
+    ecqSchedulerHint = boost::none;
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
@@ -455,6 +492,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
     std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
 
     solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
+    ecqSchedulerOfLastCheck = EcqScheduler{solver->getSchedulerChoices(), ecQuotient->origReward0Choices};
     this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
 
     transformEcqSolutionToOriginalModel(ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecqStateToOptimalMecMap, this->weightedResult,
@@ -488,6 +526,29 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
         std::vector<ValueType> weightedSumOfUncheckedObjectives = weightedResult;
         ValueType sumOfWeightsOfUncheckedObjectives = storm::utility::vector::sum_if(weightVector, objectivesWithNoUpperTimeBound);
 
+        // If the equation systems would be solved by value iteration anyway, all total reward objectives are handled at once.
+        storm::storage::BitVector simultaneousObjectives = objectivesWithNoUpperTimeBound & ~lraObjectives;
+        if (simultaneousObjectives.getNumberOfSetBits() > 1 && useValueIterationForIndividualObjectives<ValueType>(env)) {
+            for (auto objIndex : simultaneousObjectives) {
+                // The estimates serve as initial values
+                if (storm::utility::isZero(weightVector[objIndex])) {
+                    objectiveResults[objIndex] = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
+                } else {
+                    objectiveResults[objIndex] = weightedResult;
+                    ValueType scalingFactor = storm::utility::one<ValueType>() / sumOfWeightsOfUncheckedObjectives;
+                    if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                        scalingFactor *= -storm::utility::one<ValueType>();
+                    }
+                    storm::utility::vector::scaleVectorInPlace(objectiveResults[objIndex], scalingFactor);
+                    storm::utility::vector::clip(objectiveResults[objIndex], this->objectives[objIndex].lowerResultBound,
+                                                 this->objectives[objIndex].upperResultBound);
+                }
+            }
+            computeTotalRewardsSimultaneously(env, deterministicMatrix, deterministicBackwardTransitions, simultaneousObjectives);
+        } else {
+            simultaneousObjectives.clear();
+        }
+
         for (uint_fast64_t const& objIndex : storm::utility::vector::getSortedIndices(weightVector)) {
             auto const& obj = this->objectives[objIndex];
             if (objectivesWithNoUpperTimeBound.get(objIndex)) {
@@ -504,7 +565,7 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
                         stateValueGetter = [&](uint64_t const& s) { return stateRewards[objIndex][s]; };
                     }
                     objectiveResults[objIndex] = infiniteHorizonHelper.computeLongRunAverageValues(env, stateValueGetter, actionValueGetter);
-                } else {  // i.e. a total reward objective
+                } else if (!simultaneousObjectives.get(objIndex)) {  // i.e. a total reward objective that has not been considered yet
                     storm::utility::vector::selectVectorValues(deterministicStateRewards, this->optimalChoices, transitionMatrix.getRowGroupIndices(),
                                                                actionRewards[objIndex]);
                     storm::storage::BitVector statesWithRewards = ~storm::utility::vector::filterZero(deterministicStateRewards);
@@ -573,6 +634,71 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedIndividualPhase(
     }
 }
 
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::computeTotalRewardsSimultaneously(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+    storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions, storm::storage::BitVector const& objectiveFilter) {
+    std::vector<uint64_t> const objIndices(objectiveFilter.begin(), objectiveFilter.end());
+    uint64_t const dimension = objIndices.size();
+    uint64_t const numberOfStates = deterministicMatrix.getRowCount();
+
+    // Get the rewards of all objectives under the scheduler.
+    // As maybestates we pick the states from which a state with reward (for some objective) is reachable. The other states get value zero.
+    std::vector<std::vector<ValueType>> deterministicStateRewards(dimension, std::vector<ValueType>(numberOfStates));
+    storm::storage::BitVector statesWithRewards(numberOfStates, false);
+    for (uint64_t dim = 0; dim < dimension; ++dim) {
+        storm::utility::vector::selectVectorValues(deterministicStateRewards[dim], this->optimalChoices, transitionMatrix.getRowGroupIndices(),
+                                                   actionRewards[objIndices[dim]]);
+        statesWithRewards |= ~storm::utility::vector::filterZero(deterministicStateRewards[dim]);
+    }
+    storm::storage::BitVector maybeStates =
+        storm::utility::graph::performProbGreater0(deterministicBackwardTransitions, storm::storage::BitVector(numberOfStates, true), statesWithRewards);
+
+    if (!maybeStates.empty()) {
+        storm::storage::SparseMatrix<ValueType> submatrix = deterministicMatrix.getSubmatrix(true, maybeStates, maybeStates);
+        storm::solver::helper::InterleavedVectors<ValueType> x(maybeStates.getNumberOfSetBits(), dimension);
+        storm::solver::helper::InterleavedVectors<ValueType> b(maybeStates.getNumberOfSetBits(), dimension);
+        uint64_t subsystemState = 0;
+        for (auto state : maybeStates) {
+            for (uint64_t dim = 0; dim < dimension; ++dim) {
+                x.get(subsystemState, dim) = objectiveResults[objIndices[dim]][state];
+                b.get(subsystemState, dim) = deterministicStateRewards[dim][state];
+            }
+            ++subsystemState;
+        }
+
+        auto viOperator = std::make_shared<storm::solver::helper::ValueIterationOperator<ValueType, true>>();
+        viOperator->setMatrixBackwards(submatrix);
+        storm::solver::helper::ValueIterationHelper<ValueType, true> viHelper(viOperator);
+        uint64_t numIterations = 0;
+        auto viCallback = [&](storm::solver::SolverStatus const& current) {
+            if (numIterations >= env.solver().native().getMaximalNumberOfIterations()) {
+                return storm::solver::SolverStatus::MaximalIterationsExceeded;
+            } else if (storm::utility::resources::isTerminate()) {
+                return storm::solver::SolverStatus::Aborted;
+            }
+            return current;
+        };
+        auto status = viHelper.VI(x, b, numIterations, env.solver().native().getRelativeTerminationCriterion(),
+                                  storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), viCallback,
+                                  env.solver().native().getPowerMethodMultiplicationStyle());
+        STORM_LOG_WARN_COND(status == storm::solver::SolverStatus::Converged,
+                            "Value iteration for the individual objectives did not converge within " << numIterations << " iterations.");
+        STORM_LOG_INFO("Computed the values of " << dimension << " total reward objectives simultaneously in " << numIterations << " iterations.");
+
+        subsystemState = 0;
+        for (auto state : maybeStates) {
+            for (uint64_t dim = 0; dim < dimension; ++dim) {
+                objectiveResults[objIndices[dim]][state] = x.get(subsystemState, dim);
+            }
+            ++subsystemState;
+        }
+    }
+    for (auto objIndex : objIndices) {
+        storm::utility::vector::setVectorValues<ValueType>(objectiveResults[objIndex], ~maybeStates, storm::utility::zero<ValueType>());
+    }
+}
+
 template<class SparseModelType>
 void StandardPcaaWeightVectorChecker<SparseModelType>::updateEcQuotient(std::vector<ValueType> const& weightedRewardVector) {
     // Check whether we need to update the currently cached ecElimResult
@@ -67,6 +67,8 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const override;
 
+    virtual void setWarmStartHint(PcaaWeightVectorChecker<SparseModelType> const& other) override;
+
    protected:
     void initialize(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult);
     virtual void initializeModelTypeSpecificData(SparseModelType const& model) = 0;
@@ -90,6 +92,19 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     void unboundedIndividualPhase(Environment const& env, std::vector<ValueType> const& weightVector);
 
+    /*!
+     * Computes the values of the given total reward objectives w.r.t. the scheduler computed in the unboundedWeightedPhase.
+     * All objectives are processed in a single value iteration, i.e., each iteration requires only one pass over the transition matrix.
+     * The current objective results serve as initial values.
+     *
+     * @param deterministicMatrix the transition matrix induced by the scheduler
+     * @param deterministicBackwardTransitions the transposed of the deterministicMatrix
+     * @param objectiveFilter the objectives to consider
+     */
+    void computeTotalRewardsSimultaneously(Environment const& env, storm::storage::SparseMatrix<ValueType> const& deterministicMatrix,
+                                           storm::storage::SparseMatrix<ValueType> const& deterministicBackwardTransitions,
+                                           storm::storage::BitVector const& objectiveFilter);
+
     /*!
      * For each time epoch (starting with the maximal stepBound occurring in the objectives), this method
      * - determines the objectives that are relevant in the current time epoch
@@ -178,6 +193,16 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
         std::vector<ValueType> auxMecValues;
     };
     boost::optional<LraMecDecomposition> lraMecDecomposition;
+
+    // A scheduler for the EC quotient together with the zero-reward choices for which the quotient has been built.
+    struct EcqScheduler {
+        std::vector<uint64_t> choices;
+        storm::storage::BitVector origReward0Choices;
+    };
+    // The optimal scheduler for the EC quotient obtained in the most recent call of check(..)
+    boost::optional<EcqScheduler> ecqSchedulerOfLastCheck;
+    // If set, this scheduler is used as initial scheduler in the next call of check(..) (provided that the EC quotient is the same)
+    boost::optional<EcqScheduler> ecqSchedulerHint;
 };
 
 }  // namespace multiobjective
@@ -4,8 +4,10 @@
 #include <vector>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerResultCache.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/helper/finitehorizon/SparseDeterministicStepBoundedHorizonHelper.h"
 #include "storm/modelchecker/helper/indefinitehorizon/visitingtimes/SparseDeterministicVisitingTimesHelper.h"
@@ -21,6 +23,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/SolveGoal.h"
 #include "storm/utility/FilteredRewardModel.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -121,6 +124,25 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+    if (checkTask.getHint().isExplicitModelCheckerResultCache()) {
+        using ResultCache = ExplicitModelCheckerResultCache<ValueType>;
+        auto const& cache = checkTask.getHint().template asExplicitModelCheckerResultCache<ValueType>();
+        typename ResultCache::Key key{ResultCache::QueryType::UntilProbabilities, leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), "",
+                                      boost::none};
+        if (!cache.hasQualitativeInformation(key)) {
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(
+                this->getModel().getBackwardTransitions(), key.phiStates, key.psiStates, env.modelchecker().getNumberOfGraphAnalysisThreads());
+            cache.setQualitativeInformation(key, statesWithProbability01.first, statesWithProbability01.second);
+        }
+        auto queryInformation =
+            ResultCache::getQueryInformation(checkTask, this->getModel().getInitialStates(), ResultCache::getLinearEquationSolverPrecision(env));
+        return cache.check(key, queryInformation, [&](ModelCheckerHint const& hint) {
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
+                env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                this->getModel().getBackwardTransitions(), key.phiStates, key.psiStates, checkTask.isQualitativeSet(), hint);
+            return typename ResultCache::ComputationResult(std::move(numericResult), nullptr);
+        });
+    }
     std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
         env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
@@ -218,6 +240,20 @@ std::unique_ptr<CheckResult> SparseDtmcPrctlModelChecker<SparseDtmcModelType>::c
     std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+    if (checkTask.getHint().isExplicitModelCheckerResultCache() && !eventuallyFormula.hasRewardAccumulation()) {
+        using ResultCache = ExplicitModelCheckerResultCache<ValueType>;
+        auto const& cache = checkTask.getHint().template asExplicitModelCheckerResultCache<ValueType>();
+        typename ResultCache::Key key{ResultCache::QueryType::ReachabilityRewards, storm::storage::BitVector(), subResult.getTruthValuesVector(),
+                                      checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "", boost::none};
+        auto queryInformation =
+            ResultCache::getQueryInformation(checkTask, this->getModel().getInitialStates(), ResultCache::getLinearEquationSolverPrecision(env));
+        return cache.check(key, queryInformation, [&](ModelCheckerHint const& hint) {
+            std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(
+                env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                this->getModel().getBackwardTransitions(), rewardModel.get(), key.psiStates, checkTask.isQualitativeSet(), hint);
+            return typename ResultCache::ComputationResult(std::move(numericResult), nullptr);
+        });
+    }
     std::vector<ValueType> numericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeReachabilityRewards(
         env, storm::solver::SolveGoal<ValueType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(), checkTask.getHint());
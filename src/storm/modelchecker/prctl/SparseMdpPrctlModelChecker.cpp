@@ -1,8 +1,10 @@
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerResultCache.h"
 #include "storm/modelchecker/helper/finitehorizon/SparseNondeterministicStepBoundedHorizonHelper.h"
 #include "storm/modelchecker/helper/infinitehorizon/SparseNondeterministicInfiniteHorizonHelper.h"
 #include "storm/modelchecker/helper/ltl/SparseLTLHelper.h"
@@ -171,6 +173,37 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     std::unique_ptr<CheckResult> rightResultPointer = this->check(env, pathFormula.getRightSubformula());
     ExplicitQualitativeCheckResult const& leftResult = leftResultPointer->asExplicitQualitativeCheckResult();
     ExplicitQualitativeCheckResult const& rightResult = rightResultPointer->asExplicitQualitativeCheckResult();
+    if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+        if (checkTask.getHint().isExplicitModelCheckerResultCache()) {
+            using ResultCache = ExplicitModelCheckerResultCache<SolutionType>;
+            auto const& cache = checkTask.getHint().template asExplicitModelCheckerResultCache<SolutionType>();
+            typename ResultCache::Key key{ResultCache::QueryType::UntilProbabilities, leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), "",
+                                          checkTask.getOptimizationDirection()};
+            if (!cache.hasQualitativeInformation(key)) {
+                auto const& transitionMatrix = this->getModel().getTransitionMatrix();
+                auto const& backwardTransitions = this->getModel().getBackwardTransitions();
+                std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+                uint64_t const numberOfThreads = env.modelchecker().getNumberOfGraphAnalysisThreads();
+                if (storm::solver::minimize(checkTask.getOptimizationDirection())) {
+                    statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(),
+                                                                                      backwardTransitions, key.phiStates, key.psiStates, numberOfThreads);
+                } else {
+                    statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(),
+                                                                                      backwardTransitions, key.phiStates, key.psiStates, numberOfThreads);
+                }
+                cache.setQualitativeInformation(key, statesWithProbability01.first, statesWithProbability01.second);
+            }
+            auto queryInformation =
+                ResultCache::getQueryInformation(checkTask, this->getModel().getInitialStates(), ResultCache::getMinMaxSolverPrecision(env));
+            return cache.check(key, queryInformation, [&](ModelCheckerHint const& hint) {
+                auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
+                    env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                    this->getModel().getBackwardTransitions(), key.phiStates, key.psiStates, checkTask.isQualitativeSet(), checkTask.isProduceSchedulersSet(),
+                    hint);
+                return std::make_pair(std::move(ret.values), std::move(ret.scheduler));
+            });
+        }
+    }
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeUntilProbabilities(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), leftResult.getTruthValuesVector(), rightResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
@@ -337,6 +370,23 @@ std::unique_ptr<CheckResult> SparseMdpPrctlModelChecker<SparseMdpModelType>::com
     std::unique_ptr<CheckResult> subResultPointer = this->check(env, eventuallyFormula.getSubformula());
     ExplicitQualitativeCheckResult const& subResult = subResultPointer->asExplicitQualitativeCheckResult();
     auto rewardModel = storm::utility::createFilteredRewardModel(this->getModel(), checkTask);
+    if constexpr (!std::is_same_v<ValueType, storm::Interval>) {
+        if (checkTask.getHint().isExplicitModelCheckerResultCache() && !eventuallyFormula.hasRewardAccumulation()) {
+            using ResultCache = ExplicitModelCheckerResultCache<SolutionType>;
+            auto const& cache = checkTask.getHint().template asExplicitModelCheckerResultCache<SolutionType>();
+            typename ResultCache::Key key{ResultCache::QueryType::ReachabilityRewards, storm::storage::BitVector(), subResult.getTruthValuesVector(),
+                                          checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "", checkTask.getOptimizationDirection()};
+            auto queryInformation =
+                ResultCache::getQueryInformation(checkTask, this->getModel().getInitialStates(), ResultCache::getMinMaxSolverPrecision(env));
+            return cache.check(key, queryInformation, [&](ModelCheckerHint const& hint) {
+                auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
+                    env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
+                    this->getModel().getBackwardTransitions(), rewardModel.get(), key.psiStates, checkTask.isQualitativeSet(),
+                    checkTask.isProduceSchedulersSet(), hint);
+                return std::make_pair(std::move(ret.values), std::move(ret.scheduler));
+            });
+        }
+    }
     auto ret = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType, SolutionType>::computeReachabilityRewards(
         env, storm::solver::SolveGoal<ValueType, SolutionType>(this->getModel(), checkTask), this->getModel().getTransitionMatrix(),
         this->getModel().getBackwardTransitions(), rewardModel.get(), subResult.getTruthValuesVector(), checkTask.isQualitativeSet(),
@@ -19,6 +19,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -84,32 +85,70 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
 
+    bool const exportCdf = storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet();
+    auto getCdfEntry = [&rewardUnfolding](typename storm::modelchecker::helper::rewardbounded::EpochManager::Epoch const& epoch) {
+        std::vector<ValueType> cdfEntry;
+        for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+            uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+            cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                               rewardUnfolding.getDimension(i).scalingFactor);
+        }
+        cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+        return cdfEntry;
+    };
+
+    uint64_t numberOfThreads = env.modelchecker().getNumberOfEpochThreads();
+    if (numberOfThreads > 1 && !std::is_same<ValueType, double>::value) {
+        STORM_LOG_WARN("Epochs are only analyzed concurrently for double precision values. Falling back to a single thread.");
+        numberOfThreads = 1;
+    }
+
     storm::utility::ProgressMeasurement progress("epochs");
     progress.setMaxCount(epochOrder.size());
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
+    if (numberOfThreads == 1) {
+        for (auto const& epoch : epochOrder) {
+            swBuild.start();
+            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+            swBuild.stop();
+            swCheck.start();
+            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+            swCheck.stop();
+            if (exportCdf && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                cdfData.push_back(getCdfEntry(epoch));
+            }
+            ++numCheckedEpochs;
+            progress.updateProgress(numCheckedEpochs);
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+        }
+    } else {
+        // Each thread uses its own solver and vectors. Epoch model building and checking can not be distinguished here.
+        std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+        std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+        std::vector<Environment> threadEnvs(numberOfThreads, preciseEnv);
+        std::vector<std::vector<ValueType>> cdfEntries(exportCdf ? epochOrder.size() : 0);
         swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+        rewardUnfolding.analyzeEpochs(
+            epochOrder, numberOfThreads,
+            [&](uint64_t thread, auto& epochModel) {
+                return epochModel.analyzeSingleObjective(threadEnvs[thread], threadX[thread], threadB[thread], threadSolvers[thread], lowerBound, upperBound);
+            },
+            [&](uint64_t epochIndex) {
+                if (exportCdf && !rewardUnfolding.getEpochManager().hasBottomDimension(epochOrder[epochIndex])) {
+                    cdfEntries[epochIndex] = getCdfEntry(epochOrder[epochIndex]);
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+            },
+            env.modelchecker().getEpochMemoryLimit());
         swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+        for (auto& cdfEntry : cdfEntries) {
+            if (!cdfEntry.empty()) {
+                cdfData.push_back(std::move(cdfEntry));
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
-        }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
-        if (storm::utility::resources::isTerminate()) {
-            break;
         }
     }
 
@@ -120,7 +159,7 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
 
     swAll.stop();
 
-    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+    if (exportCdf) {
         std::vector<std::string> headers;
         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
             headers.push_back(rewardUnfolding.getDimension(i).formula->toString());
@@ -177,7 +216,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates, env.modelchecker().getNumberOfGraphAnalysisThreads());
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -40,6 +40,7 @@
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -83,32 +84,71 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
         // In case of cdf export we store the necessary data.
         std::vector<std::vector<ValueType>> cdfData;
 
+        bool const exportCdf = storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet();
+        auto getCdfEntry = [&rewardUnfolding](typename rewardbounded::EpochManager::Epoch const& epoch) {
+            std::vector<ValueType> cdfEntry;
+            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                   rewardUnfolding.getDimension(i).scalingFactor);
+            }
+            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+            return cdfEntry;
+        };
+
+        uint64_t numberOfThreads = env.modelchecker().getNumberOfEpochThreads();
+        if (numberOfThreads > 1 && !std::is_same<ValueType, double>::value) {
+            STORM_LOG_WARN("Epochs are only analyzed concurrently for double precision values. Falling back to a single thread.");
+            numberOfThreads = 1;
+        }
+
         storm::utility::ProgressMeasurement progress("epochs");
         progress.setMaxCount(epochOrder.size());
         progress.startNewMeasurement(0);
         uint64_t numCheckedEpochs = 0;
-        for (auto const& epoch : epochOrder) {
-            swBuild.start();
-            auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-            swBuild.stop();
+        if (numberOfThreads == 1) {
+            for (auto const& epoch : epochOrder) {
+                swBuild.start();
+                auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                swBuild.stop();
+                swCheck.start();
+                rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                swCheck.stop();
+                if (exportCdf && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                    cdfData.push_back(getCdfEntry(epoch));
+                }
+                ++numCheckedEpochs;
+                progress.updateProgress(numCheckedEpochs);
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            }
+        } else {
+            // Each thread uses its own solver and vectors. Epoch model building and checking can not be distinguished here.
+            std::vector<std::vector<ValueType>> threadX(numberOfThreads), threadB(numberOfThreads);
+            std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> threadSolvers(numberOfThreads);
+            std::vector<Environment> threadEnvs(numberOfThreads, preciseEnv);
+            std::vector<std::vector<ValueType>> cdfEntries(exportCdf ? epochOrder.size() : 0);
             swCheck.start();
-            rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+            rewardUnfolding.analyzeEpochs(
+                epochOrder, numberOfThreads,
+                [&](uint64_t thread, auto& epochModel) {
+                    return epochModel.analyzeSingleObjective(threadEnvs[thread], dir, threadX[thread], threadB[thread], threadSolvers[thread], lowerBound,
+                                                             upperBound);
+                },
+                [&](uint64_t epochIndex) {
+                    if (exportCdf && !rewardUnfolding.getEpochManager().hasBottomDimension(epochOrder[epochIndex])) {
+                        cdfEntries[epochIndex] = getCdfEntry(epochOrder[epochIndex]);
+                    }
+                    ++numCheckedEpochs;
+                    progress.updateProgress(numCheckedEpochs);
+                },
+                env.modelchecker().getEpochMemoryLimit());
             swCheck.stop();
-            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-                std::vector<ValueType> cdfEntry;
-                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                       rewardUnfolding.getDimension(i).scalingFactor);
+            for (auto& cdfEntry : cdfEntries) {
+                if (!cdfEntry.empty()) {
+                    cdfData.push_back(std::move(cdfEntry));
                 }
-                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-                cdfData.push_back(std::move(cdfEntry));
-            }
-            ++numCheckedEpochs;
-            progress.updateProgress(numCheckedEpochs);
-            if (storm::utility::resources::isTerminate()) {
-                break;
             }
         }
 
@@ -119,7 +159,7 @@ std::map<storm::storage::sparse::state_type, SolutionType> SparseMdpPrctlHelper<
 
         swAll.stop();
 
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet()) {
+        if (exportCdf) {
             std::vector<std::string> headers;
             for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
                 headers.push_back(rewardUnfolding.getDimension(i).formula->toString());
@@ -537,7 +577,8 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
 }
 
 template<typename ValueType, typename SolutionType>
-QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
+QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(Environment const& env,
+                                                                                     storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
@@ -546,12 +587,13 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+    uint64_t const numberOfThreads = env.modelchecker().getNumberOfGraphAnalysisThreads();
     if (goal.minimize()) {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
+                                                                          phiStates, psiStates, numberOfThreads);
     } else {
-        statesWithProbability01 =
-            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+        statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions,
+                                                                          phiStates, psiStates, numberOfThreads);
     }
     result.statesWithProbability0 = std::move(statesWithProbability01.first);
     result.statesWithProbability1 = std::move(statesWithProbability01.second);
@@ -561,7 +603,8 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
 }
 
 template<typename ValueType, typename SolutionType>
-QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
+QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(Environment const& env,
+                                                                                 storm::solver::SolveGoal<ValueType, SolutionType> const& goal,
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
@@ -569,7 +612,7 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(env, goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
     }
 }
 
@@ -708,7 +751,7 @@ MDPSparseModelCheckingHelperReturnType<SolutionType> SparseMdpPrctlHelper<ValueT
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(env, goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
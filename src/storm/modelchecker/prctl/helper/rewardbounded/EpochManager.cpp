@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/EpochManager.h"
 
+#include <map>
+
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -136,6 +138,34 @@ void EpochManager::gatherPredecessorEpochs(std::set<Epoch>& gatheredPredecessorE
     }
 }
 
+EpochManager::EpochDependencyGraph EpochManager::getDependencyGraph(std::vector<Epoch> const& epochs, std::set<Epoch> const& steps) const {
+    STORM_LOG_ASSERT(dimensionCount > 0, "Invoked EpochManager with zero dimension count.");
+    std::map<Epoch, uint64_t> epochToIndexMap;
+    for (uint64_t index = 0; index < epochs.size(); ++index) {
+        epochToIndexMap.emplace(epochs[index], index);
+    }
+    EpochDependencyGraph result;
+    result.dependencies.resize(epochs.size());
+    result.dependents.resize(epochs.size());
+    for (uint64_t index = 0; index < epochs.size(); ++index) {
+        std::set<uint64_t> successorIndices;
+        for (auto const& step : steps) {
+            Epoch successorEpoch = getSuccessorEpoch(epochs[index], step);
+            if (successorEpoch != epochs[index]) {
+                auto successorIt = epochToIndexMap.find(successorEpoch);
+                if (successorIt != epochToIndexMap.end()) {
+                    successorIndices.insert(successorIt->second);
+                }
+            }
+        }
+        result.dependencies[index].assign(successorIndices.begin(), successorIndices.end());
+        for (auto successorIndex : successorIndices) {
+            result.dependents[successorIndex].push_back(index);
+        }
+    }
+    return result;
+}
+
 bool EpochManager::isValidDimensionValue(uint64_t const& value) const {
     STORM_LOG_ASSERT(dimensionCount > 0, "Invoked EpochManager with zero dimension count.");
     return ((value & dimensionBitMask) == value) && value != dimensionBitMask;
@@ -15,6 +15,15 @@ class EpochManager {
     typedef uint64_t Epoch;       // The number of reward steps that are "left" for each dimension
     typedef uint64_t EpochClass;  // Encodes the dimensions of an epoch that are bottom. Two epoch models within the same class have the same graph structure.
 
+    /*!
+     * The dependencies among a set of epochs. Epochs are referred to by their index in the considered epoch vector.
+     * An epoch depends on another epoch if the latter is a (different) successor epoch.
+     */
+    struct EpochDependencyGraph {
+        std::vector<std::vector<uint64_t>> dependencies;  // The epochs whose solution is required to analyze the epoch
+        std::vector<std::vector<uint64_t>> dependents;    // The epochs that require the solution of the epoch
+    };
+
     EpochManager();
     EpochManager(uint64_t dimensionCount);
 
@@ -30,6 +39,12 @@ class EpochManager {
     std::vector<Epoch> getPredecessorEpochs(Epoch const& epoch, Epoch const& step) const;
     void gatherPredecessorEpochs(std::set<Epoch>& gatheredPredecessorEpochs, Epoch const& epoch, Epoch const& step) const;
 
+    /*!
+     * Computes the dependencies among the given epochs that are induced by the given steps.
+     * Successor epochs that are not contained in the given epochs are ignored.
+     */
+    EpochDependencyGraph getDependencyGraph(std::vector<Epoch> const& epochs, std::set<Epoch> const& steps) const;
+
     bool isZeroEpoch(Epoch const& epoch) const;
     bool isBottomEpoch(Epoch const& epoch) const;
     bool hasBottomDimension(Epoch const& epoch) const;
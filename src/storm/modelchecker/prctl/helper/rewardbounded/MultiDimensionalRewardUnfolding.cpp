@@ -1,6 +1,9 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -15,6 +18,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/expressions/Expressions.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/threads.h"
 
 #include "storm/transformer/EndComponentEliminator.h"
 
@@ -407,24 +412,33 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
 
     // Check if we need to update the current epoch class
     if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
+        initializeEpochClass(epoch, epochModel, epochModelToProductChoiceMap, productStateToEpochModelInStateMap);
         epochModel.epochMatrixChanged = true;
-        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
-                std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
-            }
-        }
     } else {
         epochModel.epochMatrixChanged = false;
     }
 
-    bool containsLowerBoundedObjective = false;
-    for (auto const& dimension : dimensions) {
-        if (dimension.boundType == DimensionBoundType::LowerBound) {
-            containsLowerBoundedObjective = true;
-            break;
-        }
+    computeStepSolutions(epoch, getSuccessorEpochSolutions(epoch), epochModel, epochModelToProductChoiceMap);
+
+    currentEpoch = epoch;
+    /*
+    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
+    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
+    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
+    std::cout << "steps: " << epochModel.stepChoices << '\n';
+    std::cout << "step solutions: ";
+    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
+        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
     }
+    std::cout << '\n';
+    */
+    return epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+std::map<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch,
+         typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const*>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getSuccessorEpochSolutions(Epoch const& epoch) const {
     std::map<Epoch, EpochSolution const*> subSolutions;
     for (auto const& step : possibleEpochSteps) {
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
@@ -434,6 +448,20 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             subSolutions.emplace(successorEpoch, &successorSolIt->second);
         }
     }
+    return subSolutions;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::computeStepSolutions(
+    Epoch const& epoch, std::map<Epoch, EpochSolution const*> const& subSolutions, EpochModel<ValueType, SingleObjectiveMode>& epochModel,
+    std::vector<uint64_t> const& epochModelToProductChoiceMap) const {
+    bool containsLowerBoundedObjective = false;
+    for (auto const& dimension : dimensions) {
+        if (dimension.boundType == DimensionBoundType::LowerBound) {
+            containsLowerBoundedObjective = true;
+            break;
+        }
+    }
     epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
     auto stepSolIt = epochModel.stepSolutions.begin();
     for (auto reducedChoice : epochModel.stepChoices) {
@@ -498,24 +526,12 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
     assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
     assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
     assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
-
-    currentEpoch = epoch;
-    /*
-    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
-    std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
-    }
-    std::cout << '\n';
-    */
-    return epochModel;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::initializeEpochClass(
+    Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModel, std::vector<uint64_t>& epochModelToProductChoiceMap,
+    std::shared_ptr<std::vector<uint64_t> const>& productStateToEpochModelInStateMap) const {
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -666,6 +682,12 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
         epochModel.objectiveRewardFilter.back().complement();
     }
+
+    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
+            std::cout << "Epoch model for epoch " + epochManager.toString(epoch) + " is cyclic.\n";
+        }
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -892,6 +914,150 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     epochSolutions[currentEpoch.get()] = std::move(solution);
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(
+    std::vector<Epoch> const& epochOrder, uint64_t numberOfThreads,
+    std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> const& analyzeEpoch,
+    std::function<void(uint64_t)> const& epochSolved, uint64_t memoryLimit) {
+    STORM_LOG_THROW(numberOfThreads > 0, storm::exceptions::IllegalArgumentException, "Invalid number of threads.");
+    uint64_t const numberOfEpochs = epochOrder.size();
+    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads, numberOfEpochs));
+    auto const dependencyGraph = epochManager.getDependencyGraph(epochOrder, possibleEpochSteps);
+
+    // The number of dependencies that are not solved yet and the number of dependents that are not solved yet.
+    std::vector<uint64_t> openDependencies(numberOfEpochs), openDependents(numberOfEpochs);
+    // Epochs whose dependencies are solved. Epochs that appear earlier in the given order are preferred.
+    std::set<uint64_t> readyEpochs;
+    for (uint64_t epochIndex = 0; epochIndex < numberOfEpochs; ++epochIndex) {
+        openDependencies[epochIndex] = dependencyGraph.dependencies[epochIndex].size();
+        openDependents[epochIndex] = dependencyGraph.dependents[epochIndex].size();
+        if (openDependencies[epochIndex] == 0) {
+            readyEpochs.insert(epochIndex);
+        }
+    }
+
+    // The first thread works on the epoch model of this. The other threads have their own epoch models.
+    struct ThreadData {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+        boost::optional<Epoch> currentEpoch;
+    };
+    std::vector<ThreadData> threadData(numberOfThreads - 1);
+    for (auto& data : threadData) {
+        data.epochModel.equationSolverProblemFormat = epochModel.equationSolverProblemFormat;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    uint64_t numberOfSolvedEpochs = 0;
+    uint64_t numberOfRunningEpochs = 0;
+    uint64_t storedSolutionsSize = 0;
+    bool stop = false;
+
+    auto processEpochs = [&](uint64_t thread) {
+        EpochModel<ValueType, SingleObjectiveMode>& threadEpochModel = thread == 0 ? epochModel : threadData[thread - 1].epochModel;
+        std::vector<uint64_t>& threadChoiceMap = thread == 0 ? epochModelToProductChoiceMap : threadData[thread - 1].epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const>& threadInStateMap =
+            thread == 0 ? productStateToEpochModelInStateMap : threadData[thread - 1].productStateToEpochModelInStateMap;
+        boost::optional<Epoch>& threadEpoch = thread == 0 ? currentEpoch : threadData[thread - 1].currentEpoch;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [&] {
+                return stop || numberOfSolvedEpochs == numberOfEpochs ||
+                       (!readyEpochs.empty() && (memoryLimit == 0 || numberOfRunningEpochs == 0 || storedSolutionsSize <= memoryLimit));
+            });
+            if (stop || numberOfSolvedEpochs == numberOfEpochs) {
+                return;
+            }
+            if (storm::utility::resources::isTerminate()) {
+                stop = true;
+                condition.notify_all();
+                return;
+            }
+            uint64_t const epochIndex = *readyEpochs.begin();
+            readyEpochs.erase(readyEpochs.begin());
+            ++numberOfRunningEpochs;
+            Epoch const& epoch = epochOrder[epochIndex];
+            auto subSolutions = getSuccessorEpochSolutions(epoch);
+            lock.unlock();
+
+            std::vector<SolutionType> inStateSolutions;
+            try {
+                STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch) << " in thread " << thread);
+                if (!threadEpoch || !epochManager.compareEpochClass(epoch, threadEpoch.get())) {
+                    initializeEpochClass(epoch, threadEpochModel, threadChoiceMap, threadInStateMap);
+                    threadEpochModel.epochMatrixChanged = true;
+                } else {
+                    threadEpochModel.epochMatrixChanged = false;
+                }
+                threadEpoch = epoch;
+                computeStepSolutions(epoch, subSolutions, threadEpochModel, threadChoiceMap);
+                inStateSolutions = analyzeEpoch(thread, threadEpochModel);
+                STORM_LOG_ASSERT(inStateSolutions.size() == threadEpochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+            } catch (...) {
+                lock.lock();
+                stop = true;
+                condition.notify_all();
+                throw;
+            }
+
+            lock.lock();
+            // Release the solutions of successor epochs that are not needed anymore.
+            std::set<Epoch> predecessorEpochs, successorEpochs;
+            for (auto const& step : possibleEpochSteps) {
+                epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+                successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
+            }
+            predecessorEpochs.erase(epoch);
+            successorEpochs.erase(epoch);
+            for (auto const& dependency : dependencyGraph.dependencies[epochIndex]) {
+                auto successorEpochSolutionIt = epochSolutions.find(epochOrder[dependency]);
+                STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+                successorEpochs.erase(epochOrder[dependency]);
+                --successorEpochSolutionIt->second.count;
+                --openDependents[dependency];
+                if (successorEpochSolutionIt->second.count == 0 || openDependents[dependency] == 0) {
+                    storedSolutionsSize -= getEpochSolutionSize(successorEpochSolutionIt->second);
+                    epochSolutions.erase(successorEpochSolutionIt);
+                }
+            }
+            // The remaining successor epochs have been solved before.
+            for (auto const& successorEpoch : successorEpochs) {
+                auto successorEpochSolutionIt = epochSolutions.find(successorEpoch);
+                STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
+                --successorEpochSolutionIt->second.count;
+                if (successorEpochSolutionIt->second.count == 0) {
+                    epochSolutions.erase(successorEpochSolutionIt);
+                }
+            }
+
+            // add the new solution
+            EpochSolution solution;
+            solution.count = predecessorEpochs.size();
+            solution.productStateToSolutionVectorMap = threadInStateMap;
+            solution.solutions = std::move(inStateSolutions);
+            storedSolutionsSize += getEpochSolutionSize(solution);
+            epochSolutions[epoch] = std::move(solution);
+
+            --numberOfRunningEpochs;
+            ++numberOfSolvedEpochs;
+            for (auto const& dependent : dependencyGraph.dependents[epochIndex]) {
+                if (--openDependencies[dependent] == 0) {
+                    readyEpochs.insert(dependent);
+                }
+            }
+            if (epochSolved) {
+                epochSolved(epochIndex);
+            }
+            condition.notify_all();
+        }
+    };
+
+    storm::utility::processInParallel(0, numberOfThreads, numberOfThreads, [&processEpochs](uint64_t, uint64_t, uint64_t thread) { processEpochs(thread); });
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
@@ -902,7 +1068,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions,
+                                                                                  Epoch const& epoch) const {
     auto epochSolutionIt = solutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return *epochSolutionIt->second;
@@ -910,13 +1077,23 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution,
+                                                                                  uint64_t const& productState) const {
     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(),
                      "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutionSize(EpochSolution const& epochSolution) const {
+    uint64_t solutionSize = sizeof(SolutionType);
+    if (!SingleObjectiveMode) {
+        solutionSize += objectives.size() * sizeof(ValueType);
+    }
+    return epochSolution.solutions.size() * solutionSize;
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType
 MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getInitialStateResult(Epoch const& epoch) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -78,6 +79,25 @@ class MultiDimensionalRewardUnfolding {
     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
 
     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+
+    /*!
+     * Analyzes the given epochs and stores their solutions. Epochs for which all successor epochs are solved are analyzed concurrently.
+     * Solutions of epochs are released as soon as they are not needed for the analysis of the remaining epochs anymore (except for epochs without
+     * predecessors in the given epochs such as the start epoch).
+     *
+     * @param epochOrder The epochs to analyze, as obtained from getEpochComputationOrder. If a single thread is used, epochs are analyzed in this order.
+     * @param numberOfThreads The number of threads to use.
+     * @param analyzeEpoch Called as analyzeEpoch(thread, epochModel) to obtain the solutions for the in-states of the given epoch model.
+     * Each thread works on its own epoch model, i.e., calls with different thread indices might happen concurrently.
+     * @param epochSolved If set, called as epochSolved(epochIndex) after the solution for the epoch with the given index has been stored. Calls do not happen
+     * concurrently.
+     * @param memoryLimit If non-zero, no further epoch is started while another epoch is analyzed and the (estimated) number of bytes occupied by the stored
+     * epoch solutions exceeds this limit.
+     */
+    void analyzeEpochs(std::vector<Epoch> const& epochOrder, uint64_t numberOfThreads,
+                       std::function<std::vector<SolutionType>(uint64_t, EpochModel<ValueType, SingleObjectiveMode>&)> const& analyzeEpoch,
+                       std::function<void(uint64_t)> const& epochSolved = {}, uint64_t memoryLimit = 0);
+
     SolutionType getInitialStateResult(Epoch const& epoch);  // Assumes that the initial state is unique
     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
 
@@ -85,7 +105,6 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,8 +140,26 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
-    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
+    uint64_t getEpochSolutionSize(EpochSolution const& epochSolution) const;
+
+    /*!
+     * Retrieves the (stored) solutions of all successor epochs of the given epoch.
+     */
+    std::map<Epoch, EpochSolution const*> getSuccessorEpochSolutions(Epoch const& epoch) const;
+
+    /*!
+     * Builds the epoch model (and the corresponding state and choice mappings) for the epoch class of the given epoch.
+     */
+    void initializeEpochClass(Epoch const& epoch, EpochModel<ValueType, SingleObjectiveMode>& epochModel, std::vector<uint64_t>& epochModelToProductChoiceMap,
+                              std::shared_ptr<std::vector<uint64_t> const>& productStateToEpochModelInStateMap) const;
+
+    /*!
+     * Sets the solutions for the step choices of the given epoch model, assuming that it has been initialized for the epoch class of the given epoch.
+     */
+    void computeStepSolutions(Epoch const& epoch, std::map<Epoch, EpochSolution const*> const& successorEpochSolutions,
+                              EpochModel<ValueType, SingleObjectiveMode>& epochModel, std::vector<uint64_t> const& epochModelToProductChoiceMap) const;
 
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
@@ -7,6 +7,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -22,6 +23,7 @@ const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::sparseSignatureRefinementOptionName = "sparsesigref";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -91,6 +93,16 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseSignatureRefinementOptionName, false,
+                                                   "Sets whether sparse strong bisimulation refines all blocks at once using (parallel) signatures.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "threads", "The number of threads to use. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .makeOptional()
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +185,15 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+bool BisimulationSettings::isSparseSignatureRefinementSet() const {
+    return this->getOption(sparseSignatureRefinementOptionName).getHasOptionBeenSet();
+}
+
+uint64_t BisimulationSettings::getNumberOfSparseSignatureRefinementThreads() const {
+    uint64_t numberOfThreads = this->getOption(sparseSignatureRefinementOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -96,6 +96,16 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves whether the signature-based refinement is to be used in sparse bisimulation.
+     */
+    bool isSparseSignatureRefinementSet() const;
+
+    /*!
+     * Retrieves the number of threads to use for the signature-based refinement in sparse bisimulation.
+     */
+    uint64_t getNumberOfSparseSignatureRefinementThreads() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -113,6 +123,7 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string sparseSignatureRefinementOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -49,6 +49,7 @@ const std::string IOSettings::propertyOptionName = "prop";
 const std::string IOSettings::propertyOptionShortName = "prop";
 const std::string IOSettings::steadyStateDistrOptionName = "steadystate";
 const std::string IOSettings::expectedVisitingTimesOptionName = "expvisittimes";
+const std::string IOSettings::timeBoundSweepOptionName = "timesweep";
 
 const std::string IOSettings::qvbsInputOptionName = "qvbs";
 const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
@@ -235,6 +236,17 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                                    "state (CTMC). Result can be exported using --" +
                                                        exportCheckResultOptionName + ".")
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, timeBoundSweepOptionName, false,
+                                                   "Evaluates each property of the form P=? [F<=T phi] on a CTMC or MA for the time bounds "
+                                                   "0, step, 2*step, ..., T at once.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("step", "The distance between two consecutive time bounds.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "If given, the curve is exported to this (csv) file.")
+                                         .setDefaultValueString("")
+                                         .makeOptional()
+                                         .build())
+                        .build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, qvbsInputOptionName, false, "Selects a model from the Quantitative Verification Benchmark Set.")
                         .setShortName(qvbsInputOptionShortName)
@@ -482,6 +494,22 @@ bool IOSettings::isComputeExpectedVisitingTimesSet() const {
     return this->getOption(expectedVisitingTimesOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isTimeBoundSweepSet() const {
+    return this->getOption(timeBoundSweepOptionName).getHasOptionBeenSet();
+}
+
+double IOSettings::getTimeBoundSweepStep() const {
+    return this->getOption(timeBoundSweepOptionName).getArgumentByName("step").getValueAsDouble();
+}
+
+bool IOSettings::isExportTimeBoundSweepSet() const {
+    return isTimeBoundSweepSet() && !getExportTimeBoundSweepFilename().empty();
+}
+
+std::string IOSettings::getExportTimeBoundSweepFilename() const {
+    return this->getOption(timeBoundSweepOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 bool IOSettings::isQvbsInputSet() const {
     return this->getOption(qvbsInputOptionName).getHasOptionBeenSet();
 }
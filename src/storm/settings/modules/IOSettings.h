@@ -344,6 +344,26 @@ class IOSettings : public ModuleSettings {
      */
     bool isComputeExpectedVisitingTimesSet() const;
 
+    /*!
+     * Retrieves whether time-bounded reachability properties are to be evaluated for a sweep of time bounds.
+     */
+    bool isTimeBoundSweepSet() const;
+
+    /*!
+     * Retrieves the distance between two consecutive time bounds of the time bound sweep.
+     */
+    double getTimeBoundSweepStep() const;
+
+    /*!
+     * Retrieves whether the curve obtained by the time bound sweep is to be exported.
+     */
+    bool isExportTimeBoundSweepSet() const;
+
+    /*!
+     * Retrieves the name of the file to which the curve obtained by the time bound sweep is to be exported.
+     */
+    std::string getExportTimeBoundSweepFilename() const;
+
     /*!
      * Retrieves whether the input model is to be read from the quantitative verification benchmark set (QVBS)
      */
@@ -412,6 +432,7 @@ class IOSettings : public ModuleSettings {
     static const std::string propertyOptionShortName;
     static const std::string steadyStateDistrOptionName;
     static const std::string expectedVisitingTimesOptionName;
+    static const std::string timeBoundSweepOptionName;
     static const std::string qvbsInputOptionName;
     static const std::string qvbsInputOptionShortName;
     static const std::string qvbsRootOptionName;
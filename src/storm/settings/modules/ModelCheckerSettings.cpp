@@ -6,6 +6,7 @@
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -14,6 +15,13 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltl2daCacheSizeOptionName = "ltl2dacache";
+const std::string ModelCheckerSettings::ltl2daCacheDirectoryOptionName = "ltl2dacachedir";
+const std::string ModelCheckerSettings::resultCacheOptionName = "resultcache";
+const std::string ModelCheckerSettings::epochThreadsOptionName = "epochthreads";
+const std::string ModelCheckerSettings::epochMemoryLimitOptionName = "epochmemlimit";
+const std::string ModelCheckerSettings::exactStepBoundedEvaluationOptionName = "exactstepbounds";
+const std::string ModelCheckerSettings::graphAnalysisThreadsOptionName = "graphthreads";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +35,53 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheSizeOptionName, false,
+                                                   "The number of deterministic automata for LTL formulas that are kept in memory. Formulas that only differ "
+                                                   "in the names of their atomic propositions share an automaton.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The number of automata. Zero disables caching.")
+                                         .setDefaultValueUnsignedInteger(16)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltl2daCacheDirectoryOptionName, false,
+                                                   "If set, deterministic automata for LTL formulas are stored in (and reused from) the given directory.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "An existing, writable directory.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resultCacheOptionName, false,
+                                                   "If set, results of the sparse engine are cached and reused as (warm-start) hints for subsequent properties.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochThreadsOptionName, false,
+                                                   "The number of threads used for analyzing the epochs of reward-bounded properties concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, epochMemoryLimitOptionName, false,
+                                                   "If the stored epoch solutions of reward-bounded properties occupy more memory than this, epochs are no longer "
+                                                   "analyzed concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The limit in megabytes. Zero means no limit.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, exactStepBoundedEvaluationOptionName, false,
+                                                   "If set, step-bounded properties are evaluated by performing every step, even if the values provably "
+                                                   "converged up to the solver precision before.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, graphAnalysisThreadsOptionName, false,
+                                                   "The number of threads used for the qualitative (prob0/prob1) graph analyses of the sparse engine. With "
+                                                   "multiple threads, the backward searches explore the states layer by layer.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +96,40 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+uint64_t ModelCheckerSettings::getLtl2daCacheSize() const {
+    return this->getOption(ltl2daCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isLtl2daCacheDirectorySet() const {
+    return this->getOption(ltl2daCacheDirectoryOptionName).getHasOptionBeenSet();
+}
+
+std::string ModelCheckerSettings::getLtl2daCacheDirectory() const {
+    return this->getOption(ltl2daCacheDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+}
+
+bool ModelCheckerSettings::isResultCacheSet() const {
+    return this->getOption(resultCacheOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfEpochThreads() const {
+    uint64_t numberOfThreads = this->getOption(epochThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
+uint64_t ModelCheckerSettings::getEpochMemoryLimit() const {
+    return this->getOption(epochMemoryLimitOptionName).getArgumentByName("mb").getValueAsUnsignedInteger() * 1024 * 1024;
+}
+
+bool ModelCheckerSettings::isExactStepBoundedEvaluationSet() const {
+    return this->getOption(exactStepBoundedEvaluationOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfGraphAnalysisThreads() const {
+    uint64_t numberOfThreads = this->getOption(graphAnalysisThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -35,6 +35,50 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves the number of deterministic automata (obtained from LTL formulas) that are kept in memory for reuse.
+     */
+    uint64_t getLtl2daCacheSize() const;
+
+    /*!
+     * Retrieves whether a directory for storing deterministic automata (obtained from LTL formulas) across runs has been set.
+     */
+    bool isLtl2daCacheDirectorySet() const;
+
+    /*!
+     * Retrieves the directory in which deterministic automata (obtained from LTL formulas) are stored across runs.
+     */
+    std::string getLtl2daCacheDirectory() const;
+
+    /*!
+     * Retrieves whether results are to be cached and reused across properties that are checked on the same model.
+     *
+     * @return True iff the result cache has been enabled.
+     */
+    bool isResultCacheSet() const;
+
+    /*!
+     * Retrieves the number of threads to use for analyzing the epochs of reward-bounded properties.
+     */
+    uint64_t getNumberOfEpochThreads() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes that the stored epoch solutions may occupy before the concurrent analysis of epochs is throttled.
+     *
+     * @return The memory limit in bytes, where zero means that there is no limit.
+     */
+    uint64_t getEpochMemoryLimit() const;
+
+    /*!
+     * Retrieves whether step-bounded properties are to be evaluated by performing all steps, i.e., without stopping once the values have converged.
+     */
+    bool isExactStepBoundedEvaluationSet() const;
+
+    /*!
+     * Retrieves the number of threads to use for the qualitative (prob0/prob1) graph analyses of the sparse engine.
+     */
+    uint64_t getNumberOfGraphAnalysisThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +86,13 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltl2daCacheSizeOptionName;
+    static const std::string ltl2daCacheDirectoryOptionName;
+    static const std::string resultCacheOptionName;
+    static const std::string epochThreadsOptionName;
+    static const std::string epochMemoryLimitOptionName;
+    static const std::string exactStepBoundedEvaluationOptionName;
+    static const std::string graphAnalysisThreadsOptionName;
 };
 
 }  // namespace modules
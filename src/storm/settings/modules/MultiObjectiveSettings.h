@@ -126,6 +126,11 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     bool isRedundantBsccConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of threads used to check weight vectors concurrently in the Pareto curve approximation algorithm.
+     */
+    uint64_t getNumberOfWeightVectorThreads() const;
+
     /*!
      * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
      *
@@ -144,6 +149,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
     const static std::string lexicographicOptionName;
+    const static std::string weightVectorThreadsOptionName;
 };
 
 }  // namespace modules
@@ -5,6 +5,7 @@
 #include "storm/settings/OptionBuilder.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 namespace settings {
@@ -13,9 +14,11 @@ namespace modules {
 const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
 
 const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
 const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
 const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
 const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+const std::string TimeBoundedSolverSettings::threadsOptionName = "threads";
 
 TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> maMethods = {"imca", "unifplus"};
@@ -27,6 +30,17 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                                          .build())
                         .build());
 
+    std::vector<std::string> ctmcMethods = {"unif", "adaptiveunif", "krylov"};
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false, "The method to use to compute transient probabilities on CTMCs.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "name", "The name of the method to use. 'adaptiveunif' is tailored to stiff models, 'krylov' to small and medium-sized models.")
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods))
+                             .setDefaultValueString("unif")
+                             .build())
+            .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
@@ -48,6 +62,14 @@ TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleNa
                              .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
                              .build())
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "The number of threads used for time-bounded reachability on MAs.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of threads. If zero, all available hardware threads are used.")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -70,6 +92,16 @@ storm::solver::MaBoundedReachabilityMethod TimeBoundedSolverSettings::getMaMetho
     return storm::solver::MaBoundedReachabilityMethod::UnifPlus;
 }
 
+storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+    std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+    if (techniqueAsString == "adaptiveunif") {
+        return storm::solver::CtmcTransientMethod::AdaptiveUniformization;
+    } else if (techniqueAsString == "krylov") {
+        return storm::solver::CtmcTransientMethod::Krylov;
+    }
+    return storm::solver::CtmcTransientMethod::Uniformization;
+}
+
 bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
     return !this->getOption(maMethodOptionName).getArgumentByName("name").getHasBeenSet() ||
            this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
@@ -79,6 +111,11 @@ double TimeBoundedSolverSettings::getUnifPlusKappa() const {
     return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
 }
 
+uint64_t TimeBoundedSolverSettings::getNumberOfThreads() const {
+    uint64_t numberOfThreads = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+    return numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : numberOfThreads;
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -26,6 +26,11 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
 
+    /*!
+     * Retrieves the selected technique for computing transient probabilities on CTMCs.
+     */
+    storm::solver::CtmcTransientMethod getCtmcMethod() const;
+
     /*!
      * Retrieves whether the precision has been set.
      *
@@ -50,14 +55,21 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     double getUnifPlusKappa() const;
 
+    /*!
+     * Retrieves the number of threads to use for time-bounded reachability on Markov automata.
+     */
+    uint64_t getNumberOfThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 
    private:
     static const std::string maMethodOptionName;
+    static const std::string ctmcMethodOptionName;
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string threadsOptionName;
 };
 
 }  // namespace modules
@@ -72,6 +72,18 @@ std::string toString(MaBoundedReachabilityMethod m) {
     return "invalid";
 }
 
+std::string toString(CtmcTransientMethod m) {
+    switch (m) {
+        case CtmcTransientMethod::Uniformization:
+            return "unif";
+        case CtmcTransientMethod::AdaptiveUniformization:
+            return "adaptiveunif";
+        case CtmcTransientMethod::Krylov:
+            return "krylov";
+    }
+    return "invalid";
+}
+
 std::string toString(LpSolverType t) {
     switch (t) {
         case LpSolverType::Gurobi:
@@ -0,0 +1,443 @@
+#include "storm/solver/helper/TransientProbabilityHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/adapters/eigen.h"
+#include "storm/environment/Environment.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/numerical.h"
+#include "storm/utility/vector.h"
+
+namespace storm::solver::helper {
+
+namespace detail {
+
+/*!
+ * Computes the rates of the birth process underlying adaptive uniformization. The k-th rate is (an upper bound on) the maximal exit rate of all
+ * states that can have a non-zero value after k+1 steps. As the sets of these states only depend on the graph structure, they are computed by a
+ * (lazy) backward search.
+ */
+template<typename ValueType>
+class AdaptiveUniformizationRates {
+   public:
+    AdaptiveUniformizationRates(storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector,
+                                ValueType uniformizationRate, std::vector<ValueType> const& values)
+        : uniformizationRate(uniformizationRate),
+          backwardTransitions(uniformizedMatrix.transpose()),
+          exitRates(uniformizedMatrix.getRowCount(), uniformizationRate),
+          activeStates(uniformizedMatrix.getRowCount()),
+          maxActiveExitRate(storm::utility::zero<ValueType>()) {
+        // The exit rate of a state (ignoring self-loops) can be read off the diagonal of the uniformized matrix.
+        for (uint64_t state = 0; state < uniformizedMatrix.getRowCount(); ++state) {
+            for (auto const& entry : uniformizedMatrix.getRow(state)) {
+                if (entry.getColumn() == state) {
+                    exitRates[state] = uniformizationRate * (storm::utility::one<ValueType>() - entry.getValue());
+                }
+            }
+        }
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            if (!storm::utility::isZero(values[state])) {
+                activate(state);
+            }
+        }
+        // The states that directly move to an absorbing (removed) state become non-zero in the first step.
+        if (addVector) {
+            for (uint64_t state = 0; state < addVector->size(); ++state) {
+                if (!storm::utility::isZero((*addVector)[state])) {
+                    activate(state);
+                }
+            }
+        }
+    }
+
+    /*!
+     * Retrieves the rate to use in the given step.
+     */
+    ValueType const& getRate(uint64_t step) {
+        while (rates.size() <= step) {
+            if (frontier.empty()) {
+                // All states that can ever become non-zero are active. Hence, the rate does not change anymore.
+                if (rates.empty()) {
+                    rates.push_back(computeCurrentRate());
+                }
+                return rates.back();
+            }
+            std::vector<uint64_t> currentFrontier;
+            std::swap(currentFrontier, frontier);
+            for (auto const& state : currentFrontier) {
+                for (auto const& entry : backwardTransitions.getRow(state)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        activate(entry.getColumn());
+                    }
+                }
+            }
+            rates.push_back(computeCurrentRate());
+        }
+        return rates[step];
+    }
+
+   private:
+    void activate(uint64_t state) {
+        if (!activeStates.get(state)) {
+            activeStates.set(state);
+            frontier.push_back(state);
+            maxActiveExitRate = std::max(maxActiveExitRate, exitRates[state]);
+        }
+    }
+
+    ValueType computeCurrentRate() const {
+        // As in standard uniformization, we slightly increase the rate to obtain self-loops in all states.
+        if (storm::utility::isZero(maxActiveExitRate)) {
+            return uniformizationRate;
+        }
+        return std::min(uniformizationRate, maxActiveExitRate * storm::utility::convertNumber<ValueType>(1.02));
+    }
+
+    ValueType uniformizationRate;
+    storm::storage::SparseMatrix<ValueType> backwardTransitions;
+    std::vector<ValueType> exitRates;
+    storm::storage::BitVector activeStates;
+    std::vector<uint64_t> frontier;
+    ValueType maxActiveExitRate;
+    std::vector<ValueType> rates;
+};
+
+/*!
+ * Computes the probabilities that the birth process with the given rates performs exactly k jumps until the given time bound (for k = 0, ..., K).
+ * The returned vector has K + 2 entries where the last one is the probability of performing more than K jumps.
+ */
+template<typename ValueType>
+std::vector<ValueType> computeBirthProcessProbabilities(AdaptiveUniformizationRates<ValueType>& rates, uint64_t K, ValueType timeBound, ValueType epsilon) {
+    // The rates are non-decreasing, so the largest rate is the one of state K.
+    ValueType maxRate = rates.getRate(K);
+    auto foxGlynnResult = storm::utility::numerical::foxGlynn(maxRate * timeBound, epsilon);
+
+    std::vector<ValueType> distribution(K + 2, storm::utility::zero<ValueType>());
+    distribution.front() = storm::utility::one<ValueType>();
+    std::vector<ValueType> result(K + 2, storm::utility::zero<ValueType>());
+    if (foxGlynnResult.left == 0) {
+        result.front() = foxGlynnResult.weights.front();
+    }
+    uint64_t maxIndex = 0;
+    for (uint64_t step = 1; step <= foxGlynnResult.right; ++step) {
+        // Perform one step of the uniformized birth process. Processing the states backwards allows to do this in place.
+        for (uint64_t index = std::min(maxIndex, K) + 1; index > 0; --index) {
+            ValueType moved = distribution[index - 1] * rates.getRate(index - 1) / maxRate;
+            distribution[index - 1] -= moved;
+            distribution[index] += moved;
+        }
+        maxIndex = std::min(maxIndex + 1, K + 1);
+        if (step >= foxGlynnResult.left) {
+            ValueType const& weight = foxGlynnResult.weights[step - foxGlynnResult.left];
+            for (uint64_t index = 0; index <= maxIndex; ++index) {
+                result[index] += weight * distribution[index];
+            }
+        }
+    }
+    storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
+    return result;
+}
+
+template<typename ValueType>
+using DenseMatrix = Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic>;
+
+/*!
+ * Computes exp(matrix) using the (6,6)-Padé approximation with scaling and squaring (cf. Expokit's DGPADM).
+ */
+template<typename ValueType>
+DenseMatrix<ValueType> computeMatrixExponential(DenseMatrix<ValueType> const& matrix) {
+    uint64_t const degree = 6;
+    Eigen::Index const size = matrix.rows();
+    DenseMatrix<ValueType> identity = DenseMatrix<ValueType>::Identity(size, size);
+
+    // Compute the Padé coefficients.
+    std::vector<ValueType> coefficients(degree + 1);
+    coefficients[0] = storm::utility::one<ValueType>();
+    for (uint64_t k = 1; k <= degree; ++k) {
+        coefficients[k] = coefficients[k - 1] * storm::utility::convertNumber<ValueType>(static_cast<double>(degree + 1 - k) / (k * (2 * degree + 1 - k)));
+    }
+
+    // Scale the matrix such that its norm is below 1/2.
+    ValueType norm = matrix.cwiseAbs().rowwise().sum().maxCoeff();
+    int64_t squarings = 0;
+    if (norm > storm::utility::zero<ValueType>()) {
+        squarings = std::max<int64_t>(0, static_cast<int64_t>(std::log2(storm::utility::convertNumber<double>(norm))) + 2);
+    }
+    DenseMatrix<ValueType> scaledMatrix = matrix * storm::utility::convertNumber<ValueType>(std::ldexp(1.0, -squarings));
+    DenseMatrix<ValueType> scaledMatrixSquared = scaledMatrix * scaledMatrix;
+
+    // Evaluate the parts of the Padé approximant with even and odd powers using Horner's scheme (in powers of the squared matrix).
+    DenseMatrix<ValueType> even = coefficients[degree] * identity;
+    DenseMatrix<ValueType> odd = coefficients[degree - 1] * identity;
+    bool evenTurn = true;
+    for (uint64_t k = degree - 1; k > 0; --k) {
+        if (evenTurn) {
+            even = even * scaledMatrixSquared + coefficients[k - 1] * identity;
+        } else {
+            odd = odd * scaledMatrixSquared + coefficients[k - 1] * identity;
+        }
+        evenTurn = !evenTurn;
+    }
+    DenseMatrix<ValueType> result;
+    if (evenTurn) {
+        even = even * scaledMatrix;
+        odd = odd - even;
+        result = -(identity + storm::utility::convertNumber<ValueType>(2.0) * odd.partialPivLu().solve(even));
+    } else {
+        odd = odd * scaledMatrix;
+        even = even - odd;
+        result = identity + storm::utility::convertNumber<ValueType>(2.0) * even.partialPivLu().solve(odd);
+    }
+
+    // Undo the scaling by repeated squaring.
+    for (int64_t squaring = 0; squaring < squarings; ++squaring) {
+        result = result * result;
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType roundToTwoDigits(ValueType const& value) {
+    double const scale = std::pow(10.0, std::floor(std::log10(storm::utility::convertNumber<double>(value))) - 1.0);
+    return storm::utility::convertNumber<ValueType>(std::ceil(storm::utility::convertNumber<double>(value) / scale) * scale);
+}
+
+}  // namespace detail
+
+template<typename ValueType>
+std::optional<std::vector<ValueType>> computeTransientProbabilitiesAdaptively(Environment const& env,
+                                                                              storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                              std::vector<ValueType> const* addVector, ValueType timeBound,
+                                                                              ValueType uniformizationRate, std::vector<ValueType> const& values,
+                                                                              ValueType epsilon) {
+    // The number of iterations required by standard uniformization.
+    uint64_t const standardIterations = storm::utility::numerical::foxGlynn(timeBound * uniformizationRate, epsilon).right;
+
+    // Find the number K of steps such that the birth process performs more than K jumps with a negligible probability. We start with the number of
+    // steps that would be required if the rate stayed at its initial value.
+    detail::AdaptiveUniformizationRates<ValueType> rates(uniformizedMatrix, addVector, uniformizationRate, values);
+    if (rates.getRate(0) >= uniformizationRate) {
+        STORM_LOG_INFO("Adaptive uniformization does not require fewer iterations than standard uniformization.");
+        return std::nullopt;
+    }
+    ValueType const halfEpsilon = epsilon / storm::utility::convertNumber<ValueType>(2.0);
+    uint64_t numberOfSteps =
+        std::min(standardIterations, std::max<uint64_t>(1, storm::utility::numerical::foxGlynn(timeBound * rates.getRate(0), halfEpsilon).right));
+    std::vector<ValueType> jumpProbabilities;
+    while (true) {
+        jumpProbabilities = detail::computeBirthProcessProbabilities(rates, numberOfSteps, timeBound, halfEpsilon);
+        if (jumpProbabilities.back() <= halfEpsilon) {
+            break;
+        }
+        if (numberOfSteps >= standardIterations) {
+            STORM_LOG_INFO("Adaptive uniformization does not require fewer iterations than standard uniformization.");
+            return std::nullopt;
+        }
+        numberOfSteps = std::min(2 * numberOfSteps, standardIterations);
+    }
+    if (numberOfSteps >= standardIterations) {
+        STORM_LOG_INFO("Adaptive uniformization does not require fewer iterations than standard uniformization.");
+        return std::nullopt;
+    }
+    STORM_LOG_INFO("Adaptive uniformization requires " << numberOfSteps << " instead of " << standardIterations << " iterations.");
+
+    // The k-th step uses the matrix I + Q/rate_k = I + (uniformizationRate/rate_k) * (P - I), where Q is the generator matrix.
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    std::vector<ValueType> currentValues = values;
+    std::vector<ValueType> nextValues(values.size());
+    std::vector<ValueType> result = values;
+    storm::utility::vector::scaleVectorInPlace(result, jumpProbabilities.front());
+    for (uint64_t step = 0; step < numberOfSteps; ++step) {
+        multiplier->multiply(env, currentValues, addVector, nextValues);
+        ValueType const factor = uniformizationRate / rates.getRate(step);
+        ValueType const& weight = jumpProbabilities[step + 1];
+        for (uint64_t state = 0; state < currentValues.size(); ++state) {
+            currentValues[state] += factor * (nextValues[state] - currentValues[state]);
+            result[state] += weight * currentValues[state];
+        }
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted adaptive uniformization after " << step << " iterations.");
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+std::vector<ValueType> computeTransientProbabilitiesKrylov(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                           std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
+                                                           std::vector<ValueType> const& values, ValueType epsilon) {
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    // If there is an add vector, we extend the state space by a component that stays constantly one to obtain a homogeneous equation.
+    uint64_t const dimension = addVector ? numberOfStates + 1 : numberOfStates;
+    if (storm::utility::isZero(timeBound) || dimension == 0) {
+        return values;
+    }
+
+    // The generator A of the (extended) equation is given by A*x = q * (P*x + b*x_n - x).
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    std::vector<ValueType> head(numberOfStates);
+    std::vector<ValueType> product(numberOfStates);
+    auto applyGenerator = [&](std::vector<ValueType> const& x, std::vector<ValueType>& y) {
+        std::copy(x.begin(), x.begin() + numberOfStates, head.begin());
+        multiplier->multiply(env, head, nullptr, product);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            y[state] = uniformizationRate * (product[state] - x[state]);
+            if (addVector) {
+                y[state] += uniformizationRate * (*addVector)[state] * x[numberOfStates];
+            }
+        }
+        if (addVector) {
+            y[numberOfStates] = storm::utility::zero<ValueType>();
+        }
+    };
+    auto norm = [](std::vector<ValueType> const& x) { return storm::utility::sqrt(storm::utility::vector::dotProduct(x, x)); };
+
+    // Compute the infinity norm of the generator.
+    ValueType generatorNorm = storm::utility::zero<ValueType>();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        ValueType rowSum = addVector ? storm::utility::abs((*addVector)[state]) : storm::utility::zero<ValueType>();
+        bool hasDiagonal = false;
+        for (auto const& entry : uniformizedMatrix.getRow(state)) {
+            if (entry.getColumn() == state) {
+                rowSum += storm::utility::abs<ValueType>(entry.getValue() - storm::utility::one<ValueType>());
+                hasDiagonal = true;
+            } else {
+                rowSum += storm::utility::abs(entry.getValue());
+            }
+        }
+        if (!hasDiagonal) {
+            rowSum += storm::utility::one<ValueType>();
+        }
+        generatorNorm = std::max(generatorNorm, rowSum * uniformizationRate);
+    }
+
+    std::vector<ValueType> w = values;
+    if (addVector) {
+        w.push_back(storm::utility::one<ValueType>());
+    }
+    ValueType beta = norm(w);
+    if (storm::utility::isZero(beta) || storm::utility::isZero(generatorNorm)) {
+        return values;
+    }
+
+    // The parameters are chosen as in Expokit.
+    uint64_t const krylovDimension = std::min<uint64_t>(30, dimension);
+    uint64_t const maxRejections = 10;
+    ValueType const breakdownTolerance = storm::utility::convertNumber<ValueType>(1e-7);
+    ValueType const gamma = storm::utility::convertNumber<ValueType>(0.9);
+    ValueType const delta = storm::utility::convertNumber<ValueType>(1.2);
+    double const m = static_cast<double>(krylovDimension);
+    ValueType xm = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(m);
+    ValueType const fact = storm::utility::convertNumber<ValueType>(std::pow((m + 1.0) / std::exp(1.0), m + 1.0) * std::sqrt(2.0 * M_PI * (m + 1.0)));
+    ValueType timeNew = std::pow(fact * epsilon / (storm::utility::convertNumber<ValueType>(4.0) * beta * generatorNorm), xm) / generatorNorm;
+    timeNew = detail::roundToTwoDigits(timeNew);
+
+    std::vector<std::vector<ValueType>> basis(krylovDimension + 1, std::vector<ValueType>(dimension));
+    std::vector<ValueType> p(dimension);
+    ValueType timeNow = storm::utility::zero<ValueType>();
+    uint64_t numberOfSteps = 0;
+    while (timeNow < timeBound) {
+        ++numberOfSteps;
+        ValueType timeStep = std::min(timeBound - timeNow, timeNew);
+
+        // Build an orthonormal basis of the Krylov subspace using the Arnoldi process.
+        detail::DenseMatrix<ValueType> hessenberg = detail::DenseMatrix<ValueType>::Zero(krylovDimension + 2, krylovDimension + 2);
+        for (uint64_t state = 0; state < dimension; ++state) {
+            basis[0][state] = w[state] / beta;
+        }
+        uint64_t usedDimension = krylovDimension;
+        uint64_t k1 = 2;
+        for (uint64_t j = 0; j < krylovDimension; ++j) {
+            applyGenerator(basis[j], p);
+            for (uint64_t i = 0; i <= j; ++i) {
+                hessenberg(i, j) = storm::utility::vector::dotProduct(basis[i], p);
+                storm::utility::vector::addScaledVector(p, basis[i], -hessenberg(i, j));
+            }
+            ValueType s = norm(p);
+            if (s < breakdownTolerance) {
+                // Happy breakdown: the subspace is invariant, so the remaining time can be covered at once.
+                k1 = 0;
+                usedDimension = j + 1;
+                timeStep = timeBound - timeNow;
+                break;
+            }
+            hessenberg(j + 1, j) = s;
+            for (uint64_t state = 0; state < dimension; ++state) {
+                basis[j + 1][state] = p[state] / s;
+            }
+        }
+        ValueType avnorm = storm::utility::zero<ValueType>();
+        if (k1 != 0) {
+            hessenberg(krylovDimension + 1, krylovDimension) = storm::utility::one<ValueType>();
+            applyGenerator(basis[krylovDimension], p);
+            avnorm = norm(p);
+        }
+
+        // Compute the exponential of the Hessenberg matrix and reduce the step size until the local error is small enough.
+        detail::DenseMatrix<ValueType> exponential;
+        ValueType localError = breakdownTolerance;
+        for (uint64_t rejections = 0;; ++rejections) {
+            uint64_t const mx = usedDimension + k1;
+            exponential = detail::computeMatrixExponential<ValueType>(timeStep * hessenberg.topLeftCorner(mx, mx));
+            if (k1 == 0) {
+                break;
+            }
+            ValueType phi1 = storm::utility::abs<ValueType>(beta * exponential(krylovDimension, 0));
+            ValueType phi2 = storm::utility::abs<ValueType>(beta * exponential(krylovDimension + 1, 0) * avnorm);
+            if (phi1 > storm::utility::convertNumber<ValueType>(10.0) * phi2) {
+                localError = phi2;
+                xm = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(m);
+            } else if (phi1 > phi2) {
+                localError = (phi1 * phi2) / (phi1 - phi2);
+                xm = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(m);
+            } else {
+                localError = phi1;
+                xm = storm::utility::one<ValueType>() / storm::utility::convertNumber<ValueType>(std::max(1.0, m - 1.0));
+            }
+            if (localError <= delta * timeStep * epsilon) {
+                break;
+            }
+            STORM_LOG_THROW(rejections < maxRejections, storm::exceptions::InvalidOperationException,
+                            "The requested precision " << epsilon << " can not be achieved by the Krylov subspace method.");
+            timeStep = detail::roundToTwoDigits(gamma * timeStep * std::pow(timeStep * epsilon / localError, xm));
+        }
+
+        // Obtain the values at the end of the current step.
+        uint64_t const mx = usedDimension + (k1 == 0 ? 0 : k1 - 1);
+        std::fill(w.begin(), w.end(), storm::utility::zero<ValueType>());
+        for (uint64_t i = 0; i < mx; ++i) {
+            storm::utility::vector::addScaledVector(w, basis[i], beta * exponential(i, 0));
+        }
+        beta = norm(w);
+        timeNow += timeStep;
+        if (storm::utility::isZero(beta)) {
+            break;
+        }
+        timeNew = detail::roundToTwoDigits(gamma * timeStep * std::pow(timeStep * epsilon / std::max(localError, breakdownTolerance * epsilon), xm));
+
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted Krylov subspace method after " << numberOfSteps << " steps.");
+        }
+    }
+    STORM_LOG_INFO("Krylov subspace method performed " << numberOfSteps << " steps.");
+
+    w.resize(numberOfStates);
+    return w;
+}
+
+template std::optional<std::vector<double>> computeTransientProbabilitiesAdaptively(Environment const& env,
+                                                                                    storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                                    std::vector<double> const* addVector, double timeBound,
+                                                                                    double uniformizationRate, std::vector<double> const& values,
+                                                                                    double epsilon);
+template std::vector<double> computeTransientProbabilitiesKrylov(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix,
+                                                                 std::vector<double> const* addVector, double timeBound, double uniformizationRate,
+                                                                 std::vector<double> const& values, double epsilon);
+
+}  // namespace storm::solver::helper
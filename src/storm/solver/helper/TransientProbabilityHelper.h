@@ -0,0 +1,48 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+class Environment;
+}
+
+namespace storm::solver::helper {
+
+/*!
+ * Alternatives to standard uniformization for computing transient probabilities on CTMCs.
+ * All functions consider the linear differential equation dv/dt = q * (P*v + b - v) with v(0) = values, where P is the given uniformized matrix,
+ * q is the uniformization rate and b is an (optional) vector that compensates for the removal of absorbing states. They return v(timeBound).
+ */
+
+/*!
+ * Computes the transient probabilities using adaptive uniformization (van Moorsel and Sanders, 1994).
+ * Rather than using the uniformization rate in every step, the k-th step only uses the maximal exit rate of the states that can have a non-zero
+ * value after k steps. For stiff models, in which the fast states are not reached within the first steps, this requires considerably fewer
+ * matrix-vector multiplications.
+ *
+ * @param epsilon The maximal (absolute) truncation error.
+ * @return The transient probabilities or none if adaptive uniformization would not require fewer iterations than standard uniformization.
+ */
+template<typename ValueType>
+std::optional<std::vector<ValueType>> computeTransientProbabilitiesAdaptively(Environment const& env,
+                                                                              storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                              std::vector<ValueType> const* addVector, ValueType timeBound,
+                                                                              ValueType uniformizationRate, std::vector<ValueType> const& values,
+                                                                              ValueType epsilon);
+
+/*!
+ * Computes the transient probabilities by approximating the action of the matrix exponential in a Krylov subspace (as done by Expokit's expv).
+ * The exponentials of the (small) Hessenberg matrices are computed using Padé approximation with scaling and squaring.
+ * As a basis of the Krylov subspace is stored explicitly, this is intended for small and medium-sized models.
+ *
+ * @param epsilon The requested (absolute) error.
+ */
+template<typename ValueType>
+std::vector<ValueType> computeTransientProbabilitiesKrylov(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                           std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
+                                                           std::vector<ValueType> const& values, ValueType epsilon);
+
+}  // namespace storm::solver::helper
@@ -1,6 +1,7 @@
 #include "storm/solver/helper/ValueIterationHelper.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/NotImplementedException.h"
 #include "storm/solver/helper/ValueIterationOperator.h"
 #include "storm/utility/Extremum.h"
 
@@ -54,6 +55,57 @@ class VIOperatorBackend {
     bool isConverged{true};
 };
 
+template<typename ValueType, bool Relative>
+class InterleavedVIOperatorBackend {
+   public:
+    InterleavedVIOperatorBackend(ValueType const& precision) : precision{precision} {
+        // intentionally empty
+    }
+
+    void startNewIteration() {
+        isConverged = true;
+    }
+
+    void firstRow(std::vector<ValueType>& values, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        rowValues = &values;
+    }
+
+    void nextRow(std::vector<ValueType>&, [[maybe_unused]] uint64_t rowGroup, [[maybe_unused]] uint64_t row) {
+        STORM_LOG_ASSERT(false, "Value iteration on interleaved vectors is only supported for deterministic models.");
+    }
+
+    void applyUpdate(ValueType* currValues, [[maybe_unused]] uint64_t rowGroup) {
+        for (uint64_t dim = 0; dim < rowValues->size(); ++dim) {
+            ValueType& newValue = (*rowValues)[dim];
+            if (isConverged) {
+                if constexpr (Relative) {
+                    isConverged = storm::utility::abs<ValueType>(currValues[dim] - newValue) <= storm::utility::abs<ValueType>(precision * currValues[dim]);
+                } else {
+                    isConverged = storm::utility::abs<ValueType>(currValues[dim] - newValue) <= precision;
+                }
+            }
+            currValues[dim] = std::move(newValue);
+        }
+    }
+
+    void endOfIteration() const {
+        // intentionally left empty.
+    }
+
+    bool converged() const {
+        return isConverged;
+    }
+
+    bool constexpr abort() const {
+        return false;
+    }
+
+   private:
+    std::vector<ValueType>* rowValues{nullptr};
+    ValueType const precision;
+    bool isConverged{true};
+};
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::ValueIterationHelper(
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator)
@@ -143,6 +195,54 @@ SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::
     return VI(operand, offsets, numIterations, relative, precision, dir, iterationCallback, mult, robust);
 }
 
+template<bool Relative, typename ValueType, typename SolutionType>
+SolverStatus interleavedVI(ValueIterationOperator<ValueType, true, SolutionType> const& viOperator, InterleavedVectors<SolutionType>& operand,
+                           InterleavedVectors<ValueType> const& offsets, uint64_t& numIterations, SolutionType const& precision,
+                           std::function<SolverStatus(SolverStatus const&)> const& iterationCallback, MultiplicationStyle mult) {
+    InterleavedVIOperatorBackend<SolutionType, Relative> backend{precision};
+    std::optional<InterleavedVectors<SolutionType>> auxOperand;
+    InterleavedVectors<SolutionType>* operand1{&operand};
+    InterleavedVectors<SolutionType>* operand2{&operand};
+    if (mult == MultiplicationStyle::Regular) {
+        auxOperand.emplace(operand);
+        operand2 = &auxOperand.value();
+    }
+    SolverStatus status{SolverStatus::InProgress};
+    while (status == SolverStatus::InProgress) {
+        ++numIterations;
+        if (viOperator.apply(*operand1, *operand2, offsets, backend)) {
+            status = SolverStatus::Converged;
+        } else if (iterationCallback) {
+            status = iterationCallback(status);
+        }
+        if (mult == MultiplicationStyle::Regular) {
+            std::swap(operand1, operand2);
+        }
+    }
+    if (operand1 != &operand) {
+        // The most recent values are in the auxiliary operand
+        operand = std::move(*operand1);
+    }
+    return status;
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+SolverStatus ValueIterationHelper<ValueType, TrivialRowGrouping, SolutionType>::VI(InterleavedVectors<SolutionType>& operand,
+                                                                                   InterleavedVectors<ValueType> const& offsets, uint64_t& numIterations,
+                                                                                   bool relative, SolutionType const& precision,
+                                                                                   std::function<SolverStatus(SolverStatus const&)> const& iterationCallback,
+                                                                                   MultiplicationStyle mult) const {
+    if constexpr (!TrivialRowGrouping || std::is_same_v<ValueType, storm::Interval>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotImplementedException,
+                        "Value iteration on interleaved vectors is only implemented for deterministic, non-interval models.");
+        return SolverStatus::Aborted;
+    } else if (relative) {
+        return interleavedVI<true>(*viOperator, operand, offsets, numIterations, precision, iterationCallback, mult);
+    } else {
+        return interleavedVI<false>(*viOperator, operand, offsets, numIterations, precision, iterationCallback, mult);
+    }
+}
+
 template class ValueIterationHelper<double, true>;
 template class ValueIterationHelper<double, false>;
 template class ValueIterationHelper<storm::RationalNumber, true>;
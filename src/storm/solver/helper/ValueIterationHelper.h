@@ -36,6 +36,14 @@ class ValueIterationHelper {
                     std::optional<storm::OptimizationDirection> const& dir = {}, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
                     MultiplicationStyle mult = MultiplicationStyle::GaussSeidel, bool robust = true) const;
 
+    /*!
+     * Performs value iteration on multiple value vectors simultaneously, i.e., each application of the operator processes all vectors in a single pass over
+     * the matrix. Iteration stops once all vectors converged. Only supported for deterministic models (TrivialRowGrouping).
+     */
+    SolverStatus VI(InterleavedVectors<SolutionType>& operand, InterleavedVectors<ValueType> const& offsets, uint64_t& numIterations, bool relative,
+                    SolutionType const& precision, std::function<SolverStatus(SolverStatus const&)> const& iterationCallback = {},
+                    MultiplicationStyle mult = MultiplicationStyle::GaussSeidel) const;
+
    private:
     std::shared_ptr<ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>> viOperator;
 };
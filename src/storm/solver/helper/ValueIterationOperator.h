@@ -22,6 +22,56 @@ class SparseMatrix;
 
 namespace solver::helper {
 
+/*!
+ * Multiple value vectors of the same size whose entries are stored interleaved, i.e., the i-th entry of the j-th vector is stored at position
+ * i * dimension + j. This can be used as operand (and offsets) of the ValueIterationOperator to process several value vectors in a single pass over the matrix.
+ * @tparam T The type of the vector entries
+ */
+template<typename T>
+class InterleavedVectors {
+   public:
+    InterleavedVectors(uint64_t size = 0, uint64_t dimension = 1, T const& initialValue = T()) : values(size * dimension, initialValue), dimension(dimension) {
+        STORM_LOG_ASSERT(dimension > 0, "Interleaved vectors need to have a positive dimension.");
+    }
+
+    /*!
+     * @return the number of entries of each vector
+     */
+    uint64_t size() const {
+        return values.size() / dimension;
+    }
+
+    /*!
+     * @return the number of vectors
+     */
+    uint64_t getDimension() const {
+        return dimension;
+    }
+
+    /*!
+     * @return a pointer to the entries of all vectors at the given index
+     */
+    T* operator[](uint64_t index) {
+        return values.data() + index * dimension;
+    }
+
+    T const* operator[](uint64_t index) const {
+        return values.data() + index * dimension;
+    }
+
+    T& get(uint64_t index, uint64_t vectorIndex) {
+        return values[index * dimension + vectorIndex];
+    }
+
+    T const& get(uint64_t index, uint64_t vectorIndex) const {
+        return values[index * dimension + vectorIndex];
+    }
+
+   private:
+    std::vector<T> values;
+    uint64_t dimension;
+};
+
 /*!
  * This class represents the Value Iteration Operator (also known as Bellman operator).
  * It is tailored for efficiency, in particular when applied multiple times.
@@ -79,8 +129,12 @@ class ValueIterationOperator {
      * @tparam OperandType The type of input and output operand. Can be a value vector or a pair of two value vectors with one entry per group.
      *                      In the latter case, the rowResult for backend.firstRow and backend.nextRow is a pair of values and
      *                      applyUpdate gets two operandOutReference's to write the group result to.
+     *                      Can also be InterleavedVectors with one entry per group in each vector. In this case, the rowResult is a (non-const) reference to
+     *                      a vector with one value per dimension that is only valid until the next row is processed and
+     *                      applyUpdate gets a pointer to the (consecutive) output entries of the group.
      * @tparam OffsetType The type of row offsets. Can be a single value vector (one entry per row) or a pair of a (pointer to a) value vector and a value.
      *                      The latter case is only valid if OperandType is a pair of two value vectors.
+     *                      If OperandType is InterleavedVectors, the offsets have to be InterleavedVectors with one entry per row and the same dimension.
      * @tparam BackendType The type of backend, shall implement the methods above
      * @param operandIn Input operand
      * @param operandOut Output operand
@@ -169,6 +223,8 @@ class ValueIterationOperator {
         auto const operandSize = getSize(operandIn);
         STORM_LOG_ASSERT(TrivialRowGrouping || rowGroupIndices->size() == operandSize + 1, "Dimension mismatch");
         backend.startNewIteration();
+        // Storage for the row results on interleaved operands. It is local to this call so that the operator can be applied concurrently.
+        [[maybe_unused]] std::vector<SolutionType> interleavedRowResult;
         auto matrixValueIt = matrixValues.cbegin();
         auto matrixColumnIt = matrixColumns.cbegin();
         for (auto groupIndex : indexRange<Backward>(0, operandSize)) {
@@ -176,22 +232,27 @@ class ValueIterationOperator {
             STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
             //            STORM_LOG_ASSERT(matrixValueIt != matrixValues.end(), "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex), groupIndex, groupIndex);
+                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, groupIndex, interleavedRowResult), groupIndex,
+                                 groupIndex);
             } else {
                 IndexType rowIndex = (*rowGroupIndices)[groupIndex];
                 if constexpr (SkipIgnoredRows) {
                     rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
                 }
-                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                backend.firstRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, interleavedRowResult), groupIndex,
+                                 rowIndex);
                 while (*matrixColumnIt < StartOfRowGroupIndicator) {
                     ++rowIndex;
                     if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
-                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex), groupIndex, rowIndex);
+                        backend.nextRow(applyRow<RobustDirection>(matrixColumnIt, matrixValueIt, operandIn, offsets, rowIndex, interleavedRowResult),
+                                        groupIndex, rowIndex);
                     }
                 }
             }
             if constexpr (isPair<OperandType>::value) {
                 backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
+            } else if constexpr (isInterleaved<OperandType>::value) {
+                backend.applyUpdate(operandOut[groupIndex], groupIndex);
             } else {
                 backend.applyUpdate(operandOut[groupIndex], groupIndex);
             }
@@ -247,11 +308,16 @@ class ValueIterationOperator {
 
     /*!
      * Computes the result for a single row and advances the given iterators to the end of the row
+     * @param interleavedRowResult storage for the row result, only used for interleaved operands
      */
     template<OptimizationDirection RobustDirection, typename OperandType, typename OffsetType>
-    auto applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
-                  OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex) const {
-        if constexpr (std::is_same_v<ValueType, storm::Interval>) {
+    decltype(auto) applyRow(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+                            OperandType const& operand, OffsetType const& offsets, uint64_t offsetIndex,
+                            [[maybe_unused]] std::vector<SolutionType>& interleavedRowResult) const {
+        if constexpr (isInterleaved<OperandType>::value) {
+            static_assert(!std::is_same_v<ValueType, storm::Interval>, "Value Iteration is not implemented with interleaved operands and interval-models.");
+            return applyRowInterleaved(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex, interleavedRowResult);
+        } else if constexpr (std::is_same_v<ValueType, storm::Interval>) {
             return applyRowRobust<RobustDirection>(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
         } else {
             return applyRowStandard(matrixColumnIt, matrixValueIt, operand, offsets, offsetIndex);
@@ -274,6 +340,25 @@ class ValueIterationOperator {
         return result;
     }
 
+    template<typename OffT>
+    std::vector<SolutionType>& applyRowInterleaved(std::vector<IndexType>::const_iterator& matrixColumnIt,
+                                                   typename std::vector<ValueType>::const_iterator& matrixValueIt,
+                                                   InterleavedVectors<SolutionType> const& operand, InterleavedVectors<OffT> const& offsets,
+                                                   uint64_t offsetIndex, std::vector<SolutionType>& interleavedRowResult) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        STORM_LOG_ASSERT(operand.getDimension() == offsets.getDimension(), "Dimension mismatch");
+        auto const dimension = operand.getDimension();
+        auto const* offsetValues = offsets[offsetIndex];
+        interleavedRowResult.assign(offsetValues, offsetValues + dimension);
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+            auto const* successorValues = operand[*matrixColumnIt];
+            for (uint64_t dim = 0; dim < dimension; ++dim) {
+                interleavedRowResult[dim] += successorValues[dim] * (*matrixValueIt);
+            }
+        }
+        return interleavedRowResult;
+    }
+
     // Aux function for applyRowRobust
     template<OptimizationDirection RobustDirection>
     struct AuxCompare {
@@ -347,12 +432,23 @@ class ValueIterationOperator {
         return pairOfVec.first.size();
     }
 
+    template<typename T>
+    uint64_t getSize(InterleavedVectors<T> const& vecs) const {
+        return vecs.size();
+    }
+
     template<typename>
     struct isPair : std::false_type {};
 
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename>
+    struct isInterleaved : std::false_type {};
+
+    template<typename T>
+    struct isInterleaved<InterleavedVectors<T>> : std::true_type {};
+
     /*!
      * Internal variant of setIgnoredRows
      */
@@ -3,4 +3,7 @@
 namespace storm::solver::helper {
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType = ValueType>
 class ValueIterationOperator;
+
+template<typename T>
+class InterleavedVectors;
 }
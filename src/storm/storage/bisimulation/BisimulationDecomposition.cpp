@@ -22,6 +22,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
+#include "storm/storage/bisimulation/ParallelSignatureRefiner.h"
 
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
@@ -60,6 +61,8 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -220,12 +223,29 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
     STORM_LOG_WARN_COND(partition.size() > 1, "Initial partition consists only of a single block.");
     std::chrono::high_resolution_clock::duration initialPartitionTime = std::chrono::high_resolution_clock::now() - initialPartitionStart;
 
-    this->initialize();
+    bool useSignatureRefinement = options.signatureRefinement;
+    if (useSignatureRefinement && options.getType() != BisimulationType::Strong) {
+        STORM_LOG_WARN("Signature-based refinement is only available for strong bisimulation. Falling back to splitter-based refinement.");
+        useSignatureRefinement = false;
+    }
+
+    if (!useSignatureRefinement) {
+        this->initialize();
+    }
 
     std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-    this->performPartitionRefinement();
+    if (useSignatureRefinement) {
+        this->performSignatureRefinement();
+    } else {
+        this->performPartitionRefinement();
+    }
     std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
 
+    if (useSignatureRefinement) {
+        // The auxiliary data structures (that are also needed to build the quotient) are set up for the final partition.
+        this->initialize();
+    }
+
     std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
     this->extractDecompositionBlocks();
     std::chrono::high_resolution_clock::duration extractionTime = std::chrono::high_resolution_clock::now() - extractionStart;
@@ -288,6 +308,36 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+    // Translate the current partition to a mapping from states to blocks. The outgoing transitions of states in absorbing blocks are ignored.
+    std::vector<uint64_t> stateToBlock(model.getNumberOfStates());
+    storm::storage::BitVector frozenStates(model.getNumberOfStates());
+    for (auto const& block : partition.getBlocks()) {
+        for (auto stateIt = partition.begin(*block), stateIte = partition.end(*block); stateIt != stateIte; ++stateIt) {
+            stateToBlock[*stateIt] = block->getId();
+            if (block->data().absorbing()) {
+                frozenStates.set(*stateIt);
+            }
+        }
+    }
+
+    // For nondeterministic models, the rewards of the choices need to be respected as well.
+    std::vector<ValueType> const* choiceRewards = nullptr;
+    if (model.isNondeterministicModel() && options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards()) {
+        choiceRewards = &model.getUniqueRewardModel().getStateActionRewardVector();
+    }
+
+    ParallelSignatureRefiner<ValueType> refiner(model.getTransitionMatrix(), comparator, choiceRewards, options.numberOfThreads);
+    std::vector<uint64_t> refinedStateToBlock = refiner.refine(stateToBlock, frozenStates);
+    STORM_LOG_INFO("Signature refinement took " << refiner.getNumberOfRounds() << " rounds.");
+
+    // As the refined partition is finer than the current one, it can be obtained by splitting the blocks of the current partition.
+    partition.split([&refinedStateToBlock](storm::storage::sparse::state_type const& a, storm::storage::sparse::state_type const& b) {
+        return refinedStateToBlock[a] < refinedStateToBlock[b];
+    });
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
@@ -126,6 +126,13 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that governs whether the partition is refined using the (parallel) signature-based refinement, which refines all blocks
+        /// in each round, rather than the splitter-based refinement. This only applies to strong bisimulation.
+        bool signatureRefinement;
+
+        /// The number of threads used by the signature-based refinement.
+        uint64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +215,13 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement using the signature-based refinement. In contrast to performPartitionRefinement(), this
+     * refines all blocks of the partition in each round (possibly in parallel) and does not rely on the auxiliary data structures
+     * set up by initialize().
+     */
+    void performSignatureRefinement();
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
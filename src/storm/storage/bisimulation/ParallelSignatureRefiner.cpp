@@ -0,0 +1,262 @@
+#include "storm/storage/bisimulation/ParallelSignatureRefiner.h"
+
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm {
+namespace storage {
+namespace bisimulation {
+
+template<typename ValueType>
+bool ParallelSignatureRefiner<ValueType>::Signature::operator<(Signature const& other) const {
+    return std::tie(structure, values) < std::tie(other.structure, other.values);
+}
+
+template<typename ValueType>
+ParallelSignatureRefiner<ValueType>::ParallelSignatureRefiner(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                              storm::utility::ConstantsComparator<ValueType> const& comparator,
+                                                              std::vector<ValueType> const* choiceRewards, uint64_t numberOfThreads)
+    : transitionMatrix(transitionMatrix), comparator(comparator), choiceRewards(choiceRewards), numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)),
+      numberOfRounds(0) {
+    STORM_LOG_THROW(!choiceRewards || choiceRewards->size() == transitionMatrix.getRowCount(), storm::exceptions::InvalidArgumentException,
+                    "The number of choice rewards does not match the number of choices.");
+    if constexpr (!std::is_same_v<ValueType, double>) {
+        STORM_LOG_WARN_COND(this->numberOfThreads == 1, "Signature refinement is only performed in parallel for models over doubles.");
+        this->numberOfThreads = 1;
+    }
+}
+
+template<typename ValueType>
+bool ParallelSignatureRefiner<ValueType>::choiceLess(Choice const& first, Choice const& second) {
+    if (first.entries.size() != second.entries.size()) {
+        return first.entries.size() < second.entries.size();
+    }
+    for (auto firstIt = first.entries.begin(), secondIt = second.entries.begin(); firstIt != first.entries.end(); ++firstIt, ++secondIt) {
+        if (firstIt->first != secondIt->first) {
+            return firstIt->first < secondIt->first;
+        }
+    }
+    if (first.reward && first.reward.get() != second.reward.get()) {
+        return first.reward.get() < second.reward.get();
+    }
+    for (auto firstIt = first.entries.begin(), secondIt = second.entries.begin(); firstIt != first.entries.end(); ++firstIt, ++secondIt) {
+        if (firstIt->second != secondIt->second) {
+            return firstIt->second < secondIt->second;
+        }
+    }
+    return false;
+}
+
+template<typename ValueType>
+bool ParallelSignatureRefiner<ValueType>::choiceEqual(Choice const& first, Choice const& second) const {
+    if (first.entries.size() != second.entries.size() || (first.reward && !comparator.isEqual(first.reward.get(), second.reward.get()))) {
+        return false;
+    }
+    for (auto firstIt = first.entries.begin(), secondIt = second.entries.begin(); firstIt != first.entries.end(); ++firstIt, ++secondIt) {
+        if (firstIt->first != secondIt->first || !comparator.isEqual(firstIt->second, secondIt->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+bool ParallelSignatureRefiner<ValueType>::signatureEqual(Signature const& first, Signature const& second) const {
+    if (first.structure != second.structure) {
+        return false;
+    }
+    // If the structures coincide, so do the number of values.
+    for (auto firstIt = first.values.begin(), secondIt = second.values.begin(); firstIt != first.values.end(); ++firstIt, ++secondIt) {
+        if (!comparator.isEqual(*firstIt, *secondIt)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+void ParallelSignatureRefiner<ValueType>::computeSignature(uint64_t state, std::vector<uint64_t> const& rowGroupIndices,
+                                                           std::vector<uint64_t> const& stateToBlock, storm::storage::BitVector const& frozenStates,
+                                                           Signature& signature, std::vector<Choice>& choices) const {
+    signature.structure.clear();
+    signature.values.clear();
+    signature.structure.push_back(stateToBlock[state]);
+    if (frozenStates.get(state)) {
+        return;
+    }
+
+    // Compute the distributions over blocks of all choices.
+    choices.resize(rowGroupIndices[state + 1] - rowGroupIndices[state]);
+    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+        Choice& choice = choices[row - rowGroupIndices[state]];
+        choice.entries.clear();
+        if (choiceRewards) {
+            choice.reward = (*choiceRewards)[row];
+        }
+        for (auto const& entry : transitionMatrix.getRow(row)) {
+            if (!comparator.isZero(entry.getValue())) {
+                choice.entries.emplace_back(stateToBlock[entry.getColumn()], entry.getValue());
+            }
+        }
+        std::sort(choice.entries.begin(), choice.entries.end(),
+                  [](std::pair<uint64_t, ValueType> const& first, std::pair<uint64_t, ValueType> const& second) { return first.first < second.first; });
+
+        // Merge the entries that lead to the same block.
+        auto targetIt = choice.entries.begin();
+        for (auto entryIt = choice.entries.begin(); entryIt != choice.entries.end(); ++entryIt) {
+            if (entryIt != choice.entries.begin() && entryIt->first == targetIt->first) {
+                targetIt->second += entryIt->second;
+            } else {
+                if (entryIt != choice.entries.begin()) {
+                    ++targetIt;
+                }
+                if (targetIt != entryIt) {
+                    *targetIt = std::move(*entryIt);
+                }
+            }
+        }
+        if (!choice.entries.empty()) {
+            choice.entries.erase(std::next(targetIt), choice.entries.end());
+        }
+    }
+
+    // As the signature considers the *set* of distributions, we sort the choices and eliminate (adjacent) duplicates.
+    if (choices.size() > 1) {
+        std::sort(choices.begin(), choices.end(), &ParallelSignatureRefiner<ValueType>::choiceLess);
+        choices.erase(std::unique(choices.begin(), choices.end(), [this](Choice const& first, Choice const& second) { return choiceEqual(first, second); }),
+                      choices.end());
+    }
+
+    for (auto const& choice : choices) {
+        signature.structure.push_back(choice.entries.size());
+        if (choice.reward) {
+            signature.values.push_back(choice.reward.get());
+        }
+        for (auto const& entry : choice.entries) {
+            signature.structure.push_back(entry.first);
+            signature.values.push_back(entry.second);
+        }
+    }
+}
+
+template<typename ValueType>
+uint64_t ParallelSignatureRefiner<ValueType>::getShardIndex(Signature const& signature, uint64_t numberOfShards) const {
+    // Only the structure is hashed as (inexact) values that are considered equal by the comparator may have different hashes.
+    return boost::hash_range(signature.structure.begin(), signature.structure.end()) % numberOfShards;
+}
+
+template<typename ValueType>
+std::vector<uint64_t> ParallelSignatureRefiner<ValueType>::refine(std::vector<uint64_t> const& stateToBlock, storm::storage::BitVector const& frozenStates) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<uint64_t> const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    STORM_LOG_THROW(stateToBlock.size() == numberOfStates && frozenStates.size() == numberOfStates, storm::exceptions::InvalidArgumentException,
+                    "The size of the partition does not match the number of states.");
+
+    // Using more shards than threads keeps the contention on the individual shards low.
+    uint64_t const numberOfShards = numberOfThreads == 1 ? 1 : 64 * numberOfThreads;
+
+    std::vector<uint64_t> currentStateToBlock = stateToBlock;
+    uint64_t currentNumberOfBlocks = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> shardOfState(numberOfStates);
+    std::vector<uint64_t> indexInShard(numberOfStates);
+    numberOfRounds = 0;
+    while (true) {
+        ++numberOfRounds;
+
+        // Compute the signatures of all states and assign each distinct signature an index within its shard.
+        std::vector<std::unique_ptr<Shard>> shards;
+        for (uint64_t shard = 0; shard < numberOfShards; ++shard) {
+            shards.push_back(std::make_unique<Shard>());
+        }
+        storm::utility::processInParallel(0, numberOfStates, numberOfThreads, [&](uint64_t begin, uint64_t end, uint64_t) {
+            Signature signature;
+            std::vector<Choice> choices;
+            for (uint64_t state = begin; state < end; ++state) {
+                computeSignature(state, rowGroupIndices, currentStateToBlock, frozenStates, signature, choices);
+                uint64_t shardIndex = getShardIndex(signature, numberOfShards);
+                Shard& shard = *shards[shardIndex];
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                auto signatureIt = shard.signatureToIndex.find(signature);
+                if (signatureIt == shard.signatureToIndex.end()) {
+                    uint64_t newIndex = shard.signatureToIndex.size();
+                    signatureIt = shard.signatureToIndex.emplace(std::move(signature), newIndex).first;
+                }
+                shardOfState[state] = shardIndex;
+                indexInShard[state] = signatureIt->second;
+            }
+        });
+
+        std::vector<uint64_t> shardOffsets(numberOfShards + 1, 0);
+        for (uint64_t shard = 0; shard < numberOfShards; ++shard) {
+            shardOffsets[shard + 1] = shardOffsets[shard] + shards[shard]->signatureToIndex.size();
+        }
+
+        // Signatures that are equal w.r.t. the comparator have the same structure and are therefore stored in the same shard. Each signature is mapped to
+        // the first signature of its class, where a class is a maximal sequence of (exactly ordered) signatures in which all adjacent signatures are equal.
+        std::vector<uint64_t> signatureToClass(shardOffsets.back());
+        storm::utility::processInParallel(0, numberOfShards, numberOfThreads, [&](uint64_t begin, uint64_t end, uint64_t) {
+            for (uint64_t shard = begin; shard < end; ++shard) {
+                Signature const* previousSignature = nullptr;
+                uint64_t currentClass = 0;
+                for (auto const& signatureIndexPair : shards[shard]->signatureToIndex) {
+                    if (!previousSignature || !signatureEqual(*previousSignature, signatureIndexPair.first)) {
+                        currentClass = shardOffsets[shard] + signatureIndexPair.second;
+                    }
+                    signatureToClass[shardOffsets[shard] + signatureIndexPair.second] = currentClass;
+                    previousSignature = &signatureIndexPair.first;
+                }
+            }
+        });
+        shards.clear();
+
+        // Rank the classes in the order of their smallest state. This makes the block indices independent of the order in which the signatures
+        // have been inserted into the shards.
+        std::vector<uint64_t> classToBlock(shardOffsets.back(), std::numeric_limits<uint64_t>::max());
+        uint64_t newNumberOfBlocks = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t& block = classToBlock[signatureToClass[shardOffsets[shardOfState[state]] + indexInShard[state]]];
+            if (block == std::numeric_limits<uint64_t>::max()) {
+                block = newNumberOfBlocks++;
+            }
+            currentStateToBlock[state] = block;
+        }
+
+        // As the signature contains the current block, the new partition refines the old one. Hence, it is stable iff no block was split.
+        STORM_LOG_TRACE("Signature refinement round " << numberOfRounds << " yields " << newNumberOfBlocks << " blocks.");
+        if (newNumberOfBlocks == currentNumberOfBlocks) {
+            break;
+        }
+        currentNumberOfBlocks = newNumberOfBlocks;
+
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in signature refinement after " << numberOfRounds << " rounds.");
+        }
+    }
+    return currentStateToBlock;
+}
+
+template<typename ValueType>
+uint64_t ParallelSignatureRefiner<ValueType>::getNumberOfRounds() const {
+    return numberOfRounds;
+}
+
+template class ParallelSignatureRefiner<double>;
+
+#ifdef STORM_HAVE_CARL
+template class ParallelSignatureRefiner<storm::RationalNumber>;
+template class ParallelSignatureRefiner<storm::RationalFunction>;
+#endif
+
+}  // namespace bisimulation
+}  // namespace storage
+}  // namespace storm
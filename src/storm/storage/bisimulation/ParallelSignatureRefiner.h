@@ -0,0 +1,103 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/ConstantsComparator.h"
+
+namespace storm {
+namespace storage {
+namespace bisimulation {
+
+/*!
+ * Performs a signature-based partition refinement w.r.t. strong bisimulation on a sparse model.
+ * The signature of a state consists of its current block and the set of distributions over blocks induced by its choices.
+ * In every round, the signatures of all states are computed in parallel and ranked using a table that is sharded by the
+ * (structural) hash of the signatures, such that all blocks are refined at once. The rounds are repeated until the partition
+ * is stable.
+ * Signatures are ordered exactly. Like in the splitter-based refinement, the precision of the comparator is only taken into account
+ * when merging signatures that are adjacent w.r.t. this order.
+ */
+template<typename ValueType>
+class ParallelSignatureRefiner {
+   public:
+    /*!
+     * Creates a refiner for the given model.
+     *
+     * @param transitionMatrix The transition matrix of the model. For deterministic models, each row group consists of a single row.
+     * @param comparator The comparator used to compare probabilities (and rewards).
+     * @param choiceRewards If given, the reward of a choice is considered to be part of its distribution.
+     * @param numberOfThreads The number of threads to use. Only models over doubles are processed in parallel, because the arithmetic of
+     * the other (exact) value types is not guaranteed to be thread-safe.
+     */
+    ParallelSignatureRefiner(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::utility::ConstantsComparator<ValueType> const& comparator,
+                             std::vector<ValueType> const* choiceRewards = nullptr, uint64_t numberOfThreads = 1);
+
+    /*!
+     * Refines the given partition until it is stable.
+     *
+     * @param stateToBlock The initial partition given as a mapping from states to (arbitrary) block identifiers.
+     * @param frozenStates The states whose outgoing transitions are to be ignored, e.g., because they belong to an absorbing block.
+     * @return The coarsest stable refinement of the given partition as a mapping from states to block indices. The blocks are
+     * numbered consecutively in the order of their smallest state, which makes the result independent of the number of threads.
+     */
+    std::vector<uint64_t> refine(std::vector<uint64_t> const& stateToBlock, storm::storage::BitVector const& frozenStates);
+
+    /*!
+     * Retrieves the number of refinement rounds performed by the last call to refine.
+     */
+    uint64_t getNumberOfRounds() const;
+
+   private:
+    struct Signature {
+        // The current block of the state followed by the number of entries and the target blocks of each (distinct) choice.
+        std::vector<uint64_t> structure;
+        // The (reward and) probabilities of each choice.
+        std::vector<ValueType> values;
+
+        // Orders the signatures exactly, first by their structure and then by their values.
+        bool operator<(Signature const& other) const;
+    };
+
+    struct Choice {
+        boost::optional<ValueType> reward;
+        std::vector<std::pair<uint64_t, ValueType>> entries;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::map<Signature, uint64_t> signatureToIndex;
+    };
+
+    // Computes the signature of the given state w.r.t. the given partition. The row group indices have to be retrieved before any concurrent calls, as
+    // the matrix creates them lazily for deterministic models.
+    void computeSignature(uint64_t state, std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& stateToBlock,
+                          storm::storage::BitVector const& frozenStates, Signature& signature, std::vector<Choice>& choices) const;
+
+    // Orders the choices exactly, first by their target blocks and then by their (reward and) probabilities.
+    static bool choiceLess(Choice const& first, Choice const& second);
+    // Returns true iff the choices have the same target blocks and their (reward and) probabilities are equal w.r.t. the comparator.
+    bool choiceEqual(Choice const& first, Choice const& second) const;
+    // Returns true iff the signatures have the same structure and their values are equal w.r.t. the comparator.
+    bool signatureEqual(Signature const& first, Signature const& second) const;
+
+    // Computes the index of the shard responsible for the given signature.
+    uint64_t getShardIndex(Signature const& signature, uint64_t numberOfShards) const;
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    storm::utility::ConstantsComparator<ValueType> const& comparator;
+    std::vector<ValueType> const* choiceRewards;
+    uint64_t numberOfThreads;
+    uint64_t numberOfRounds;
+};
+
+}  // namespace bisimulation
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/transformer/DAProduct.h"
+#include "storm/transformer/DAProductBuilder.h"
+#include "storm/transformer/Product.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include <map>
+#include <vector>
+
+namespace storm {
+namespace transformer {
+
+/*!
+ * Lazily explores the product of a model with a deterministic automaton, starting from the states of interest.
+ * States are explored in breadth-first order, i.e., the product states are indexed exactly as in the product built by the DAProductBuilder.
+ * At any point, the product states with index below getNumberOfExploredStates() have all their outgoing transitions explored,
+ * whereas the remaining (frontier) states have been discovered but not yet explored.
+ */
+template<typename Model>
+class DAProductExplorer {
+   public:
+    typedef typename Model::ValueType ValueType;
+    typedef storm::storage::sparse::state_type state_type;
+    typedef std::pair<state_type, state_type> product_state_type;
+
+    DAProductExplorer(DAProductBuilder const& productOperator, storm::storage::SparseMatrix<ValueType> const& originalMatrix,
+                      storm::storage::BitVector const& statesOfInterest)
+        : productOperator(productOperator), originalMatrix(originalMatrix), deterministic(originalMatrix.hasTrivialRowGrouping()), numberOfExploredStates(0) {
+        rowIndications.push_back(0);
+        rowGroupIndices.push_back(0);
+        for (state_type s_0 : statesOfInterest) {
+            productInitial.push_back(getOrAddProductState(product_state_type(s_0, productOperator.getInitialState(s_0))));
+        }
+    }
+
+    /*!
+     * Explores (at most) the given number of further product states.
+     * @return true iff all reachable product states have been explored.
+     */
+    bool explore(uint64_t maximalNumberOfStates) {
+        for (uint64_t count = 0; count < maximalNumberOfStates && !isComplete(); ++count) {
+            product_state_type from = productIndexToProductState[numberOfExploredStates];
+            for (uint64_t row = originalMatrix.getRowGroupIndices()[from.first]; row < originalMatrix.getRowGroupIndices()[from.first + 1]; ++row) {
+                for (auto const& entry : originalMatrix.getRow(row)) {
+                    state_type t = entry.getColumn();
+                    state_type prodIndexTo = getOrAddProductState(product_state_type(t, productOperator.getSuccessor(from.second, t)));
+                    columnsAndValues.emplace_back(prodIndexTo, entry.getValue());
+                }
+                rowIndications.push_back(columnsAndValues.size());
+            }
+            rowGroupIndices.push_back(rowIndications.size() - 1);
+            ++numberOfExploredStates;
+        }
+        return isComplete();
+    }
+
+    /*!
+     * Retrieves whether all reachable product states have been explored.
+     */
+    bool isComplete() const {
+        return numberOfExploredStates == productIndexToProductState.size();
+    }
+
+    /*!
+     * Retrieves the number of product states that have been discovered so far (including the frontier states).
+     */
+    uint64_t getNumberOfStates() const {
+        return productIndexToProductState.size();
+    }
+
+    uint64_t getNumberOfExploredStates() const {
+        return numberOfExploredStates;
+    }
+
+    /*!
+     * Retrieves the discovered states whose outgoing transitions have not been explored yet.
+     */
+    storm::storage::BitVector getFrontierStates() const {
+        storm::storage::BitVector result(getNumberOfStates(), false);
+        result.setMultiple(numberOfExploredStates, getNumberOfStates() - numberOfExploredStates);
+        return result;
+    }
+
+    /*!
+     * Retrieves the product states corresponding to the states of interest.
+     */
+    storm::storage::BitVector getStatesOfInterest() const {
+        storm::storage::BitVector result(getNumberOfStates(), false);
+        for (auto const& s : productInitial) {
+            result.set(s);
+        }
+        return result;
+    }
+
+    state_type getModelState(state_type productState) const {
+        return productIndexToProductState[productState].first;
+    }
+
+    state_type getAutomatonState(state_type productState) const {
+        return productIndexToProductState[productState].second;
+    }
+
+    /*!
+     * Builds the transition matrix of the product states discovered so far. Frontier states get a single self-loop.
+     */
+    storm::storage::SparseMatrix<ValueType> buildTransitionMatrix() const {
+        uint64_t const numberOfStates = getNumberOfStates();
+        uint64_t const numberOfRows = rowIndications.size() - 1 + numberOfStates - numberOfExploredStates;
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, numberOfStates, columnsAndValues.size() + numberOfStates - numberOfExploredStates,
+                                                               false, !deterministic, numberOfStates);
+        for (uint64_t state = 0; state < numberOfExploredStates; ++state) {
+            if (!deterministic) {
+                builder.newRowGroup(rowGroupIndices[state]);
+            }
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                    builder.addNextValue(row, columnsAndValues[entry].first, columnsAndValues[entry].second);
+                }
+            }
+        }
+        uint64_t row = rowIndications.size() - 1;
+        for (uint64_t state = numberOfExploredStates; state < numberOfStates; ++state, ++row) {
+            if (!deterministic) {
+                builder.newRowGroup(row);
+            }
+            builder.addNextValue(row, state, storm::utility::one<ValueType>());
+        }
+        return builder.build(numberOfRows, numberOfStates, numberOfStates);
+    }
+
+    /*!
+     * Builds the product of the model and the given automaton, assuming that the exploration is complete.
+     * The product takes over the state mappings of this explorer, which can not be used afterwards.
+     */
+    typename DAProduct<Model>::ptr buildProduct(storm::automata::DeterministicAutomaton const& da) {
+        STORM_LOG_ASSERT(isComplete(), "Tried to build the product although its exploration is not complete.");
+        Model productModel(buildTransitionMatrix(), storm::models::sparse::StateLabeling(getNumberOfStates()));
+        std::string prodSoiLabel = productModel.getStateLabeling().addUniqueLabel("soi", getStatesOfInterest());
+        typename Product<Model>::ptr product(new Product<Model>(std::move(productModel), std::move(prodSoiLabel), std::move(productStateToProductIndex),
+                                                                std::move(productIndexToProductState)));
+        storm::automata::AcceptanceCondition::ptr prodAcceptance = da.getAcceptance()->lift(
+            product->getProductModel().getNumberOfStates(), [&product](std::size_t prodState) { return product->getAutomatonState(prodState); });
+        return typename DAProduct<Model>::ptr(new DAProduct<Model>(std::move(*product), prodAcceptance));
+    }
+
+   private:
+    state_type getOrAddProductState(product_state_type const& productState) {
+        auto insertionRes = productStateToProductIndex.emplace(productState, productIndexToProductState.size());
+        if (insertionRes.second) {
+            productIndexToProductState.push_back(productState);
+        }
+        return insertionRes.first->second;
+    }
+
+    DAProductBuilder const& productOperator;
+    storm::storage::SparseMatrix<ValueType> const& originalMatrix;
+    bool deterministic;
+
+    std::map<product_state_type, state_type> productStateToProductIndex;
+    std::vector<product_state_type> productIndexToProductState;
+    std::vector<state_type> productInitial;
+
+    // The transitions of the explored states
+    uint64_t numberOfExploredStates;
+    std::vector<std::pair<state_type, ValueType>> columnsAndValues;
+    std::vector<uint64_t> rowIndications;
+    std::vector<uint64_t> rowGroupIndices;
+};
+}  // namespace transformer
+}  // namespace storm
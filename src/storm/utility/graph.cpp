@@ -1,5 +1,6 @@
 #include "graph.h"
 #include <algorithm>
+#include <type_traits>
 
 #include "storm-config.h"
 #include "storm/utility/OsDetection.h"
@@ -25,6 +26,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 #include <queue>
 
@@ -411,10 +413,17 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
-                                                                              storm::storage::BitVector const& psiStates) {
+                                                                              storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
-    result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
+    if (numberOfThreads > 1) {
+        result.first = performProbGreater0Frontier(backwardTransitions, phiStates, psiStates, numberOfThreads);
+        // The states with probability less than one are those that can reach a state with probability zero without passing a psi state.
+        result.second = performProbGreater0Frontier(backwardTransitions, ~psiStates, ~result.first, numberOfThreads);
+        result.second.complement();
+    } else {
+        result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
+        result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
+    }
     result.first.complement();
     return result;
 }
@@ -836,8 +845,14 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates) {
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    if (numberOfThreads > 1) {
+        result.first = performProb0AFrontier(backwardTransitions, phiStates, psiStates, numberOfThreads);
+        result.second =
+            performProb1EFrontier(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, boost::none, numberOfThreads);
+        return result;
+    }
 
     result.first = performProb0A(backwardTransitions, phiStates, psiStates);
 
@@ -1080,13 +1095,18 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates) {
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
     // This is valid because, when minimizing probabilities, states that have prob1 cannot reach a state with prob 0 (and will eventually reach a psiState).
     // States that do not have prob1 will eventually reach a state with prob0.
-    result.second = performProb0A(backwardTransitions, ~psiStates, result.first);
+    if (numberOfThreads > 1) {
+        result.first = performProb0EFrontier(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, numberOfThreads);
+        result.second = performProb0AFrontier(backwardTransitions, ~psiStates, result.first, numberOfThreads);
+    } else {
+        result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+        result.second = performProb0A(backwardTransitions, ~psiStates, result.first);
+    }
     return result;
 }
 
@@ -1098,6 +1118,298 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                             psiStates);
 }
 
+namespace detail {
+
+// Layers whose frontier is smaller than this are processed sequentially, as the overhead of the parallel processing would dominate.
+uint64_t const minimalParallelFrontierSize = 4096;
+
+/*!
+ * Retrieves the set of all predecessors of the given states.
+ */
+template<typename T>
+storm::storage::BitVector getPredecessors(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& states) {
+    storm::storage::BitVector result(states.size());
+    for (auto state : states) {
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            result.set(entry.getColumn());
+        }
+    }
+    return result;
+}
+
+/*!
+ * Performs a layered backward search starting from the given frontier. In each layer, the predecessors of the frontier that are allowed, not yet contained
+ * in the result, and satisfy the given condition form the next frontier. The condition (if not nullptr) is evaluated w.r.t. the result of the previous layer.
+ * The frontier is kept as a list of states, such that the work of each layer is proportional to the number of transitions of its frontier. Only large
+ * frontiers are processed in parallel.
+ */
+template<typename T, typename Condition>
+void performFrontierBackwardSearch(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& allowedStates,
+                                   storm::storage::BitVector& result, storm::storage::BitVector const& initialFrontier, storm::utility::ThreadPool& threadPool,
+                                   Condition const& condition) {
+    uint64_t const numberOfStates = result.size();
+    std::vector<uint64_t> frontier;
+    frontier.reserve(initialFrontier.getNumberOfSetBits());
+    for (auto state : initialFrontier) {
+        frontier.push_back(state);
+    }
+    std::vector<uint64_t> candidates;
+    // Marks the candidates of the current layer. The marks are reset after each layer by traversing the candidates.
+    storm::storage::BitVector isCandidate(numberOfStates);
+    auto addCandidates = [&](uint64_t state, std::vector<uint64_t>& stateCandidates, storm::storage::BitVector& isStateCandidate) {
+        for (auto const& entry : backwardTransitions.getRow(state)) {
+            uint64_t predecessor = entry.getColumn();
+            if (allowedStates.get(predecessor) && !result.get(predecessor) && !isStateCandidate.get(predecessor)) {
+                isStateCandidate.set(predecessor);
+                stateCandidates.push_back(predecessor);
+            }
+        }
+    };
+
+    // The scratch space of the threads is only allocated once a frontier is large enough for a parallel layer and is then reused in all further layers.
+    std::vector<std::vector<uint64_t>> threadCandidates;
+    std::vector<storm::storage::BitVector> isThreadCandidate;
+    std::vector<uint8_t> satisfiesCondition;
+
+    while (!frontier.empty()) {
+        candidates.clear();
+        bool const parallelLayer = threadPool.getNumberOfThreads() > 1 && frontier.size() >= minimalParallelFrontierSize;
+        if (parallelLayer) {
+            if (threadCandidates.empty()) {
+                threadCandidates.resize(threadPool.getNumberOfThreads());
+                isThreadCandidate.resize(threadPool.getNumberOfThreads(), storm::storage::BitVector(numberOfStates));
+            }
+            // Each thread collects the predecessors of its part of the frontier. The collected predecessors are merged afterwards.
+            threadPool.processInParallel(0, frontier.size(), [&](uint64_t begin, uint64_t end, uint64_t chunk) {
+                threadCandidates[chunk].clear();
+                for (uint64_t index = begin; index < end; ++index) {
+                    addCandidates(frontier[index], threadCandidates[chunk], isThreadCandidate[chunk]);
+                }
+                for (auto state : threadCandidates[chunk]) {
+                    isThreadCandidate[chunk].set(state, false);
+                }
+            });
+            for (uint64_t chunk = 0, numberOfChunks = storm::utility::getNumberOfParallelChunks(0, frontier.size(), threadPool.getNumberOfThreads());
+                 chunk < numberOfChunks; ++chunk) {
+                for (auto state : threadCandidates[chunk]) {
+                    if (!isCandidate.get(state)) {
+                        isCandidate.set(state);
+                        candidates.push_back(state);
+                    }
+                }
+            }
+        } else {
+            for (auto state : frontier) {
+                addCandidates(state, candidates, isCandidate);
+            }
+        }
+        for (auto state : candidates) {
+            isCandidate.set(state, false);
+        }
+
+        if constexpr (!std::is_same_v<Condition, std::nullptr_t>) {
+            if (parallelLayer && candidates.size() >= minimalParallelFrontierSize) {
+                satisfiesCondition.resize(candidates.size());
+                threadPool.processInParallel(0, candidates.size(), [&](uint64_t begin, uint64_t end, uint64_t) {
+                    for (uint64_t index = begin; index < end; ++index) {
+                        satisfiesCondition[index] = condition(candidates[index]);
+                    }
+                });
+                uint64_t numberOfSatisfyingCandidates = 0;
+                for (uint64_t index = 0; index < candidates.size(); ++index) {
+                    if (satisfiesCondition[index]) {
+                        candidates[numberOfSatisfyingCandidates++] = candidates[index];
+                    }
+                }
+                candidates.resize(numberOfSatisfyingCandidates);
+            } else {
+                candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [&condition](uint64_t state) { return !condition(state); }),
+                                 candidates.end());
+            }
+        }
+        for (auto state : candidates) {
+            result.set(state);
+        }
+        std::swap(frontier, candidates);
+    }
+}
+
+}  // namespace detail
+
+template<typename T>
+storm::storage::BitVector performProbGreater0Frontier(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                      storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::utility::ThreadPool threadPool(numberOfThreads);
+    storm::storage::BitVector statesWithProbabilityGreater0 = psiStates;
+    detail::performFrontierBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, psiStates, threadPool, nullptr);
+    return statesWithProbabilityGreater0;
+}
+
+template<typename T>
+storm::storage::BitVector performProb1Frontier(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::utility::ThreadPool threadPool(numberOfThreads);
+    storm::storage::BitVector statesWithProbabilityGreater0 = psiStates;
+    detail::performFrontierBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, psiStates, threadPool, nullptr);
+    // The states with probability less than one are those that can reach a state with probability zero without passing a psi state.
+    storm::storage::BitVector statesWithProbability1 = ~statesWithProbabilityGreater0;
+    detail::performFrontierBackwardSearch(backwardTransitions, ~psiStates, statesWithProbability1, ~statesWithProbabilityGreater0, threadPool, nullptr);
+    statesWithProbability1.complement();
+    return statesWithProbability1;
+}
+
+template<typename T>
+storm::storage::BitVector performProb0AFrontier(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::storage::BitVector statesWithProbability0 = performProbGreater0Frontier(backwardTransitions, phiStates, psiStates, numberOfThreads);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0AFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                       std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                       storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::utility::ThreadPool threadPool(numberOfThreads);
+    storm::storage::BitVector statesWithProbabilityGreater0 = psiStates;
+    // A state is added if every choice has at least one successor that has been added before.
+    auto allChoicesReachResult = [&](uint64_t state) {
+        for (uint64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+            bool hasSuccessorWithProbabilityGreater0 = false;
+            for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                if (statesWithProbabilityGreater0.get(successorEntry.getColumn())) {
+                    hasSuccessorWithProbabilityGreater0 = true;
+                    break;
+                }
+            }
+            if (!hasSuccessorWithProbabilityGreater0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    detail::performFrontierBackwardSearch(backwardTransitions, phiStates, statesWithProbabilityGreater0, psiStates, threadPool, allChoicesReachResult);
+    return statesWithProbabilityGreater0;
+}
+
+template<typename T>
+storm::storage::BitVector performProb0EFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::storage::BitVector statesWithProbability0 =
+        performProbGreater0AFrontier(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, numberOfThreads);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+template<typename T>
+storm::storage::BitVector performProb1EFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint,
+                                                uint64_t numberOfThreads) {
+    storm::utility::ThreadPool threadPool(numberOfThreads);
+
+    // The candidates for the states with probability 1. This set only gets smaller in each iteration.
+    storm::storage::BitVector currentStates(phiStates.size(), true);
+
+    // The (allowed) choices all of whose successors are in the current states. This set is updated incrementally whenever states are removed.
+    storm::storage::BitVector enabledChoices = choiceConstraint ? choiceConstraint.get() : storm::storage::BitVector(transitionMatrix.getRowCount(), true);
+
+    while (true) {
+        // Compute the states that can reach a psi state using only enabled choices.
+        storm::storage::BitVector nextStates = psiStates;
+        auto hasEnabledChoiceReachingResult = [&](uint64_t state) {
+            for (uint64_t row = enabledChoices.getNextSetIndex(nondeterministicChoiceIndices[state]); row < nondeterministicChoiceIndices[state + 1];
+                 row = enabledChoices.getNextSetIndex(row + 1)) {
+                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                    if (nextStates.get(successorEntry.getColumn())) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+        // States that were removed before can never be added again, so we can restrict the search to the current states.
+        detail::performFrontierBackwardSearch(backwardTransitions, phiStates & currentStates, nextStates, psiStates, threadPool,
+                                              hasEnabledChoiceReachingResult);
+
+        storm::storage::BitVector removedStates = currentStates & ~nextStates;
+        if (removedStates.empty()) {
+            break;
+        }
+        currentStates = std::move(nextStates);
+
+        // Disable the choices that lead to a removed state. Only the (remaining) predecessors of removed states are affected.
+        storm::storage::BitVector affectedStates = detail::getPredecessors(backwardTransitions, removedStates);
+        affectedStates &= currentStates;
+        for (auto state : affectedStates) {
+            for (uint64_t row = enabledChoices.getNextSetIndex(nondeterministicChoiceIndices[state]); row < nondeterministicChoiceIndices[state + 1];
+                 row = enabledChoices.getNextSetIndex(row + 1)) {
+                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                    if (removedStates.get(successorEntry.getColumn())) {
+                        enabledChoices.set(row, false);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    return currentStates;
+}
+
+template<typename T>
+storm::storage::BitVector performProb1AFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::utility::ThreadPool threadPool(numberOfThreads);
+
+    // The candidates for the states with probability 1. This set only gets smaller in each iteration.
+    storm::storage::BitVector currentStates(phiStates.size(), true);
+
+    // The states all of whose choices only lead to current states. This set is updated incrementally whenever states are removed.
+    storm::storage::BitVector closedStates(phiStates.size(), true);
+
+    while (true) {
+        // Compute the states for which every choice leads to a state that has been added before.
+        storm::storage::BitVector nextStates = psiStates;
+        auto allChoicesReachResult = [&](uint64_t state) {
+            for (uint64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                bool hasSuccessorWithProbability1 = false;
+                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                    if (nextStates.get(successorEntry.getColumn())) {
+                        hasSuccessorWithProbability1 = true;
+                        break;
+                    }
+                }
+                if (!hasSuccessorWithProbability1) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        // States that were removed before can never be added again, so we can restrict the search to the current states.
+        storm::storage::BitVector allowedStates = phiStates & currentStates;
+        allowedStates &= closedStates;
+        detail::performFrontierBackwardSearch(backwardTransitions, allowedStates, nextStates, psiStates, threadPool, allChoicesReachResult);
+
+        storm::storage::BitVector removedStates = currentStates & ~nextStates;
+        if (removedStates.empty()) {
+            break;
+        }
+        currentStates = std::move(nextStates);
+
+        // All predecessors of removed states have a choice that leaves the current states.
+        closedStates &= ~detail::getPredecessors(backwardTransitions, removedStates);
+    }
+
+    return currentStates;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<Type, ValueType> const& model,
                                                    storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates,
@@ -1920,7 +2232,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                                        storm::storage::BitVector const& phiStates,
-                                                                                       storm::storage::BitVector const& psiStates);
+                                                                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                             storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
@@ -1959,7 +2271,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
                                                                                           std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                           storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                                           storm::storage::BitVector const& phiStates,
-                                                                                          storm::storage::BitVector const& psiStates);
+                                                                                          storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -2002,7 +2314,43 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
                                                                                           std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                           storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                                           storm::storage::BitVector const& phiStates,
-                                                                                          storm::storage::BitVector const& psiStates);
+                                                                                          storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0Frontier(storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                               uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1Frontier(storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0AFrontier(storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0AFrontier(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0EFrontier(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1EFrontier(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1AFrontier(storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -2064,7 +2412,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                             storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -2104,7 +2452,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
@@ -2134,7 +2482,43 @@ template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<st
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0Frontier(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                               uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1Frontier(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0AFrontier(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0AFrontier(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0EFrontier(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1EFrontier(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1AFrontier(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
@@ -2196,7 +2580,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                                                        storm::storage::BitVector const& phiStates,
-                                                                                       storm::storage::BitVector const& psiStates);
+                                                                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                             storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
@@ -2234,7 +2618,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::Interval> const& model, storm::storage::BitVector const& phiStates,
@@ -2264,7 +2648,43 @@ template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<st
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0Frontier(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                               uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1Frontier(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0AFrontier(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0AFrontier(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0EFrontier(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1EFrontier(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1AFrontier(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::Interval> const& model, storm::storage::BitVector const& phiStates,
@@ -2322,7 +2742,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates,
                                      storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
@@ -2351,7 +2771,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
@@ -2383,7 +2803,43 @@ template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<st
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0Frontier(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                               storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                               uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1Frontier(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0AFrontier(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProbGreater0AFrontier(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb0EFrontier(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1EFrontier(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         boost::optional<storm::storage::BitVector> const& choiceConstraint, uint64_t numberOfThreads);
+
+template storm::storage::BitVector performProb1AFrontier(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                         storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                         uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
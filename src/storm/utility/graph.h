@@ -201,13 +201,14 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
  * @param backwardTransitions The backward transitions of the model whose graph structure to search.
  * @param phiStates The set of all states satisfying phi.
  * @param psiStates The set of all states satisfying psi.
+ * @param numberOfThreads If larger than one, the frontier-based searches are performed using (at most) this many threads.
  * @return A pair of bit vectors such that the first bit vector stores the indices of all states
  * with probability 0 and the second stores all indices of states with probability 1.
  */
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
-                                                                              storm::storage::BitVector const& psiStates);
+                                                                              storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the set of states that has a positive probability of reaching psi states after only passing
@@ -427,12 +428,15 @@ storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicM
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+/*!
+ * Variant of performProb01Max operating on the given matrices. If the number of threads is larger than one, the frontier-based searches are used.
+ */
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates);
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -516,12 +520,15 @@ storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& t
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates);
 
+/*!
+ * Variant of performProb01Min operating on the given matrices. If the number of threads is larger than one, the frontier-based searches are used.
+ */
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates);
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -538,6 +545,127 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
 
+/*
+ * The following functions are frontier-based variants of the qualitative analyses above (without step bounds).
+ * Instead of a depth-first search that processes one state at a time, they perform a layered backward search. The frontier of each
+ * layer is kept as a list of states, such that the work per layer is proportional to the number of transitions of the frontier.
+ * Optionally, large frontiers are split into chunks that are processed by multiple threads. The results coincide with the results
+ * of the corresponding functions above.
+ */
+
+/*!
+ * Frontier-based variant of performProbGreater0 (without step bound).
+ *
+ * @param backwardTransitions The reversed transition relation of the graph structure to search.
+ * @param phiStates A bit vector of all states satisfying phi.
+ * @param psiStates A bit vector of all states satisfying psi.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector with all indices of states that have a probability greater than 0.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0Frontier(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                      storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
+
+/*!
+ * Frontier-based variant of performProb1 for deterministic models.
+ *
+ * @param backwardTransitions The reversed transition relation of the graph structure to search.
+ * @param phiStates A bit vector of all states satisfying phi.
+ * @param psiStates A bit vector of all states satisfying psi.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector with all indices of states that have probability 1.
+ */
+template<typename T>
+storm::storage::BitVector performProb1Frontier(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
+
+/*!
+ * Frontier-based variant of performProb0A.
+ *
+ * @param backwardTransitions The reversed transition relation of the model.
+ * @param phiStates The set of all states satisfying phi.
+ * @param psiStates The set of all states satisfying psi.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector that represents all states with probability 0 under all schedulers.
+ */
+template<typename T>
+storm::storage::BitVector performProb0AFrontier(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
+
+/*!
+ * Frontier-based variant of performProbGreater0A (without step bound).
+ *
+ * @param transitionMatrix The transition matrix of the model.
+ * @param nondeterministicChoiceIndices The row group indices of the transition matrix.
+ * @param backwardTransitions The reversed transition relation of the model.
+ * @param phiStates The set of all states satisfying phi.
+ * @param psiStates The set of all states satisfying psi.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector that represents all states with probability greater 0 under all schedulers.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0AFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                       std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                       storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
+
+/*!
+ * Frontier-based variant of performProb0E.
+ *
+ * @param transitionMatrix The transition matrix of the model.
+ * @param nondeterministicChoiceIndices The row group indices of the transition matrix.
+ * @param backwardTransitions The reversed transition relation of the model.
+ * @param phiStates The set of all states satisfying phi.
+ * @param psiStates The set of all states satisfying psi.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector that represents all states with probability 0 under at least one scheduler.
+ */
+template<typename T>
+storm::storage::BitVector performProb0EFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
+
+/*!
+ * Frontier-based variant of performProb1E. In contrast to performProb1E, the outer fixpoint iterations do not start from scratch:
+ * the set of choices that stay within the current candidate states is maintained incrementally, i.e., after an iteration only
+ * the predecessors of the removed states are inspected.
+ *
+ * @param transitionMatrix The transition matrix of the model.
+ * @param nondeterministicChoiceIndices The row group indices of the transition matrix.
+ * @param backwardTransitions The reversed transition relation of the model.
+ * @param phiStates The set of all states satisfying phi.
+ * @param psiStates The set of all states satisfying psi.
+ * @param choiceConstraint If given, only the selected choices are considered.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector that represents all states with probability 1 under at least one scheduler.
+ */
+template<typename T>
+storm::storage::BitVector performProb1EFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates,
+                                                boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none, uint64_t numberOfThreads = 1);
+
+/*!
+ * Frontier-based variant of performProb1A. In contrast to performProb1A, the outer fixpoint iterations do not start from scratch:
+ * the set of states whose choices all stay within the current candidate states is maintained incrementally (as the complement
+ * of the predecessors of all removed states).
+ *
+ * @param transitionMatrix The transition matrix of the model.
+ * @param nondeterministicChoiceIndices The row group indices of the transition matrix.
+ * @param backwardTransitions The reversed transition relation of the model.
+ * @param phiStates The set of all states satisfying phi.
+ * @param psiStates The set of all states satisfying psi.
+ * @param numberOfThreads The number of threads used to process the frontier.
+ * @return A bit vector that represents all states with probability 1 under all schedulers.
+ */
+template<typename T>
+storm::storage::BitVector performProb1AFrontier(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
+
 /*!
  * Computes the set of states for which there exists a scheduler that achieves a probability greater than
  * zero of satisfying phi until psi.
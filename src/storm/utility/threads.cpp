@@ -1,7 +1,11 @@
 #include "storm/utility/threads.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <exception>
 #include <thread>
+#include <vector>
 
 #include "storm/io/file.h"
 
@@ -65,4 +69,160 @@ uint getNumberOfThreads() {
     }
     return detail::num_threads;
 }
-}  // namespace storm::utility
\ No newline at end of file
+
+uint64_t getNumberOfParallelChunks(uint64_t begin, uint64_t end, uint64_t numberOfThreads) {
+    if (end <= begin) {
+        return 0;
+    }
+    return std::max<uint64_t>(1, std::min(numberOfThreads, end - begin));
+}
+
+namespace detail {
+std::vector<std::pair<uint64_t, uint64_t>> getParallelChunks(uint64_t begin, uint64_t end, uint64_t numberOfThreads) {
+    uint64_t const numberOfChunks = getNumberOfParallelChunks(begin, end, numberOfThreads);
+    std::vector<std::pair<uint64_t, uint64_t>> result;
+    result.reserve(numberOfChunks);
+    if (numberOfChunks == 0) {
+        return result;
+    }
+    uint64_t const chunkSize = (end - begin) / numberOfChunks;
+    uint64_t const remainder = (end - begin) % numberOfChunks;
+    uint64_t chunkBegin = begin;
+    for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+        uint64_t chunkEnd = chunkBegin + chunkSize + (chunk < remainder ? 1 : 0);
+        result.emplace_back(chunkBegin, chunkEnd);
+        chunkBegin = chunkEnd;
+    }
+    return result;
+}
+}  // namespace detail
+
+void processInParallel(uint64_t begin, uint64_t end, uint64_t numberOfThreads, std::function<void(uint64_t, uint64_t, uint64_t)> const& function) {
+    uint64_t const numberOfChunks = getNumberOfParallelChunks(begin, end, numberOfThreads);
+    if (numberOfChunks <= 1) {
+        if (numberOfChunks == 1) {
+            function(begin, end, 0);
+        }
+        return;
+    }
+
+    auto const chunks = detail::getParallelChunks(begin, end, numberOfThreads);
+    std::vector<std::exception_ptr> exceptions(numberOfChunks);
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfChunks - 1);
+    for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+        uint64_t const chunkBegin = chunks[chunk].first;
+        uint64_t const chunkEnd = chunks[chunk].second;
+        auto processChunk = [&function, &exceptions, chunkBegin, chunkEnd, chunk]() {
+            try {
+                function(chunkBegin, chunkEnd, chunk);
+            } catch (...) {
+                exceptions[chunk] = std::current_exception();
+            }
+        };
+        if (chunk + 1 < numberOfChunks) {
+            threads.emplace_back(processChunk);
+        } else {
+            // The last chunk is processed by the calling thread.
+            processChunk();
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+ThreadPool::ThreadPool(uint64_t numberOfThreads)
+    : numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)), generation(0), pendingChunks(0), stop(false), currentFunction(nullptr) {
+    // The calling thread processes the first chunk, so we only need workers for the remaining ones.
+    workers.reserve(this->numberOfThreads - 1);
+    for (uint64_t chunk = 1; chunk < this->numberOfThreads; ++chunk) {
+        workers.emplace_back([this, chunk]() { work(chunk); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    startCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+uint64_t ThreadPool::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void ThreadPool::processInParallel(uint64_t begin, uint64_t end, std::function<void(uint64_t, uint64_t, uint64_t)> const& function) {
+    uint64_t const numberOfChunks = getNumberOfParallelChunks(begin, end, numberOfThreads);
+    if (numberOfChunks <= 1) {
+        if (numberOfChunks == 1) {
+            function(begin, end, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        chunks = detail::getParallelChunks(begin, end, numberOfThreads);
+        exceptions.assign(numberOfChunks, nullptr);
+        currentFunction = &function;
+        pendingChunks = numberOfChunks - 1;
+        ++generation;
+    }
+    startCondition.notify_all();
+
+    try {
+        function(chunks.front().first, chunks.front().second, 0);
+    } catch (...) {
+        exceptions.front() = std::current_exception();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        doneCondition.wait(lock, [this]() { return pendingChunks == 0; });
+        currentFunction = nullptr;
+    }
+    for (auto const& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+void ThreadPool::work(uint64_t chunkIndex) {
+    uint64_t processedGeneration = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        startCondition.wait(lock, [this, &processedGeneration]() { return stop || generation != processedGeneration; });
+        if (stop) {
+            return;
+        }
+        processedGeneration = generation;
+        if (chunkIndex >= chunks.size()) {
+            // This worker is not needed for the current range.
+            continue;
+        }
+        auto const [chunkBegin, chunkEnd] = chunks[chunkIndex];
+        auto const& function = *currentFunction;
+        lock.unlock();
+        try {
+            function(chunkBegin, chunkEnd, chunkIndex);
+        } catch (...) {
+            exceptions[chunkIndex] = std::current_exception();
+        }
+        lock.lock();
+        if (--pendingChunks == 0) {
+            doneCondition.notify_one();
+        }
+    }
+}
+}  // namespace storm::utility
@@ -1,7 +1,77 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace storm {
 namespace utility {
 uint getNumberOfThreads();
-}
-}  // namespace storm
\ No newline at end of file
+
+/*!
+ * Splits the range [begin, end) into (at most) the given number of contiguous chunks of (almost) equal size and processes each chunk in a separate thread.
+ * If only a single chunk is needed, it is processed in the calling thread.
+ *
+ * @param begin The first index of the range.
+ * @param end The index after the last index of the range.
+ * @param numberOfThreads The maximal number of threads to use.
+ * @param function The function to call as function(chunkBegin, chunkEnd, chunkIndex). The chunk indices are 0,1,...
+ * @note An exception thrown while processing a chunk is rethrown in the calling thread (after all threads have finished).
+ */
+void processInParallel(uint64_t begin, uint64_t end, uint64_t numberOfThreads, std::function<void(uint64_t, uint64_t, uint64_t)> const& function);
+
+/*!
+ * Retrieves the number of chunks that processInParallel uses for the given range and number of threads.
+ */
+uint64_t getNumberOfParallelChunks(uint64_t begin, uint64_t end, uint64_t numberOfThreads);
+
+/*!
+ * A fixed set of worker threads that can repeatedly process ranges in parallel.
+ * In contrast to processInParallel, the threads are only created once, which makes it suitable for processing many (small) ranges, e.g., one in
+ * every step of an iterative method.
+ * @note The pool must not be used concurrently by multiple threads, and the processing function must not use the pool itself.
+ */
+class ThreadPool {
+   public:
+    /*!
+     * Creates a pool that processes ranges using (at most) the given number of threads (including the calling thread).
+     */
+    explicit ThreadPool(uint64_t numberOfThreads);
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    /*!
+     * Retrieves the (maximal) number of threads that are used to process a range.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Processes the range [begin, end) in the same chunks as the free function processInParallel.
+     */
+    void processInParallel(uint64_t begin, uint64_t end, std::function<void(uint64_t, uint64_t, uint64_t)> const& function);
+
+   private:
+    void work(uint64_t chunkIndex);
+
+    uint64_t numberOfThreads;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+    // Incremented whenever a new range is to be processed.
+    uint64_t generation;
+    uint64_t pendingChunks;
+    bool stop;
+    std::function<void(uint64_t, uint64_t, uint64_t)> const* currentFunction;
+    std::vector<std::pair<uint64_t, uint64_t>> chunks;
+    std::vector<std::exception_ptr> exceptions;
+};
+}  // namespace utility
+}  // namespace storm
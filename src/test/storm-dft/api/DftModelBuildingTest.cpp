@@ -87,4 +87,54 @@ TEST(DftModelBuildingTest, RelevantEvents) {
     EXPECT_EQ(13ul, model->getNumberOfTransitions());
 }
 
+TEST(DftModelBuildingTest, ParallelExploration) {
+    // Initialize
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/dont_care.dft";
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    storm::dft::storage::DftSymmetries symmetries;
+
+    // Set relevant events (none)
+    storm::dft::utility::RelevantEvents relevantEvents{};
+    dft->setRelevantEvents(relevantEvents, false);
+    // Build model
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+    builder.setNumberOfThreads(3);
+    builder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = builder.getModel();
+    EXPECT_EQ(8ul, model->getNumberOfStates());
+    EXPECT_EQ(13ul, model->getNumberOfTransitions());
+
+    // Set relevant events (all)
+    relevantEvents = storm::dft::utility::RelevantEvents({"all"});
+    dft->setRelevantEvents(relevantEvents, false);
+    // Build model
+    storm::dft::builder::ExplicitDFTModelBuilder<double> builder2(*dft, symmetries);
+    builder2.setNumberOfThreads(3);
+    builder2.buildModel(0, 0.0);
+    model = builder2.getModel();
+    EXPECT_EQ(512ul, model->getNumberOfStates());
+    EXPECT_EQ(2305ul, model->getNumberOfTransitions());
+}
+
+TEST(DftModelBuildingTest, ParametricWithThreads) {
+    std::string file = STORM_TEST_RESOURCES_DIR "/dft/symmetry_param.dft";
+    std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunction>> dft = storm::dft::api::loadDFTGalileoFile<storm::RationalFunction>(file);
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+    storm::dft::storage::DftSymmetries symmetries;
+
+    storm::dft::builder::ExplicitDFTModelBuilder<storm::RationalFunction> builder(*dft, symmetries);
+    builder.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model = builder.getModel();
+
+    // Parametric DFTs are explored sequentially even if several threads are requested.
+    storm::dft::builder::ExplicitDFTModelBuilder<storm::RationalFunction> builder2(*dft, symmetries);
+    builder2.setNumberOfThreads(3);
+    builder2.buildModel(0, 0.0);
+    std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model2 = builder2.getModel();
+    EXPECT_EQ(model->getNumberOfStates(), model2->getNumberOfStates());
+    EXPECT_EQ(model->getNumberOfTransitions(), model2->getNumberOfTransitions());
+    EXPECT_EQ(model->getTransitionMatrix(), model2->getTransitionMatrix());
+}
+
 }  // namespace
@@ -122,6 +122,26 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, Timepoints) {
+    // Chunks of size 1 are evaluated concurrently
+    std::vector<double> const timepoints{0.5, 1, 2};
+    auto const probabilities{checker->getProbabilitiesAtTimepoints(timepoints, 1)};
+    auto const raws{checker->getAllRAWsAtTimepoints(timepoints, 1)};
+    ASSERT_EQ(probabilities.size(), timepoints.size());
+    for (size_t i{0}; i < timepoints.size(); ++i) {
+        EXPECT_NEAR(probabilities[i], checker->getProbabilityAtTimebound(timepoints[i]), 1e-6);
+        auto const rawsAtTimebound{checker->getAllRAWsAtTimebound(timepoints[i])};
+        ASSERT_EQ(raws.size(), rawsAtTimebound.size());
+        for (size_t be{0}; be < raws.size(); ++be) {
+            if (!std::isinf(rawsAtTimebound[be])) {
+                EXPECT_NEAR(raws[be][i], rawsAtTimebound[be], 1e-6);
+            } else {
+                EXPECT_EQ(raws[be][i], rawsAtTimebound[be]);
+            }
+        }
+    }
+}
+
 static std::vector<SftTestData> sftTestData{
     {
         "And",
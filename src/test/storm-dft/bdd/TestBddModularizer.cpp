@@ -28,6 +28,21 @@ TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
     EXPECT_NEAR(checker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
 }
 
+TEST_P(BddModularizerTest, Concurrent) {
+    auto const &param{TestWithParam::GetParam()};
+    checker->setNumberOfThreads(3);
+    checker->setMaxSimultaneousBuilds(2);
+    EXPECT_NEAR(checker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
+
+    // Cached module results are combined with newly computed ones
+    auto const probabilities{checker->getProbabilitiesAtTimepoints({0.5, 1})};
+    ASSERT_EQ(2ul, probabilities.size());
+    EXPECT_NEAR(probabilities[1], param.probabilityAtTimeboundOne, 1e-6);
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(param.filepath)};
+    storm::dft::modelchecker::DftModularizationChecker<double> sequentialChecker{dft};
+    EXPECT_NEAR(probabilities[0], sequentialChecker.getProbabilityAtTimebound(0.5), 1e-6);
+}
+
 static std::vector<ModularizerTestData> modularizerTestData{
     {
         "And",
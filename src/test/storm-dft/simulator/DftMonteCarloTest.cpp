@@ -0,0 +1,90 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/simulator/DFTMonteCarloEstimator.h"
+
+namespace {
+
+std::vector<storm::dft::simulator::MonteCarloResult> estimateDft(std::string const& file, std::vector<double> const& timebounds,
+                                                                 storm::dft::simulator::MonteCarloOptions const& options) {
+    // Load, build and prepare DFT
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+
+    // Set relevant events
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents({}, {});
+    dft->setRelevantEvents(relevantEvents, false);
+
+    return storm::dft::api::simulateDFT<double>(*dft, timebounds, options, false);
+}
+
+TEST(DftMonteCarloTest, AndUnreliability) {
+    storm::dft::simulator::MonteCarloOptions options;
+    options.maxTraces = 20000;
+    options.relativeError = 0;
+    std::vector<storm::dft::simulator::MonteCarloResult> results = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2}, options);
+    ASSERT_EQ(1ul, results.size());
+    EXPECT_NEAR(results[0].estimate, 0.3995764009, 0.01);
+    EXPECT_LE(results[0].lowerBound, results[0].estimate);
+    EXPECT_GE(results[0].upperBound, results[0].estimate);
+    EXPECT_LT(results[0].upperBound - results[0].lowerBound, 0.02);
+}
+
+TEST(DftMonteCarloTest, MultipleTimebounds) {
+    storm::dft::simulator::MonteCarloOptions options;
+    options.maxTraces = 20000;
+    options.relativeError = 0;
+    std::vector<storm::dft::simulator::MonteCarloResult> results = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/or.dft", {0.5, 1}, options);
+    ASSERT_EQ(2ul, results.size());
+    EXPECT_NEAR(results[0].estimate, 0.3934693403, 0.01);
+    EXPECT_NEAR(results[1].estimate, 0.6321205588, 0.01);
+}
+
+TEST(DftMonteCarloTest, ThreadsDoNotAffectResult) {
+    storm::dft::simulator::MonteCarloOptions options;
+    options.maxTraces = 10000;
+    options.batchSize = 500;
+    options.relativeError = 0.05;
+    options.seed = 42;
+    std::vector<storm::dft::simulator::MonteCarloResult> sequential = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2}, options);
+    options.numberOfThreads = 3;
+    std::vector<storm::dft::simulator::MonteCarloResult> parallel = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2}, options);
+    ASSERT_EQ(sequential.size(), parallel.size());
+    EXPECT_EQ(sequential[0].estimate, parallel[0].estimate);
+    EXPECT_EQ(sequential[0].lowerBound, parallel[0].lowerBound);
+    EXPECT_EQ(sequential[0].upperBound, parallel[0].upperBound);
+    // Early stopping
+    EXPECT_LE(parallel[0].upperBound - parallel[0].estimate, 0.05 * parallel[0].estimate);
+}
+
+TEST(DftMonteCarloTest, ImportanceSplitting) {
+    storm::dft::simulator::MonteCarloOptions options;
+    options.maxTraces = 10000;
+    options.relativeError = 0;
+    options.numberOfThreads = 2;
+    options.splittingFactor = 2;
+    std::vector<storm::dft::simulator::MonteCarloResult> results = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2}, options);
+    ASSERT_EQ(1ul, results.size());
+    EXPECT_NEAR(results[0].estimate, 0.3995764009, 0.02);
+    EXPECT_LE(results[0].lowerBound, results[0].estimate);
+    EXPECT_GE(results[0].upperBound, results[0].estimate);
+}
+
+TEST(DftMonteCarloTest, ImportanceSplittingBounded) {
+    storm::dft::simulator::MonteCarloOptions options;
+    options.maxTraces = 1000;
+    options.relativeError = 0;
+    options.numberOfThreads = 2;
+    // Without bound, each trace would be split into 10^12 partial traces
+    options.splittingFactor = 1000000;
+    options.maxSplitTraces = 50;
+    std::vector<storm::dft::simulator::MonteCarloResult> results = estimateDft(STORM_TEST_RESOURCES_DIR "/dft/and.dft", {2}, options);
+    ASSERT_EQ(1ul, results.size());
+    EXPECT_NEAR(results[0].estimate, 0.3995764009, 0.05);
+    EXPECT_LE(results[0].lowerBound, results[0].estimate);
+    EXPECT_GE(results[0].upperBound, results[0].estimate);
+}
+
+}  // namespace
@@ -0,0 +1,204 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-gspn/api/storm-gspn.h"
+#include "storm-gspn/builder/JaniGSPNBuilder.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/storm.h"
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+
+namespace {
+
+std::vector<std::shared_ptr<storm::logic::Formula const>> parseFormulas(storm::gspn::GSPN const& gspn, std::vector<std::string> const& formulaStrings) {
+    storm::parser::FormulaParser formulaParser(gspn.getExpressionManager());
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    for (auto const& formulaString : formulaStrings) {
+        formulas.push_back(formulaParser.parseSingleFormulaFromString(formulaString));
+    }
+    return formulas;
+}
+
+double checkInInitialState(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, true));
+    EXPECT_TRUE(result->isExplicitQuantitativeCheckResult());
+    return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+}
+
+/*!
+ * Builds the GSPN with the native generator and via the translation to JANI, checks that both models have the same size and that the given
+ * formulas yield the same results on both models.
+ *
+ * @return The results of the formulas on the natively built model.
+ */
+std::vector<double> buildAndCompareWithJani(storm::gspn::GSPN const& gspn, std::vector<std::string> const& formulaStrings, uint64_t expectedNumberOfStates) {
+    storm::builder::JaniGSPNBuilder janiBuilder(gspn);
+    std::unique_ptr<storm::jani::Model> janiModel(janiBuilder.build());
+    auto formulas = parseFormulas(gspn, formulaStrings);
+    // Both models are built with the same options. Terminal states are not used as they would only be set for a single formula.
+    storm::builder::BuilderOptions options(formulas, *janiModel);
+    options.clearTerminalStates();
+
+    auto janiSparseModel = storm::api::buildSparseModel<double>(*janiModel, options);
+    auto nativeSparseModel = storm::api::buildSparseModel<double>(gspn, options);
+    EXPECT_EQ(janiSparseModel->getType(), nativeSparseModel->getType());
+    EXPECT_EQ(expectedNumberOfStates, nativeSparseModel->getNumberOfStates());
+    EXPECT_EQ(janiSparseModel->getNumberOfStates(), nativeSparseModel->getNumberOfStates());
+    EXPECT_EQ(janiSparseModel->getNumberOfChoices(), nativeSparseModel->getNumberOfChoices());
+    EXPECT_EQ(janiSparseModel->getNumberOfTransitions(), nativeSparseModel->getNumberOfTransitions());
+
+    std::vector<double> results;
+    for (auto const& formula : formulas) {
+        double nativeResult = checkInInitialState(nativeSparseModel, formula);
+        EXPECT_NEAR(checkInInitialState(janiSparseModel, formula), nativeResult, 1e-6) << "for formula " << *formula;
+        results.push_back(nativeResult);
+    }
+    return results;
+}
+
+TEST(GspnNextStateGeneratorTest, PrioritiesAndWeights) {
+    storm::gspn::GspnBuilder builder;
+    builder.addPlace(1, 1, "start");
+    builder.addPlace(1, 0, "a");
+    builder.addPlace(1, 0, "b");
+    builder.addPlace(1, 0, "c");
+    builder.addPlace(1, 0, "done");
+    // The transitions of the highest priority form one weighted partition, the transition with lower priority is never enabled
+    builder.addImmediateTransition(2, 1, "toA");
+    builder.addImmediateTransition(2, 3, "toB");
+    builder.addImmediateTransition(1, 1, "toC");
+    builder.addTimedTransition(0, 2, "fromA");
+    builder.addTimedTransition(0, 0.5, "fromB");
+    builder.addNormalArc("start", "toA");
+    builder.addNormalArc("toA", "a");
+    builder.addNormalArc("start", "toB");
+    builder.addNormalArc("toB", "b");
+    builder.addNormalArc("start", "toC");
+    builder.addNormalArc("toC", "c");
+    builder.addNormalArc("a", "fromA");
+    builder.addNormalArc("fromA", "done");
+    builder.addNormalArc("b", "fromB");
+    builder.addNormalArc("fromB", "done");
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    auto results = buildAndCompareWithJani(*gspn, {"Pmax=? [F c=1]", "Pmin=? [F a=1]", "Tmin=? [F done=1]"}, 4);
+    EXPECT_NEAR(0.0, results[0], 1e-6);
+    EXPECT_NEAR(0.25, results[1], 1e-6);
+    EXPECT_NEAR(1.625, results[2], 1e-6);
+}
+
+TEST(GspnNextStateGeneratorTest, NondeterminismAndInhibition) {
+    storm::gspn::GspnBuilder builder;
+    builder.addPlace(1, 1, "start");
+    builder.addPlace(1, 0, "x");
+    builder.addPlace(1, 0, "y");
+    builder.addPlace(boost::none, 1, "cnt");
+    builder.addPlace(1, 0, "goal");
+    builder.addPlace(1, 0, "fail");
+    // Immediate transitions without weight are put in separate partitions, i.e., the choice between them is nondeterministic
+    builder.addImmediateTransition(1, 0, "toX");
+    builder.addImmediateTransition(1, 0, "toY");
+    builder.addTimedTransition(0, 3, "xGoal");
+    builder.addTimedTransition(0, 5, "xFail");
+    builder.addTimedTransition(0, 1, "yGoal");
+    builder.addTimedTransition(0, 2, "yFail");
+    builder.addNormalArc("start", "toX");
+    builder.addNormalArc("toX", "x");
+    builder.addNormalArc("start", "toY");
+    builder.addNormalArc("toY", "y");
+    builder.addNormalArc("x", "xGoal");
+    builder.addNormalArc("xGoal", "goal");
+    builder.addNormalArc("x", "xFail");
+    builder.addNormalArc("xFail", "fail");
+    builder.addNormalArc("y", "yGoal");
+    builder.addNormalArc("yGoal", "goal");
+    builder.addNormalArc("y", "yFail");
+    builder.addNormalArc("yFail", "fail");
+    // xFail is inhibited by the token in cnt, yFail is not
+    builder.addInhibitionArc("cnt", "xFail", 1);
+    builder.addInhibitionArc("cnt", "yFail", 2);
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    auto results = buildAndCompareWithJani(*gspn, {"Pmax=? [F goal=1]", "Pmin=? [F goal=1]", "Pmax=? [F fail=1]"}, 5);
+    EXPECT_NEAR(1.0, results[0], 1e-6);
+    EXPECT_NEAR(1.0 / 3.0, results[1], 1e-6);
+    EXPECT_NEAR(2.0 / 3.0, results[2], 1e-6);
+}
+
+TEST(GspnNextStateGeneratorTest, EnablingDegree) {
+    storm::gspn::GspnBuilder builder;
+    builder.addPlace(1, 1, "go");
+    builder.addPlace(boost::none, 4, "pool");
+    builder.addPlace(boost::none, 0, "served");
+    builder.addPlace(boost::none, 4, "pool2");
+    builder.addPlace(boost::none, 0, "served2");
+    builder.addImmediateTransition(1, 1, "start");
+    // Infinite-server semantics with multiplicity 2 and 2-server semantics
+    builder.addTimedTransition(0, 1, boost::none, "serveInf");
+    builder.addTimedTransition(0, 1, 2, "serveK");
+    builder.addInputArc("go", "start");
+    builder.addInputArc("pool", "serveInf", 2);
+    builder.addOutputArc("serveInf", "served");
+    builder.addInputArc("pool2", "serveK");
+    builder.addOutputArc("serveK", "served2");
+    builder.addInhibitionArc("go", "serveInf");
+    builder.addInhibitionArc("go", "serveK");
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    // The initial marking and 3 * 5 markings after firing start
+    auto results = buildAndCompareWithJani(*gspn, {"Tmin=? [F served=2]", "Tmin=? [F served2=4]", "Pmin=? [F<=1 served=2 & served2=4]"}, 16);
+    EXPECT_NEAR(1.5, results[0], 1e-6);
+    EXPECT_NEAR(2.5, results[1], 1e-6);
+}
+
+TEST(GspnNextStateGeneratorTest, Capacities) {
+    storm::gspn::GspnBuilder builder;
+    builder.addPlace(1, 1, "go");
+    builder.addPlace(boost::none, 0, "buffer");
+    builder.addImmediateTransition(1, 1, "start");
+    builder.addTimedTransition(0, 1, "produce");
+    builder.addTimedTransition(0, 2, "consume");
+    builder.addInputArc("go", "start");
+    builder.addOutputArc("produce", "buffer");
+    builder.addInputArc("buffer", "consume");
+    builder.addInhibitionArc("go", "produce");
+    builder.addInhibitionArc("buffer", "produce", 3);
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+    gspn->setCapacities({{"buffer", 3}});
+
+    auto results = buildAndCompareWithJani(*gspn, {"LRAmin=? [buffer=3]", "Tmin=? [F buffer=3]"}, 5);
+    EXPECT_NEAR(1.0 / 15.0, results[0], 1e-6);
+    EXPECT_NEAR(11.0, results[1], 1e-6);
+}
+
+TEST(GspnNextStateGeneratorTest, ZeroMultiplicityInputArc) {
+    storm::gspn::GspnBuilder builder;
+    builder.addPlace(boost::none, 3, "pool");
+    builder.addPlace(boost::none, 0, "empty");
+    builder.addPlace(boost::none, 0, "served");
+    builder.addTimedTransition(0, 1, boost::none, "serve");
+    builder.addInputArc("pool", "serve");
+    // An input arc with multiplicity zero does not restrict the enabling degree
+    builder.addInputArc("empty", "serve", 0);
+    builder.addOutputArc("serve", "served");
+    std::unique_ptr<storm::gspn::GSPN> gspn(builder.buildGspn());
+
+    auto formulas = parseFormulas(*gspn, {"T=? [F served=3]"});
+    auto model = storm::api::buildSparseModel<double>(*gspn, storm::builder::BuilderOptions(formulas));
+    EXPECT_EQ(storm::models::ModelType::Ctmc, model->getType());
+    EXPECT_EQ(4ul, model->getNumberOfStates());
+    EXPECT_NEAR(1.0 / 3.0 + 1.0 / 2.0 + 1.0, checkInInitialState(model, formulas[0]), 1e-6);
+
+    // Without an input arc of positive multiplicity, the enabling degree is not defined
+    storm::gspn::GspnBuilder builder2;
+    builder2.addPlace(boost::none, 0, "empty");
+    builder2.addPlace(boost::none, 0, "served");
+    builder2.addTimedTransition(0, 1, boost::none, "serve");
+    builder2.addInputArc("empty", "serve", 0);
+    builder2.addOutputArc("serve", "served");
+    std::unique_ptr<storm::gspn::GSPN> gspn2(builder2.buildGspn());
+    STORM_SILENT_EXPECT_THROW(storm::api::buildSparseModel<double>(*gspn2), storm::exceptions::InvalidModelException);
+}
+
+}  // namespace
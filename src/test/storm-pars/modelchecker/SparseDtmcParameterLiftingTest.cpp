@@ -112,6 +112,40 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob) {
                                            storm::modelchecker::RegionResult::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ConcurrentRefinement) {
+    typedef typename TestFixture::ValueType ValueType;
+    typedef typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType CoefficientType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.2<=pK<=0.95", modelParameters);
+
+    // Without coverage threshold, all regions up to the depth limit are analyzed, so the result does not depend on the number of threads.
+    auto getAreas = [&](uint64_t numberOfThreads) {
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+            this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        regionChecker->setNumberOfThreads(numberOfThreads);
+        auto result =
+            regionChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), static_cast<uint64_t>(3));
+        std::map<storm::modelchecker::RegionResult, CoefficientType> areas;
+        for (auto const& regionResult : result->getRegionResults()) {
+            areas[regionResult.second] += regionResult.first.area();
+        }
+        return areas;
+    };
+    auto sequentialAreas = getAreas(1);
+    EXPECT_GT(sequentialAreas[storm::modelchecker::RegionResult::AllSat], storm::utility::zero<CoefficientType>());
+    EXPECT_GT(sequentialAreas[storm::modelchecker::RegionResult::AllViolated], storm::utility::zero<CoefficientType>());
+    EXPECT_EQ(sequentialAreas, getAreas(4));
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
     typedef typename TestFixture::ValueType ValueType;
 
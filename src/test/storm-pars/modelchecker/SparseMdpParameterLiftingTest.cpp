@@ -162,6 +162,50 @@ TYPED_TEST(SparseMdpParameterLiftingTest, two_dice_Prob_exactValidation) {
     }
 }
 
+TYPED_TEST(SparseMdpParameterLiftingTest, two_dice_Prob_ConcurrentRefinement) {
+    typedef typename TestFixture::ValueType ValueType;
+    typedef typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType CoefficientType;
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/two_dice.nm";
+    std::string formulaFile = "P<=0.17 [ F \"doubles\" ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaFile, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+    modelParameters.insert(rewParameters.begin(), rewParameters.end());
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.4<=p1<=0.6,0.4<=p2<=0.6", modelParameters);
+
+    // All workers share the parametric model, so running this test with a thread sanitizer checks that the analysis does not touch shared functions.
+    auto getAreas = [&](uint64_t numberOfThreads, bool validating) {
+        std::shared_ptr<storm::modelchecker::RegionModelChecker<storm::RationalFunction>> regionChecker;
+        if (validating) {
+            regionChecker = storm::api::initializeValidatingRegionModelChecker<storm::RationalFunction, double, storm::RationalNumber>(
+                this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        } else {
+            regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(
+                this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+        }
+        regionChecker->setNumberOfThreads(numberOfThreads);
+        auto result =
+            regionChecker->performRegionRefinement(this->env(), region, storm::utility::zero<storm::RationalFunction>(), static_cast<uint64_t>(4));
+        std::map<storm::modelchecker::RegionResult, CoefficientType> areas;
+        for (auto const& regionResult : result->getRegionResults()) {
+            areas[regionResult.second] += regionResult.first.area();
+        }
+        return areas;
+    };
+    for (bool validating : {false, true}) {
+        auto sequentialAreas = getAreas(1, validating);
+        EXPECT_FALSE(sequentialAreas.empty());
+        EXPECT_EQ(sequentialAreas, getAreas(4, validating));
+    }
+}
+
 TYPED_TEST(SparseMdpParameterLiftingTest, two_dice_Prob_bounded_exactValidation) {
     typedef typename TestFixture::ValueType ValueType;
     if (!std::is_same<ValueType, storm::RationalNumber>::value) {
@@ -0,0 +1,97 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include <carl/core/VariablePool.h>
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/transformer/ParameterLifter.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+class ParameterLifterTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+        carl::VariablePool::getInstance().clear();
+    }
+    void TearDown() override {
+        carl::VariablePool::getInstance().clear();
+    }
+};
+
+/*!
+ * Checks that each lifted matrix entry is the value of the original function at the vertex given by the row label.
+ * If exact is set, the values have to coincide with the (exactly evaluated and then converted) function values.
+ */
+void checkLiftedMatrix(storm::storage::SparseMatrix<storm::RationalFunction> const& pMatrix,
+                       storm::transformer::ParameterLifter<storm::RationalFunction, double> const& lifter,
+                       storm::storage::ParameterRegion<storm::RationalFunction> const& region, bool exact) {
+    auto const& matrix = lifter.getMatrix();
+    auto const& rowLabels = lifter.getRowLabels();
+    ASSERT_EQ(pMatrix.getRowCount(), matrix.getRowGroupCount());
+    ASSERT_EQ(matrix.getRowCount(), rowLabels.size());
+    for (uint64_t state = 0; state < pMatrix.getRowCount(); ++state) {
+        for (auto row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+            auto valuations = rowLabels[row].getConcreteValuations(region);
+            ASSERT_EQ(1ul, valuations.size());
+            auto pRow = pMatrix.getRow(state);
+            auto liftedRow = matrix.getRow(row);
+            ASSERT_EQ(pRow.getNumberOfEntries(), liftedRow.getNumberOfEntries());
+            auto entryIt = liftedRow.begin();
+            for (auto const& pEntry : pRow) {
+                EXPECT_EQ(pEntry.getColumn(), entryIt->getColumn());
+                double expected = storm::utility::convertNumber<double>(storm::utility::parametric::evaluate(pEntry.getValue(), valuations.front()));
+                if (exact) {
+                    EXPECT_EQ(expected, entryIt->getValue()) << "at row " << row << ", column " << entryIt->getColumn();
+                } else {
+                    EXPECT_NEAR(expected, entryIt->getValue(), 1e-12) << "at row " << row << ", column " << entryIt->getColumn();
+                }
+                ++entryIt;
+            }
+        }
+    }
+}
+
+TEST_F(ParameterLifterTest, CompiledEvaluation) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    // Region bounds that are not representable as floating point numbers
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.7,0.3<=pK<=0.9", modelParameters);
+
+    auto const& pMatrix = model->getTransitionMatrix();
+    std::vector<storm::RationalFunction> pVector(pMatrix.getRowCount(), storm::utility::zero<storm::RationalFunction>());
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    storm::transformer::ParameterLifter<storm::RationalFunction, double> lifter(pMatrix, pVector, allStates, allStates, true);
+
+    // By default, the functions are evaluated exactly and the results are converted afterwards.
+    lifter.specifyRegion(region, storm::solver::OptimizationDirection::Maximize);
+    checkLiftedMatrix(pMatrix, lifter, region, true);
+
+    lifter.setUseCompiledEvaluation(true);
+    lifter.specifyRegion(region, storm::solver::OptimizationDirection::Maximize);
+    checkLiftedMatrix(pMatrix, lifter, region, false);
+
+    lifter.setUseCompiledEvaluation(false);
+    lifter.specifyRegion(region, storm::solver::OptimizationDirection::Maximize);
+    checkLiftedMatrix(pMatrix, lifter, region, true);
+}
+
+}  // namespace
+
+#endif
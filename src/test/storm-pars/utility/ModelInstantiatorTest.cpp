@@ -11,6 +11,7 @@
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/api/storm.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -153,6 +154,69 @@ TEST_F(ModelInstantiatorTest, BrpProb) {
     }
 }
 
+TEST_F(ModelInstantiatorTest, BrpProbCompiled) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size() == 1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc =
+        storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    modelInstantiator.setUseCompiledEvaluation(true);
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<storm::RationalNumber>>
+        exactModelInstantiator(*dtmc);
+    exactModelInstantiator.setUseCompiledEvaluation(true);
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    // More valuations than fit into a single batch
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (uint64_t i = 0; i <= 10; ++i) {
+        for (uint64_t j = 0; j <= 10; ++j) {
+            std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+            valuation.emplace(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.1 * i));
+            valuation.emplace(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.1 * j));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    uint64_t numberOfInstantiations = 0;
+    modelInstantiator.instantiate(valuations, [&](uint64_t valuationIndex, storm::models::sparse::Dtmc<double> const& instantiated) {
+        EXPECT_EQ(numberOfInstantiations, valuationIndex);
+        ++numberOfInstantiations;
+        auto const& valuation = valuations[valuationIndex];
+        auto const& exactInstantiated = exactModelInstantiator.instantiate(valuation);
+        ASSERT_EQ(dtmc->getTransitionMatrix().getEntryCount(), instantiated.getTransitionMatrix().getEntryCount());
+        auto instantiatedEntry = instantiated.getTransitionMatrix().begin();
+        auto exactInstantiatedEntry = exactInstantiated.getTransitionMatrix().begin();
+        for (auto const& paramEntry : dtmc->getTransitionMatrix()) {
+            EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
+            storm::RationalNumber evaluatedValue = storm::utility::convertNumber<storm::RationalNumber>(paramEntry.getValue().evaluate(valuation));
+            EXPECT_EQ(evaluatedValue, exactInstantiatedEntry->getValue());
+            EXPECT_NEAR(storm::utility::convertNumber<double>(evaluatedValue), instantiatedEntry->getValue(), 1e-12);
+            ++instantiatedEntry;
+            ++exactInstantiatedEntry;
+        }
+    });
+    EXPECT_EQ(valuations.size(), numberOfInstantiations);
+
+    // Valuations have to assign values to all parameters
+    STORM_SILENT_EXPECT_THROW(modelInstantiator.instantiate(std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>()),
+                              storm::exceptions::InvalidArgumentException);
+}
+
 TEST_F(ModelInstantiatorTest, Brp_Rew) {
     carl::VariablePool::getInstance().clear();
 
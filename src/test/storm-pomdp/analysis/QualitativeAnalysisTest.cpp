@@ -5,6 +5,7 @@
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
 #include "storm-pomdp/analysis/JaniBeliefSupportMdpGenerator.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
+#include "storm-pomdp/analysis/PolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm/api/storm.h"
 #include "storm/builder/ExplicitModelBuilder.h"
@@ -77,6 +78,44 @@ void iterativesearch_test(std::string const& path, std::string const& constants,
     }
 }
 
+void portfolio_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(path);
+    program = storm::utility::prism::preprocess(program, constants);
+    std::shared_ptr<storm::logic::Formula const> formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+    std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp =
+        storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+    storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+    pomdp = makeCanonic.transform();
+
+    // Run graph algorithm
+    auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(*pomdp, *formula);
+    storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+    storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+    pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+    storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    storm::pomdp::MemlessSearchOptions options;
+    uint64_t lookahead = pomdp->getNumberOfStates();
+    // A single search yields the reference result.
+    storm::pomdp::IterativePolicySearch<double> search(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+    auto configurations = storm::pomdp::PolicySearchPortfolio<double>::createConfigurations(options, lookahead, 4);
+    storm::pomdp::PolicySearchPortfolio<double> portfolio(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, configurations, 2);
+    if (wr) {
+        search.computeWinningRegion(lookahead);
+        portfolio.computeWinningRegion();
+        // The merged winning region contains the winning region of a single search.
+        for (uint64_t observation = 0; observation < pomdp->getNrObservations(); ++observation) {
+            for (auto const& winningSet : search.getLastWinningRegion().getWinningSetsPerObservation(observation)) {
+                EXPECT_TRUE(portfolio.getLastWinningRegion().query(observation, winningSet));
+            }
+        }
+    } else {
+        bool result = search.analyzeForInitialStates(lookahead);
+        EXPECT_TRUE(!result || portfolio.analyzeForInitialStates());
+    }
+}
+
 void symbolicbelsup_test(std::string const& path, std::string const& constants, std::string formulaString, bool wr) {
     storm::prism::Program program = storm::parser::PrismParser::parse(path);
     program = storm::utility::prism::preprocess(program, constants);
@@ -154,6 +193,16 @@ TEST_F(QualitativeAnalysis, Iterative_Maze) {
     iterativesearch_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.0", "Pmax=? [!\"bad\" U \"goal\"]", true);
 }
 
+TEST_F(QualitativeAnalysis, Portfolio_Simple) {
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", true);
+}
+
+TEST_F(QualitativeAnalysis, Portfolio_Maze) {
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]", false);
+    portfolio_test(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [!\"bad\" U \"goal\" ]", true);
+}
+
 TEST_F(QualitativeAnalysis, SymbolicBelSup_Simple) {
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.4", "Pmax=? [F \"goal\" ]", false);
     symbolicbelsup_test(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "slippery=0.0", "Pmax=? [F \"goal\" ]", false);
@@ -740,6 +740,41 @@ TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, refuel_Pmin_SE) {
         << "] is not precise enough. If (only) this fails, the result bounds are still correct, but they might be unexpectedly imprecise.\n";
 }
 
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, refuel_Pmax_Threads) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+    auto result = checker.check(this->env(), *data.formula);
+
+    // Expanding beliefs concurrently yields exactly the same bounds.
+    auto parallelOptions = this->options();
+    parallelOptions.explorationThreads = 3;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> parallelChecker(data.model, parallelOptions);
+    auto parallelResult = parallelChecker.check(this->env(), *data.formula);
+    EXPECT_EQ(result.lowerBound, parallelResult.lowerBound);
+    EXPECT_EQ(result.upperBound, parallelResult.upperBound);
+}
+
+TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, refuel_Pmax_NonIncremental) {
+    typedef typename TestFixture::ValueType ValueType;
+
+    auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+    auto result = checker.check(this->env(), *data.formula);
+
+    // Analyzing each refined belief MDP from scratch yields the same bounds (up to the model checking precision).
+    auto nonIncrementalOptions = this->options();
+    nonIncrementalOptions.incrementalSolving = false;
+    storm::pomdp::modelchecker::BeliefExplorationPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> nonIncrementalChecker(data.model,
+                                                                                                                                nonIncrementalOptions);
+    auto nonIncrementalResult = nonIncrementalChecker.check(this->env(), *data.formula);
+    EXPECT_LE(result.lowerBound, nonIncrementalResult.lowerBound + this->modelcheckingPrecision());
+    EXPECT_GE(result.lowerBound, nonIncrementalResult.lowerBound - this->modelcheckingPrecision());
+    EXPECT_LE(result.upperBound, nonIncrementalResult.upperBound + this->modelcheckingPrecision());
+    EXPECT_GE(result.upperBound, nonIncrementalResult.upperBound - this->modelcheckingPrecision());
+}
+
 #if defined STORM_HAVE_Z3_OPTIMIZE
 
 TYPED_TEST(BeliefExplorationPomdpModelCheckerTest, simple_Pmax_Clip) {
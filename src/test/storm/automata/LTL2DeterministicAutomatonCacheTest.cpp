@@ -0,0 +1,167 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomatonCache.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/logic/Formulas.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+storm::automata::DeterministicAutomaton::ptr parseUntilAutomaton(std::string const& a, std::string const& b) {
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "acc-name: Rabin 1\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"" +
+        a + "\" \"" + b +
+        "\"\n"
+        "--BODY--\n"
+        "State: 0 { 0 }\n"
+        "  2 0 1 1\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1\n"
+        "State: 2 { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+    std::istringstream in(aUb);
+    return storm::automata::DeterministicAutomaton::parse(in);
+}
+
+std::shared_ptr<storm::logic::Formula const> untilFormula(std::string const& a, std::string const& b) {
+    return std::make_shared<storm::logic::UntilFormula>(std::make_shared<storm::logic::AtomicLabelFormula>(a),
+                                                        std::make_shared<storm::logic::AtomicLabelFormula>(b));
+}
+
+void expectSameAutomaton(storm::automata::DeterministicAutomaton const& expected, storm::automata::DeterministicAutomaton const& actual) {
+    ASSERT_EQ(expected.getNumberOfStates(), actual.getNumberOfStates());
+    ASSERT_EQ(expected.getNumberOfEdgesPerState(), actual.getNumberOfEdgesPerState());
+    EXPECT_EQ(expected.getInitialState(), actual.getInitialState());
+    EXPECT_EQ(expected.getAPSet().getAPs(), actual.getAPSet().getAPs());
+    for (std::size_t state = 0; state < expected.getNumberOfStates(); ++state) {
+        for (std::size_t label = 0; label < expected.getNumberOfEdgesPerState(); ++label) {
+            EXPECT_EQ(expected.getSuccessor(state, label), actual.getSuccessor(state, label));
+        }
+    }
+    ASSERT_EQ(expected.getAcceptance()->getNumberOfAcceptanceSets(), actual.getAcceptance()->getNumberOfAcceptanceSets());
+    for (unsigned int i = 0; i < expected.getAcceptance()->getNumberOfAcceptanceSets(); ++i) {
+        EXPECT_EQ(expected.getAcceptance()->getAcceptanceSet(i), actual.getAcceptance()->getAcceptanceSet(i));
+    }
+    EXPECT_TRUE(storm::automata::AcceptanceCondition::acceptance_expr::areSyntacticallyEqual(expected.getAcceptance()->getAcceptanceExpression(),
+                                                                                             actual.getAcceptance()->getAcceptanceExpression()));
+}
+
+}  // namespace
+
+TEST(DeterministicAutomaton, BinaryFormat) {
+    auto da = parseUntilAutomaton("a", "b");
+
+    std::stringstream stream;
+    da->writeBinary(stream);
+    storm::automata::DeterministicAutomaton::ptr parsed;
+    ASSERT_NO_THROW(parsed = storm::automata::DeterministicAutomaton::parseBinary(stream));
+    expectSameAutomaton(*da, *parsed);
+
+    std::istringstream garbage("HOA: v1\n");
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::parseBinary(garbage), storm::exceptions::WrongFormatException);
+
+    std::string const binary = stream.str();
+    std::istringstream truncated(binary.substr(0, binary.size() - 1));
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::parseBinary(truncated), storm::exceptions::WrongFormatException);
+}
+
+TEST(DeterministicAutomaton, MalformedBinaryFormat) {
+    auto header = [](std::vector<uint32_t> const& values) {
+        std::string result("STORMDA1");
+        for (uint32_t value : values) {
+            result.append(reinterpret_cast<char const*>(&value), sizeof(value));
+        }
+        return result;
+    };
+
+    // An atomic proposition whose name is longer than the input.
+    std::istringstream longName(header({1, std::numeric_limits<uint32_t>::max()}) + "a");
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::parseBinary(longName), storm::exceptions::WrongFormatException);
+
+    // More states than fit into the input.
+    std::istringstream manyStates(header({0, std::numeric_limits<uint32_t>::max(), 0, 0}) + std::string(1, '\x01'));
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::parseBinary(manyStates), storm::exceptions::WrongFormatException);
+
+    // A deeply nested acceptance expression.
+    std::string deepExpression(100000, static_cast<char>(storm::automata::AcceptanceCondition::acceptance_expr::EXP_NOT));
+    deepExpression.push_back(static_cast<char>(storm::automata::AcceptanceCondition::acceptance_expr::EXP_TRUE));
+    std::istringstream deep(header({0, 1, 0, 0}) + deepExpression + std::string(sizeof(uint32_t), '\0'));
+    STORM_SILENT_EXPECT_THROW(storm::automata::DeterministicAutomaton::parseBinary(deep), storm::exceptions::WrongFormatException);
+}
+
+TEST(LTL2DeterministicAutomatonCache, RenamedFormulas) {
+    storm::automata::LTL2DeterministicAutomatonCache cache(2);
+    uint64_t numberOfCalls = 0;
+    auto translator = [&numberOfCalls](storm::logic::Formula const& f) {
+        ++numberOfCalls;
+        // The translator only sees normalized formulas.
+        EXPECT_EQ("U \"ap0\"  \"ap1\" ", f.toPrefixString());
+        return parseUntilAutomaton("ap0", "ap1");
+    };
+
+    auto da = cache.translate(*untilFormula("x", "y"), "test", translator);
+    EXPECT_EQ(1ull, numberOfCalls);
+    expectSameAutomaton(*parseUntilAutomaton("x", "y"), *da);
+
+    // Renaming the APs yields a cache hit.
+    da = cache.translate(*untilFormula("y", "z"), "test", translator);
+    EXPECT_EQ(1ull, numberOfCalls);
+    EXPECT_EQ(1ull, cache.getNumberOfMemoryHits());
+    expectSameAutomaton(*parseUntilAutomaton("y", "z"), *da);
+
+    // Different translators are not mixed up.
+    cache.translate(*untilFormula("x", "y"), "other", translator);
+    EXPECT_EQ(2ull, numberOfCalls);
+
+    // Exceeding the capacity evicts the least recently used entry.
+    cache.setCapacity(1);
+    cache.translate(*untilFormula("x", "y"), "test", translator);
+    EXPECT_EQ(3ull, numberOfCalls);
+    cache.translate(*untilFormula("x", "y"), "test", translator);
+    EXPECT_EQ(3ull, numberOfCalls);
+    EXPECT_EQ(3ull, cache.getNumberOfTranslations());
+}
+
+TEST(LTL2DeterministicAutomatonCache, Directory) {
+    char directoryTemplate[] = "/tmp/storm-ltl2da-cacheXXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(directoryTemplate));
+    std::string directory(directoryTemplate);
+
+    uint64_t numberOfCalls = 0;
+    auto translator = [&numberOfCalls](storm::logic::Formula const&) {
+        ++numberOfCalls;
+        return parseUntilAutomaton("ap0", "ap1");
+    };
+
+    {
+        storm::automata::LTL2DeterministicAutomatonCache cache(0);
+        cache.setDirectory(directory);
+        cache.translate(*untilFormula("a", "b"), "test", translator);
+        EXPECT_EQ(1ull, numberOfCalls);
+    }
+    {
+        // A fresh cache (e.g. in a subsequent run) finds the stored automaton.
+        storm::automata::LTL2DeterministicAutomatonCache cache(0);
+        cache.setDirectory(directory);
+        auto da = cache.translate(*untilFormula("c", "d"), "test", translator);
+        EXPECT_EQ(1ull, numberOfCalls);
+        EXPECT_EQ(1ull, cache.getNumberOfDiskHits());
+        expectSameAutomaton(*parseUntilAutomaton("c", "d"), *da);
+    }
+    std::filesystem::remove_all(directory);
+}
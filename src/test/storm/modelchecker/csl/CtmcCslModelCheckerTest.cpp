@@ -9,11 +9,14 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -475,6 +478,63 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, BoundedUntilProbabilitiesForTimeBounds) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [ F<=100 !\"minimum\"]", program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    uint64_t initialState = *ctmc->getInitialStates().begin();
+    storm::Environment env;
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+
+    std::vector<double> timeBounds = {0.0, 0.5, 10.0, 25.0, 100.0};
+    storm::modelchecker::CheckTask<storm::logic::BoundedUntilFormula, double> task(
+        formulas.front()->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+    std::vector<std::vector<double>> results = checker.computeBoundedUntilProbabilitiesForTimeBounds(env, task, timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+
+    // Compare with the results obtained for each time bound individually.
+    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+        std::stringstream formulaString;
+        formulaString << "P=? [ F<=" << timeBounds[boundIndex] << " !\"minimum\"]";
+        auto formula = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaString.str(), program)).front();
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initialState], results[boundIndex][initialState], 1e-6);
+    }
+    EXPECT_NEAR(0.0, results.front()[initialState], 1e-6);
+    EXPECT_NEAR(5.5461254704419085E-5, results.back()[initialState], 1e-6);
+
+    timeBounds = {10.0, 0.5};
+    EXPECT_THROW(checker.computeBoundedUntilProbabilitiesForTimeBounds(env, task, timeBounds), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(CtmcCslModelCheckerTest, TransientMethods) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm");
+    std::string formulasString = "P=? [ F<=100 !\"minimum\"]";
+    formulasString += "; P=? [ F[10,100] !\"minimum\"]";
+    formulasString += "; P=? [ F<=0.5 !\"minimum\"]";
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+    uint64_t initialState = *ctmc->getInitialStates().begin();
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*ctmc);
+
+    storm::Environment env;
+    std::vector<double> expectedResults;
+    for (auto const& formula : formulas) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+        expectedResults.push_back(result->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    }
+    EXPECT_NEAR(5.5461254704419085E-5, expectedResults.front(), 1e-6);
+
+    for (auto method : {storm::solver::CtmcTransientMethod::AdaptiveUniformization, storm::solver::CtmcTransientMethod::Krylov}) {
+        env.solver().timeBounded().setCtmcMethod(method);
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index]));
+            EXPECT_NEAR(expectedResults[index], result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6)
+                << "method: " << storm::solver::toString(method) << ", formula: " << *formulas[index];
+        }
+    }
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
@@ -10,12 +10,14 @@
 #include "storm/api/properties.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -415,4 +417,46 @@ TYPED_TEST(MarkovAutomatonCslModelCheckerTest, HOASimple) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+TEST(MarkovAutomatonCslModelCheckerTest, UnifPlusTimeBounds) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ma/server.ma");
+    auto model = storm::api::buildSparseModel<double>(program, storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(
+                                                                   "Pmax=? [F<1 \"error\"]", program)))
+                     ->template as<storm::models::sparse::MarkovAutomaton<double>>();
+    storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> checker(*model);
+    uint64_t initialState = *model->getInitialStates().begin();
+
+    storm::Environment env;
+    env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::UnifPlus);
+    env.solver().timeBounded().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    storm::Environment parallelEnv = env;
+    parallelEnv.solver().timeBounded().setNumberOfThreads(4);
+
+    std::vector<double> timeBounds = {0.0, 0.25, 0.5, 1.0, 2.0};
+    for (std::string const operatorString : {"Pmax", "Pmin"}) {
+        // Evaluating all time bounds at once (with and without multiple threads) has to coincide with checking each time bound separately.
+        auto formula = storm::api::parsePropertiesForPrismProgram(operatorString + "=? [F<=1 \"error\"]", program).front().getRawFormula();
+        auto untilTask = storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula, true)
+                             .substituteFormula(formula->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula());
+        auto sequentialCurve = checker.computeBoundedUntilProbabilitiesForTimeBounds(env, untilTask, timeBounds);
+        auto parallelCurve = checker.computeBoundedUntilProbabilitiesForTimeBounds(parallelEnv, untilTask, timeBounds);
+        ASSERT_EQ(timeBounds.size(), sequentialCurve.size());
+        ASSERT_EQ(timeBounds.size(), parallelCurve.size());
+        EXPECT_NEAR(0.0, sequentialCurve.front()[initialState], 1e-5);
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            EXPECT_NEAR(sequentialCurve[boundIndex][initialState], parallelCurve[boundIndex][initialState], 1e-5);
+            if (boundIndex > 0) {
+                auto boundedFormula =
+                    storm::api::parsePropertiesForPrismProgram(operatorString + "=? [F<=" + std::to_string(timeBounds[boundIndex]) + " \"error\"]", program)
+                        .front()
+                        .getRawFormula();
+                auto result = checker.check(parallelEnv, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*boundedFormula, true));
+                EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[initialState], sequentialCurve[boundIndex][initialState], 1e-5);
+            }
+        }
+        if (operatorString == "Pmax") {
+            EXPECT_NEAR(0.455504, sequentialCurve[3][initialState], 1e-5);
+        }
+    }
+}
 }  // namespace
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+
+namespace storm {
+namespace test {
+
+/*!
+ * Returns the environments under which the epochs of a reward unfolding are checked in the tests, together with a name for diagnostics.
+ * The first environment analyzes the epochs sequentially, the others use four threads with and without a limit on the stored epoch results.
+ */
+inline std::vector<std::pair<std::string, storm::Environment>> getEpochThreadEnvironments() {
+    std::vector<std::pair<std::string, storm::Environment>> environments(3);
+    environments[0].first = "sequential";
+    environments[1].first = "concurrent";
+    environments[1].second.modelchecker().setNumberOfEpochThreads(4);
+    environments[2].first = "concurrent with memory limit";
+    environments[2].second.modelchecker().setNumberOfEpochThreads(4);
+    environments[2].second.modelchecker().setEpochMemoryLimit(1);
+    return environments;
+}
+
+}  // namespace test
+}  // namespace storm
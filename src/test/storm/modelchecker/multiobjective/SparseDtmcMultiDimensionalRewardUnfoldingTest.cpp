@@ -1,4 +1,5 @@
 #include "storm-config.h"
+#include "test/storm/modelchecker/multiobjective/EpochThreadEnvironments.h"
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/api/storm-parsers.h"
@@ -127,3 +128,27 @@ TEST_F(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
               result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST_F(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_concurrent_epochs) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; R{\"observe0\"}=? [C{\"num_runs\"}<=3]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc =
+        storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+
+    std::vector<double> expectedResults = {78686542099694893.0 / 1268858272000000000.0, 620529.0 / 1364000.0};
+    for (uint64_t formulaIndex = 0; formulaIndex < formulas.size(); ++formulaIndex) {
+        for (auto const& [envName, env] : storm::test::getEpochThreadEnvironments()) {
+            SCOPED_TRACE(envName);
+            auto result = storm::api::verifyWithSparseEngine(env, dtmc, storm::api::createTask<double>(formulas[formulaIndex], true));
+            ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+            EXPECT_NEAR(expectedResults[formulaIndex], result->asExplicitQuantitativeCheckResult<double>()[initState], 1e-6);
+        }
+    }
+}
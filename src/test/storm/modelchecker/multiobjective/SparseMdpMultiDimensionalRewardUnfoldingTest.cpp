@@ -1,4 +1,5 @@
 #include "storm-config.h"
+#include "test/storm/modelchecker/multiobjective/EpochThreadEnvironments.h"
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/api/storm-parsers.h"
@@ -109,6 +110,34 @@ TEST_F(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_lar
     EXPECT_EQ(expectedResult, result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
 
+TEST_F(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_concurrent_epochs) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=5,{\"l\"}<=10 x=N ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}>=3 x=N ] ";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    // The first environment analyzes the epochs sequentially and provides the reference results
+    auto environments = storm::test::getEpochThreadEnvironments();
+    for (auto const& formula : formulas) {
+        auto expectedResult = storm::api::verifyWithSparseEngine(environments.front().second, mdp, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(expectedResult->isExplicitQuantitativeCheckResult());
+        for (auto const& [envName, env] : environments) {
+            SCOPED_TRACE(envName);
+            auto result = storm::api::verifyWithSparseEngine(env, mdp, storm::api::createTask<double>(formula, true));
+            ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
+            EXPECT_NEAR(expectedResult->asExplicitQuantitativeCheckResult<double>()[initState], result->asExplicitQuantitativeCheckResult<double>()[initState],
+                        1e-6);
+        }
+    }
+}
+
 TEST_F(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec) {
     storm::Environment env;
 
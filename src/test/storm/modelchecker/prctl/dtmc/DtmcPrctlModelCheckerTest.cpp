@@ -8,6 +8,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -705,6 +706,52 @@ TEST(DtmcPrctlModelCheckerTest, AllUntilProbabilities) {
     EXPECT_NEAR(0, result[12], 1e-6);
 }
 
+TEST(DtmcPrctlModelCheckerTest, LargeStepBounds) {
+    std::string formulasString = "P=? [F<=1000000 \"one\"]";
+    formulasString += "; P=? [F[1000000,1000000] \"one\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*model);
+    storm::modelchecker::ExplicitQualitativeCheckResult initialStates(model->getInitialStates());
+
+    // The iterations either converge or become periodic. In both cases, not all steps have to be performed.
+    for (bool exactSteps : {false, true}) {
+        storm::Environment env;
+        env.modelchecker().setExactStepBoundedEvaluation(exactSteps);
+        for (auto const& formula : formulas) {
+            auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+            result->filter(initialStates);
+            EXPECT_NEAR(1.0 / 6, result->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+        }
+    }
+
+    // A cyclic model whose iterations are periodic.
+    std::string cycle =
+        "dtmc\n"
+        "module cycle\n"
+        "  s : [0..2] init 0;\n"
+        "  [] s=0 -> (s'=1);\n"
+        "  [] s=1 -> (s'=2);\n"
+        "  [] s=2 -> (s'=0);\n"
+        "endmodule\n"
+        "label \"zero\" = s=0;\n";
+    program = storm::parser::PrismParser::parseFromString(cycle, "cycle");
+    formulas = storm::api::extractFormulasFromProperties(
+        storm::api::parsePropertiesForPrismProgram("P=? [F[1000000,1000000] \"zero\"]; P=? [F[999999,999999] \"zero\"]", program));
+    auto exactModel = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->template as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<storm::RationalNumber>> exactChecker(*exactModel);
+    storm::modelchecker::ExplicitQualitativeCheckResult exactInitialStates(exactModel->getInitialStates());
+    storm::Environment env;
+    auto result = exactChecker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalNumber>(*formulas[0]));
+    result->filter(exactInitialStates);
+    EXPECT_EQ(storm::utility::zero<storm::RationalNumber>(), result->asQuantitativeCheckResult<storm::RationalNumber>().getMin());
+    result = exactChecker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalNumber>(*formulas[1]));
+    result->filter(exactInitialStates);
+    EXPECT_EQ(storm::utility::one<storm::RationalNumber>(), result->asQuantitativeCheckResult<storm::RationalNumber>().getMin());
+}
+
 TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesDie) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=? [(X s>0) U (s=7 & d=2)]";
@@ -796,6 +843,42 @@ TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesSynchronousLeader) {
 #endif
 }
 
+TYPED_TEST(DtmcPrctlModelCheckerTest, LtlQualitativeCrowds) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+    // The product has more states than are explored before the first analysis of a partial product.
+    std::string formulasString = "P>0 [ F G \"observe0Greater1\" ]";
+    formulasString += "; P>=1 [ F G \"observe0Greater1\" ]";
+    formulasString += "; P<1 [ (F G \"observe0Greater1\") | (G F !\"observe0Greater1\") ]";
+    formulasString += "; P>0 [ (F G \"observe0Greater1\") & (G F !\"observe0Greater1\") ]";
+
+    auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+    auto checker = this->createModelChecker(model);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    // LTL not supported in all engines (Hybrid,  PrismDd, JaniDd)
+    if (TypeParam::engine == DtmcEngine::PrismSparse || TypeParam::engine == DtmcEngine::JaniSparse) {
+        result = checker->check(tasks[0]);
+        EXPECT_TRUE(this->getQualitativeResultAtInitialState(model, result));
+
+        result = checker->check(tasks[1]);
+        EXPECT_FALSE(this->getQualitativeResultAtInitialState(model, result));
+
+        result = checker->check(tasks[2]);
+        EXPECT_FALSE(this->getQualitativeResultAtInitialState(model, result));
+
+        result = checker->check(tasks[3]);
+        EXPECT_FALSE(this->getQualitativeResultAtInitialState(model, result));
+    } else {
+        EXPECT_FALSE(checker->canHandle(tasks[0]));
+    }
+#else
+    GTEST_SKIP();
+#endif
+}
+
 TYPED_TEST(DtmcPrctlModelCheckerTest, HOAProbabilitiesDie) {
     // "P=? [(X s>0) U (s=7 & d=2)]"
     std::string formulasString = "P=?[HOA: {\"" STORM_TEST_RESOURCES_DIR "/hoa/automaton_UXp0p1.hoa\", \"p0\" -> (s>0), \"p1\" -> (s=7 & d=2) }]";
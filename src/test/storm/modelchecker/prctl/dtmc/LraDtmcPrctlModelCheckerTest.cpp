@@ -1,7 +1,11 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
 #include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -331,4 +335,23 @@ TYPED_TEST(LraDtmcPrctlModelCheckerTest, LRA) {
         EXPECT_NEAR(this->parseNumber("1/10"), quantitativeResult1[14], this->precision());
     }
 }
+
+TEST(LraDtmcPrctlModelCheckerTest, ConcurrentBsccs) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-4-3.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("LRA=? [\"observeIGreater1\"]", program));
+    auto dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas.front());
+
+    for (auto method : {storm::solver::LraMethod::ValueIteration, storm::solver::LraMethod::GainBiasEquations,
+                        storm::solver::LraMethod::LraDistributionEquations}) {
+        storm::Environment env;
+        env.solver().lra().setDetLraMethod(method);
+        auto sequentialResult = checker.check(env, task)->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        env.solver().lra().setNumberOfThreads(4);
+        auto parallelResult = checker.check(env, task)->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        // The components are analyzed independently, so the results have to coincide exactly.
+        EXPECT_EQ(sequentialResult, parallelResult);
+    }
+}
 }  // namespace
\ No newline at end of file
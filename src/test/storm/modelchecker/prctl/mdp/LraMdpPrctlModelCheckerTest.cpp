@@ -490,4 +490,34 @@ TYPED_TEST(LraMdpPrctlModelCheckerTest, cs_nfail) {
     EXPECT_NEAR(this->parseNumber("0"), result[*mdp->getInitialStates().begin()], this->precision());
 }
 
+
+TEST(LraMdpPrctlModelCheckerTest, ConcurrentMecs) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/cs_nfail3.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(
+        storm::api::parsePropertiesForPrismProgram("R{\"grants\"}max=? [ MP ]; R{\"grants\"}min=? [ MP ]", program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+
+    storm::Environment env;
+    env.solver().lra().setNondetLraMethod(storm::solver::LraMethod::ValueIteration);
+    storm::Environment parallelEnv = env;
+    parallelEnv.solver().lra().setNumberOfThreads(4);
+    for (auto const& formula : formulas) {
+        storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+        task.setProduceSchedulers(true);
+        auto sequentialResult = checker.check(env, task);
+        auto parallelResult = checker.check(parallelEnv, task);
+        // The components are analyzed independently, so the results (and the schedulers) have to coincide exactly.
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<double>().getValueVector(),
+                  parallelResult->asExplicitQuantitativeCheckResult<double>().getValueVector());
+        auto const& sequentialScheduler = sequentialResult->asExplicitQuantitativeCheckResult<double>().getScheduler();
+        auto const& parallelScheduler = parallelResult->asExplicitQuantitativeCheckResult<double>().getScheduler();
+        for (uint64_t state = 0; state < mdp->getNumberOfStates(); ++state) {
+            ASSERT_EQ(sequentialScheduler.getChoice(state).isDefined(), parallelScheduler.getChoice(state).isDefined());
+            if (sequentialScheduler.getChoice(state).isDefined()) {
+                EXPECT_EQ(sequentialScheduler.getChoice(state).getDeterministicChoice(), parallelScheduler.getChoice(state).getDeterministicChoice());
+            }
+        }
+    }
+}
 }  // namespace
@@ -0,0 +1,124 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerResultCache.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+
+template<typename CheckerType>
+double checkWithCache(storm::Environment const& env, CheckerType& checker, std::string const& formulaString,
+                      std::shared_ptr<storm::modelchecker::ExplicitModelCheckerResultCache<double>> const& cache, bool produceSchedulers = false) {
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+    task.setProduceSchedulers(produceSchedulers);
+    task.setHint(cache);
+    auto result = checker.check(env, task);
+    return result->template asExplicitQuantitativeCheckResult<double>()[0];
+}
+
+TEST(ResultCacheMdpPrctlModelCheckerTest, Dice) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "",
+                                                STORM_TEST_RESOURCES_DIR "/rew/two_dice.flip.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Mdp);
+    auto mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    auto cache = std::make_shared<storm::modelchecker::ExplicitModelCheckerResultCache<double>>();
+    EXPECT_TRUE(cache->isEmpty());
+
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(env, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_FALSE(cache->isEmpty());
+    EXPECT_EQ(0ull, cache->getNumberOfCacheHits());
+
+    // Exact repetitions are answered from the cache.
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(env, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(1ull, cache->getNumberOfCacheHits());
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(env, checker, "Pmax=? [true U \"two\"]", cache), precision);
+    EXPECT_EQ(2ull, cache->getNumberOfCacheHits());
+
+    // A different direction or target needs to be computed.
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(env, checker, "Pmin=? [F \"two\"]", cache), precision);
+    EXPECT_NEAR(2.0 / 36.0, checkWithCache(env, checker, "Pmin=? [F \"three\"]", cache), precision);
+    EXPECT_EQ(2ull, cache->getNumberOfCacheHits());
+
+    // Schedulers are only taken from the cache if they have been computed before.
+    EXPECT_NEAR(2.0 / 36.0, checkWithCache(env, checker, "Pmin=? [F \"three\"]", cache, true), precision);
+    EXPECT_EQ(2ull, cache->getNumberOfCacheHits());
+    EXPECT_NEAR(2.0 / 36.0, checkWithCache(env, checker, "Pmin=? [F \"three\"]", cache, true), precision);
+    EXPECT_EQ(3ull, cache->getNumberOfCacheHits());
+
+    // Qualitative queries are answered by the (cached) qualitative analysis.
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P>=1 [F \"four\"]");
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula, true);
+    task.setHint(cache);
+    EXPECT_FALSE(checker.check(env, task)->asExplicitQualitativeCheckResult()[0]);
+    EXPECT_FALSE(checker.check(env, task)->asExplicitQualitativeCheckResult()[0]);
+    EXPECT_EQ(5ull, cache->getNumberOfCacheHits());
+
+    EXPECT_NEAR(22.0 / 3.0, checkWithCache(env, checker, "Rmin=? [F \"done\"]", cache), precision);
+    EXPECT_NEAR(22.0 / 3.0, checkWithCache(env, checker, "Rmax=? [F \"done\"]", cache), precision);
+    EXPECT_NEAR(22.0 / 3.0, checkWithCache(env, checker, "Rmin=? [F \"done\"]", cache), precision);
+    EXPECT_EQ(6ull, cache->getNumberOfCacheHits());
+
+    // Cached values are only reused if they were computed with at least the requested precision.
+    storm::Environment coarseEnv;
+    coarseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(coarseEnv, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(7ull, cache->getNumberOfCacheHits());
+    storm::Environment fineEnv;
+    fineEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(fineEnv, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(7ull, cache->getNumberOfCacheHits());
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(env, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(8ull, cache->getNumberOfCacheHits());
+    storm::Environment relativeEnv = env;
+    relativeEnv.solver().minMax().setRelativeTerminationCriterion(!env.solver().minMax().getRelativeTerminationCriterion());
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(relativeEnv, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(8ull, cache->getNumberOfCacheHits());
+    storm::Environment soundEnv = env;
+    soundEnv.solver().setForceSoundness(true);
+    EXPECT_NEAR(1.0 / 36.0, checkWithCache(soundEnv, checker, "Pmax=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(8ull, cache->getNumberOfCacheHits());
+
+    cache->clear();
+    EXPECT_TRUE(cache->isEmpty());
+}
+
+TEST(ResultCacheMdpPrctlModelCheckerTest, DieDtmc) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
+        STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
+    storm::Environment env;
+    double const precision = 1e-6;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    auto dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+    auto cache = std::make_shared<storm::modelchecker::ExplicitModelCheckerResultCache<double>>();
+
+    EXPECT_NEAR(1.0 / 6.0, checkWithCache(env, checker, "P=? [F \"one\"]", cache), precision);
+    EXPECT_NEAR(1.0 / 6.0, checkWithCache(env, checker, "P=? [F \"one\"]", cache), precision);
+    EXPECT_NEAR(1.0 / 6.0, checkWithCache(env, checker, "P=? [F \"two\"]", cache), precision);
+    EXPECT_EQ(1ull, cache->getNumberOfCacheHits());
+
+    EXPECT_NEAR(11.0 / 3.0, checkWithCache(env, checker, "R=? [F \"done\"]", cache), precision);
+    EXPECT_NEAR(11.0 / 3.0, checkWithCache(env, checker, "R=? [F \"done\"]", cache), precision);
+    EXPECT_EQ(2ull, cache->getNumberOfCacheHits());
+}
+
+}  // namespace
@@ -126,3 +126,82 @@ TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     EXPECT_EQ(65ul, result->getNumberOfStates());
     EXPECT_EQ(105ul, result->getNumberOfTransitions());
 }
+
+TEST(DeterministicModelBisimulationDecomposition, CrowdsSignatureRefinement) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+        options.signatureRefinement = true;
+        options.numberOfThreads = numberOfThreads;
+
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(*dtmc, options);
+        std::shared_ptr<storm::models::sparse::Model<double>> result;
+        ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+        ASSERT_NO_THROW(result = bisim.getQuotient());
+
+        EXPECT_EQ(storm::models::ModelType::Dtmc, result->getType());
+        EXPECT_EQ(334ul, result->getNumberOfStates());
+        EXPECT_EQ(546ul, result->getNumberOfTransitions());
+
+        options.respectedAtomicPropositions = std::set<std::string>({"observe0Greater1"});
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim2(*dtmc, options);
+        ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+        ASSERT_NO_THROW(result = bisim2.getQuotient());
+
+        EXPECT_EQ(65ul, result->getNumberOfStates());
+        EXPECT_EQ(105ul, result->getNumberOfTransitions());
+
+        typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options2(*dtmc, *formula);
+        options2.signatureRefinement = true;
+        options2.numberOfThreads = numberOfThreads;
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim3(*dtmc, options2);
+        ASSERT_NO_THROW(bisim3.computeBisimulationDecomposition());
+        ASSERT_NO_THROW(result = bisim3.getQuotient());
+
+        EXPECT_EQ(64ul, result->getNumberOfStates());
+        EXPECT_EQ(104ul, result->getNumberOfTransitions());
+    }
+}
+
+TEST(DeterministicModelBisimulationDecomposition, SignatureRefinementPrecision) {
+    // States 1 and 2 have probabilities that only differ by less than the precision of the comparator.
+    storm::storage::SparseMatrixBuilder<double> builder(5, 5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(0, 2, 0.5);
+    builder.addNextValue(1, 3, 0.7);
+    builder.addNextValue(1, 4, 0.3);
+    builder.addNextValue(2, 3, 0.7 - 1e-9);
+    builder.addNextValue(2, 4, 0.3 + 1e-9);
+    builder.addNextValue(3, 3, 1.0);
+    builder.addNextValue(4, 4, 1.0);
+    storm::models::sparse::StateLabeling labeling(5);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("goal");
+    labeling.addLabelToState("goal", 4);
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), std::move(labeling));
+
+    storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisim(dtmc);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+    EXPECT_EQ(4ul, result->getNumberOfStates());
+
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>>::Options options;
+        options.signatureRefinement = true;
+        options.numberOfThreads = numberOfThreads;
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> signatureBisim(dtmc, options);
+        ASSERT_NO_THROW(signatureBisim.computeBisimulationDecomposition());
+        ASSERT_NO_THROW(result = signatureBisim.getQuotient());
+        EXPECT_EQ(4ul, result->getNumberOfStates());
+    }
+}
@@ -60,3 +60,40 @@ TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     EXPECT_EQ(26ul, result->getNumberOfTransitions());
     EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
 }
+
+TEST(NondeterministicModelBisimulationDecomposition, TwoDiceSignatureRefinement) {
+#ifndef STORM_HAVE_Z3
+    GTEST_SKIP() << "Z3 not available.";
+#endif
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>::Options options;
+        options.signatureRefinement = true;
+        options.numberOfThreads = numberOfThreads;
+
+        storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> bisim(*mdp, options);
+        ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+        std::shared_ptr<storm::models::sparse::Model<double>> result;
+        ASSERT_NO_THROW(result = bisim.getQuotient());
+
+        EXPECT_EQ(storm::models::ModelType::Mdp, result->getType());
+        EXPECT_EQ(77ul, result->getNumberOfStates());
+        EXPECT_EQ(183ul, result->getNumberOfTransitions());
+        EXPECT_EQ(97ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+
+        options.respectedAtomicPropositions = std::set<std::string>({"two"});
+        storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> bisim2(*mdp, options);
+        ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+        ASSERT_NO_THROW(result = bisim2.getQuotient());
+
+        EXPECT_EQ(11ul, result->getNumberOfStates());
+        EXPECT_EQ(26ul, result->getNumberOfTransitions());
+        EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    }
+}
@@ -338,3 +338,117 @@ TEST_F(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST_F(GraphTest, ExplicitProb01Frontier) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+
+    storm::storage::SparseMatrix<double> backwardTransitions = model->getBackwardTransitions();
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    for (auto const& label : {"observe0Greater1", "observeIGreater1", "observeOnlyTrueSender"}) {
+        storm::storage::BitVector const& psiStates = model->getStates(label);
+        storm::storage::BitVector expectedGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, psiStates);
+        storm::storage::BitVector expectedProb1 = storm::utility::graph::performProb1(backwardTransitions, allStates, psiStates);
+        for (uint64_t numberOfThreads : {1ull, 4ull}) {
+            EXPECT_EQ(expectedGreater0, storm::utility::graph::performProbGreater0Frontier(backwardTransitions, allStates, psiStates, numberOfThreads));
+            EXPECT_EQ(expectedProb1, storm::utility::graph::performProb1Frontier(backwardTransitions, allStates, psiStates, numberOfThreads));
+            auto statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, allStates, psiStates, numberOfThreads);
+            EXPECT_EQ(~expectedGreater0, statesWithProbability01.first);
+            EXPECT_EQ(expectedProb1, statesWithProbability01.second);
+        }
+    }
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+
+    storm::storage::SparseMatrix<double> const& transitionMatrix = model->getTransitionMatrix();
+    std::vector<uint_fast64_t> const& choiceIndices = transitionMatrix.getRowGroupIndices();
+    backwardTransitions = model->getBackwardTransitions();
+    allStates = storm::storage::BitVector(model->getNumberOfStates(), true);
+    storm::storage::BitVector notFinishedStates = ~model->getStates("finished");
+    for (auto const& label : {"all_coins_equal_0", "all_coins_equal_1"}) {
+        storm::storage::BitVector const& psiStates = model->getStates(label);
+        for (auto const& phiStates : {allStates, notFinishedStates}) {
+            storm::storage::BitVector expectedProb0A = storm::utility::graph::performProb0A(backwardTransitions, phiStates, psiStates);
+            storm::storage::BitVector expectedProb0E =
+                storm::utility::graph::performProb0E(transitionMatrix, choiceIndices, backwardTransitions, phiStates, psiStates);
+            storm::storage::BitVector expectedProb1E =
+                storm::utility::graph::performProb1E(transitionMatrix, choiceIndices, backwardTransitions, phiStates, psiStates);
+            storm::storage::BitVector expectedProb1A =
+                storm::utility::graph::performProb1A(transitionMatrix, choiceIndices, backwardTransitions, phiStates, psiStates);
+            for (uint64_t numberOfThreads : {1ull, 4ull}) {
+                EXPECT_EQ(expectedProb0A, storm::utility::graph::performProb0AFrontier(backwardTransitions, phiStates, psiStates, numberOfThreads));
+                EXPECT_EQ(expectedProb0E, storm::utility::graph::performProb0EFrontier(transitionMatrix, choiceIndices, backwardTransitions, phiStates,
+                                                                                        psiStates, numberOfThreads));
+                EXPECT_EQ(expectedProb1E, storm::utility::graph::performProb1EFrontier(transitionMatrix, choiceIndices, backwardTransitions, phiStates,
+                                                                                        psiStates, boost::none, numberOfThreads));
+                EXPECT_EQ(expectedProb1A, storm::utility::graph::performProb1AFrontier(transitionMatrix, choiceIndices, backwardTransitions, phiStates,
+                                                                                        psiStates, numberOfThreads));
+                auto statesWithProbability01 =
+                    storm::utility::graph::performProb01Max(transitionMatrix, choiceIndices, backwardTransitions, phiStates, psiStates, numberOfThreads);
+                EXPECT_EQ(expectedProb0A, statesWithProbability01.first);
+                EXPECT_EQ(expectedProb1E, statesWithProbability01.second);
+                EXPECT_EQ(storm::utility::graph::performProb01Min(transitionMatrix, choiceIndices, backwardTransitions, phiStates, psiStates),
+                          storm::utility::graph::performProb01Min(transitionMatrix, choiceIndices, backwardTransitions, phiStates, psiStates, numberOfThreads));
+            }
+        }
+    }
+}
+
+TEST_F(GraphTest, ExplicitProb01FrontierLarge) {
+    // A target, a sink, and two layers of states that are wide enough for the frontier of the backward search to be processed in parallel.
+    uint64_t const layerSize = 10000;
+    uint64_t const target = 0;
+    uint64_t const sink = 1;
+    uint64_t const numberOfStates = 2 + 2 * layerSize;
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true, numberOfStates);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        builder.newRowGroup(row);
+        if (state == target || state == sink) {
+            builder.addNextValue(row++, state, 1.0);
+        } else if (state < 2 + layerSize) {
+            // States of the first layer either reach the target almost surely or with probability 1/2.
+            if (state % 2 == 0) {
+                builder.addNextValue(row++, target, 1.0);
+            } else {
+                builder.addNextValue(row, target, 0.5);
+                builder.addNextValue(row++, sink, 0.5);
+            }
+        } else {
+            // States of the second layer move to the first layer. Every third state can also choose to move to the sink.
+            builder.addNextValue(row++, state - layerSize, 1.0);
+            if (state % 3 == 0) {
+                builder.addNextValue(row++, sink, 1.0);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> transitionMatrix = builder.build();
+    std::vector<uint_fast64_t> const& choiceIndices = transitionMatrix.getRowGroupIndices();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    storm::storage::BitVector allStates(numberOfStates, true);
+    storm::storage::BitVector psiStates(numberOfStates);
+    psiStates.set(target);
+
+    storm::storage::BitVector expectedProb0A = storm::utility::graph::performProb0A(backwardTransitions, allStates, psiStates);
+    storm::storage::BitVector expectedProb0E = storm::utility::graph::performProb0E(transitionMatrix, choiceIndices, backwardTransitions, allStates, psiStates);
+    storm::storage::BitVector expectedProb1E = storm::utility::graph::performProb1E(transitionMatrix, choiceIndices, backwardTransitions, allStates, psiStates);
+    storm::storage::BitVector expectedProb1A = storm::utility::graph::performProb1A(transitionMatrix, choiceIndices, backwardTransitions, allStates, psiStates);
+    EXPECT_EQ(1ull, expectedProb0A.getNumberOfSetBits());
+    // The sink and the 3334 states of the second layer that can choose to move to the sink.
+    EXPECT_EQ(3335ull, expectedProb0E.getNumberOfSetBits());
+    for (uint64_t numberOfThreads : {1ull, 4ull}) {
+        EXPECT_EQ(expectedProb0A, storm::utility::graph::performProb0AFrontier(backwardTransitions, allStates, psiStates, numberOfThreads));
+        EXPECT_EQ(expectedProb0E,
+                  storm::utility::graph::performProb0EFrontier(transitionMatrix, choiceIndices, backwardTransitions, allStates, psiStates, numberOfThreads));
+        EXPECT_EQ(expectedProb1E, storm::utility::graph::performProb1EFrontier(transitionMatrix, choiceIndices, backwardTransitions, allStates, psiStates,
+                                                                                boost::none, numberOfThreads));
+        EXPECT_EQ(expectedProb1A,
+                  storm::utility::graph::performProb1AFrontier(transitionMatrix, choiceIndices, backwardTransitions, allStates, psiStates, numberOfThreads));
+    }
+}